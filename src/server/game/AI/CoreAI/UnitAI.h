@@ -211,6 +211,28 @@ class UnitAI
         // predicate shall extend std::unary_function<Unit*, bool>
         template <class PREDICATE> Unit* SelectTarget(SelectAggroTarget targetType, uint32 position, PREDICATE const& predicate)
         {
+            // Walk the threat heap down to the wanted position, the threat list is neither sorted nor copied
+            if (targetType == SELECT_TARGET_TOPAGGRO)
+            {
+                Unit* result = NULL;
+                me->getThreatManager().visitByThreat([&](HostileReference* ref) -> bool
+                {
+                    if (!predicate(ref->getTarget()))
+                        return true;
+
+                    if (position)
+                    {
+                        --position;
+                        return true;
+                    }
+
+                    result = ref->getTarget();
+                    return false;
+                });
+
+                return result;
+            }
+
             const std::list<HostileReference*>& threatlist = me->getThreatManager().getThreatList();
             if (position >= threatlist.size())
                 return NULL;
@@ -89,6 +89,15 @@ namespace FactorySelector
         return (ai_factory == NULL ? new NullCreatureAI(creature) : ai_factory->Create(creature));
     }
 
+    FactoryHolder<CreatureAI, std::string> const* selectSpawnAIFactory(CreatureTemplate const* p_Template)
+    {
+        /// Scripted AIs and the flag / permit checks need the loaded creature, selectAI handles them
+        if (!p_Template || p_Template->ScriptID || p_Template->AIName.empty())
+            return nullptr;
+
+        return CreatureAIRegistry::instance()->GetRegistryItem(p_Template->AIName);
+    }
+
     MovementGenerator* selectMovementGenerator(Creature* creature)
     {
         MovementGeneratorRegistry& mv_registry(*MovementGeneratorRegistry::instance());
@@ -14,10 +14,16 @@ class Creature;
 class MovementGenerator;
 class GameObjectAI;
 class GameObject;
+struct CreatureTemplate;
+template<class T, class Key> class FactoryHolder;
+
+#include <string>
 
 namespace FactorySelector
 {
     CreatureAI* selectAI(Creature*);
+    /// AIName factory of a spawn without ScriptName, safe outside of the map thread
+    FactoryHolder<CreatureAI, std::string> const* selectSpawnAIFactory(CreatureTemplate const*);
     MovementGenerator* selectMovementGenerator(Creature*);
     GameObjectAI* SelectGameObjectAI(GameObject*);
 }
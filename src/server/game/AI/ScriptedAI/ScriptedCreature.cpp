@@ -291,15 +291,8 @@ void ScriptedAI::DoResetThreat()
         return;
     }
 
-    std::list<HostileReference*>& threatlist = me->getThreatManager().getThreatList();
-
-    for (std::list<HostileReference*>::iterator itr = threatlist.begin(); itr != threatlist.end(); ++itr)
-    {
-        Unit* unit = Unit::GetUnit(*me, (*itr)->getUnitGuid());
-
-        if (unit && DoGetThreat(unit))
-            DoModifyThreatPercent(unit, -100);
-    }
+    /// Lowering a threat can move the reference out of the threat list, the container walks a copy
+    me->getThreatManager().resetAllAggro();
 }
 
 float ScriptedAI::DoGetThreat(Unit* unit)
@@ -561,8 +554,8 @@ void BossAI::TeleportCheaters()
 {
     float x, y, z;
     me->GetPosition(x, y, z);
-    std::list<HostileReference*>& threatList = me->getThreatManager().getThreatList();
-    for (std::list<HostileReference*>::iterator itr = threatList.begin(); itr != threatList.end(); ++itr)
+    std::list<HostileReference*> const& threatList = me->getThreatManager().getThreatList();
+    for (std::list<HostileReference*>::const_iterator itr = threatList.begin(); itr != threatList.end(); ++itr)
         if (Unit* target = (*itr)->getTarget())
             if (target->IsPlayer() && !CheckBoundary(target))
                 target->NearTeleportTo(x, y, z, 0);
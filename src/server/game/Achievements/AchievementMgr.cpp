@@ -1310,23 +1310,19 @@ void AchievementMgr<T>::CheckAllAchievementCriteria(Player* p_ReferencePlayer)
     if (sWorld->getBoolConfig(CONFIG_ACHIEVEMENT_DISABLE))
         return;
 
+    /// Processed with the other criteria events of the player, by its map
+    AchievementCriteriaQueuedEvent l_Event;
+    l_Event.UnitGUID   = 0;
+    l_Event.MiscValue1 = 0;
+    l_Event.MiscValue2 = 0;
+    l_Event.MiscValue3 = 0;
+    l_Event.LoginCheck = true;
+    l_Event.PlayerOnly = true;
+
     for (uint32 l_AchievementCriteriaType = 0; l_AchievementCriteriaType < ACHIEVEMENT_CRITERIA_TYPE_TOTAL; ++l_AchievementCriteriaType)
     {
-        AchievementCriteriaUpdateTask l_Task;
-        l_Task.PlayerGUID = p_ReferencePlayer->GetGUID();
-        l_Task.UnitGUID   = 0;
-        l_Task.Task = [l_AchievementCriteriaType](uint64 const& p_PlayerGuid, uint64 const& /*p_UnitGUID*/) -> void
-        {
-            /// Task will be executed async
-            /// We need to ensure the player still exist
-            Player* l_Player = HashMapHolder<Player>::Find(p_PlayerGuid);
-            if (l_Player == nullptr)
-                return;
-
-            l_Player->GetAchievementMgr().UpdateAchievementCriteria((AchievementCriteriaTypes)l_AchievementCriteriaType, 0, 0, 0, nullptr, l_Player, true);
-        };
-
-        sAchievementMgr->AddCriteriaUpdateTask(l_Task);
+        l_Event.Type = l_AchievementCriteriaType;
+        p_ReferencePlayer->QueueAchievementCriteriaEvent(l_Event);
     }
 }
 
@@ -1360,7 +1356,14 @@ void AchievementMgr<T>::UpdateAchievementCriteria(AchievementCriteriaTypes p_Typ
     if (IsGuild<T>() && !sWorld->getBoolConfig(CONFIG_GUILD_LEVELING_ENABLED))
         return;
 
-    AchievementCriteriaEntryList const& l_AchievementCriteriaList = sAchievementMgr->GetAchievementCriteriaByType(p_Type);
+    if (sAchievementMgr->IsRecordingCriteriaEvents())
+        sAchievementMgr->RecordCriteriaEvent(p_Type, p_MiscValue1, p_MiscValue2, p_MiscValue3);
+
+    AchievementCriteriaEntryList const& l_AchievementCriteriaList = sAchievementMgr->GetAchievementCriteriaByTypeAndAsset(p_Type, p_MiscValue1);
+
+    uint32 l_TypeCriteriaCount = sAchievementMgr->GetAchievementCriteriaByType(p_Type).size();
+    sAchievementMgr->AddCriteriaTypeCounters(p_Type, l_AchievementCriteriaList.size(), l_TypeCriteriaCount - l_AchievementCriteriaList.size());
+
     for (AchievementCriteriaEntryList::const_iterator i = l_AchievementCriteriaList.begin(); i != l_AchievementCriteriaList.end(); ++i)
     {
         CriteriaEntry const* l_AchievementCriteria = (*i);
@@ -2772,6 +2775,31 @@ bool AchievementMgr<T>::CanUpdateCriteria(CriteriaEntry const* p_Criteria, Achie
     return true;
 }
 
+template<class T>
+uint64 AchievementMgr<T>::ReplayCriteriaEvents(std::vector<AchievementCriteriaEvent> const& p_Events, Player* p_ReferencePlayer, bool p_UseAssetIndex)
+{
+    uint64 l_Evaluated = 0;
+
+    for (AchievementCriteriaEvent const& l_Event : p_Events)
+    {
+        AchievementCriteriaTypes l_Type = AchievementCriteriaTypes(l_Event.Type);
+        AchievementCriteriaEntryList const& l_List = p_UseAssetIndex ? sAchievementMgr->GetAchievementCriteriaByTypeAndAsset(l_Type, l_Event.MiscValue1)
+                                                                     : sAchievementMgr->GetAchievementCriteriaByType(l_Type);
+
+        for (CriteriaEntry const* l_Criteria : l_List)
+        {
+            ++l_Evaluated;
+            if (!CanUpdateCriteria(l_Criteria, NULL, l_Event.MiscValue1, l_Event.MiscValue2, l_Event.MiscValue3, NULL, p_ReferencePlayer))
+                continue;
+
+            if (AchievementCriteriaDataSet const* l_Data = sAchievementMgr->GetCriteriaDataSet(l_Criteria))
+                l_Data->Meets(p_ReferencePlayer, NULL, l_Event.MiscValue1);
+        }
+    }
+
+    return l_Evaluated;
+}
+
 template<class T>
 bool AchievementMgr<T>::ConditionsSatisfied(CriteriaEntry const* /*p_Criteria*/, Player* /*p_ReferencePlayer*/) const
 {
@@ -3766,6 +3794,189 @@ template class AchievementMgr<Guild>;
 #endif
 template class AchievementMgr<Player>;
 
+bool AchievementGlobalMgr::IsAssetIndexedCriteriaType(AchievementCriteriaTypes p_Type)
+{
+    /// Must stay in sync with AchievementMgr::RequirementsSatisfied: a non zero miscValue1 different from the criteria asset fails
+    switch (p_Type)
+    {
+        case ACHIEVEMENT_CRITERIA_TYPE_KILL_CREATURE:
+        case ACHIEVEMENT_CRITERIA_TYPE_KILLED_BY_CREATURE:
+        case ACHIEVEMENT_CRITERIA_TYPE_REACH_SKILL_LEVEL:
+        case ACHIEVEMENT_CRITERIA_TYPE_LEARN_SKILL_LEVEL:
+        case ACHIEVEMENT_CRITERIA_TYPE_COMPLETE_QUESTS_IN_ZONE:
+        case ACHIEVEMENT_CRITERIA_TYPE_COMPLETE_QUEST:
+        case ACHIEVEMENT_CRITERIA_TYPE_BE_SPELL_TARGET:
+        case ACHIEVEMENT_CRITERIA_TYPE_BE_SPELL_TARGET2:
+        case ACHIEVEMENT_CRITERIA_TYPE_CAST_SPELL:
+        case ACHIEVEMENT_CRITERIA_TYPE_CAST_SPELL2:
+        case ACHIEVEMENT_CRITERIA_TYPE_LEARN_SPELL:
+        case ACHIEVEMENT_CRITERIA_TYPE_OWN_ITEM:
+        case ACHIEVEMENT_CRITERIA_TYPE_USE_ITEM:
+        case ACHIEVEMENT_CRITERIA_TYPE_LOOT_ITEM:
+        case ACHIEVEMENT_CRITERIA_TYPE_GAIN_REPUTATION:
+        case ACHIEVEMENT_CRITERIA_TYPE_DO_EMOTE:
+        case ACHIEVEMENT_CRITERIA_TYPE_EQUIP_ITEM:
+        case ACHIEVEMENT_CRITERIA_TYPE_USE_GAMEOBJECT:
+        case ACHIEVEMENT_CRITERIA_TYPE_FISH_IN_GAMEOBJECT:
+        case ACHIEVEMENT_CRITERIA_TYPE_LEARN_SKILLLINE_SPELLS:
+        case ACHIEVEMENT_CRITERIA_TYPE_CAPTURE_BATTLEPET:
+        case ACHIEVEMENT_CRITERIA_TYPE_LEARN_SKILL_LINE:
+        case ACHIEVEMENT_CRITERIA_TYPE_LEVELUP_BATTLEPET:
+        case ACHIEVEMENT_CRITERIA_TYPE_HK_CLASS:
+        case ACHIEVEMENT_CRITERIA_TYPE_HK_RACE:
+        case ACHIEVEMENT_CRITERIA_TYPE_BG_OBJECTIVE_CAPTURE:
+        case ACHIEVEMENT_CRITERIA_TYPE_HONORABLE_KILL_AT_AREA:
+        case ACHIEVEMENT_CRITERIA_TYPE_CURRENCY:
+        case ACHIEVEMENT_CRITERIA_TYPE_DEFEAT_ENCOUNTER:
+        /// Checked against the challenge dungeon map
+        case ACHIEVEMENT_CRITERIA_TYPE_ACCEPTED_SUMMONINGS:
+        case ACHIEVEMENT_CRITERIA_TYPE_COMPLETE_DAILY_QUEST:
+        case ACHIEVEMENT_CRITERIA_TYPE_CREATE_AUCTION:
+        case ACHIEVEMENT_CRITERIA_TYPE_FALL_WITHOUT_DYING:
+        case ACHIEVEMENT_CRITERIA_TYPE_FLIGHT_PATHS_TAKEN:
+        case ACHIEVEMENT_CRITERIA_TYPE_GET_KILLING_BLOWS:
+        case ACHIEVEMENT_CRITERIA_TYPE_GOLD_EARNED_BY_AUCTIONS:
+        case ACHIEVEMENT_CRITERIA_TYPE_GOLD_SPENT_AT_BARBER:
+        case ACHIEVEMENT_CRITERIA_TYPE_GOLD_SPENT_FOR_MAIL:
+        case ACHIEVEMENT_CRITERIA_TYPE_GOLD_SPENT_FOR_TALENTS:
+        case ACHIEVEMENT_CRITERIA_TYPE_GOLD_SPENT_FOR_TRAVELLING:
+        case ACHIEVEMENT_CRITERIA_TYPE_HIGHEST_AUCTION_BID:
+        case ACHIEVEMENT_CRITERIA_TYPE_HIGHEST_AUCTION_SOLD:
+        case ACHIEVEMENT_CRITERIA_TYPE_HIGHEST_HEALING_RECEIVED:
+        case ACHIEVEMENT_CRITERIA_TYPE_HIGHEST_HEAL_CASTED:
+        case ACHIEVEMENT_CRITERIA_TYPE_HIGHEST_HIT_DEALT:
+        case ACHIEVEMENT_CRITERIA_TYPE_HIGHEST_HIT_RECEIVED:
+        case ACHIEVEMENT_CRITERIA_TYPE_HONORABLE_KILL:
+        case ACHIEVEMENT_CRITERIA_TYPE_LOOT_MONEY:
+        case ACHIEVEMENT_CRITERIA_TYPE_LOSE_DUEL:
+        case ACHIEVEMENT_CRITERIA_TYPE_MONEY_FROM_QUEST_REWARD:
+        case ACHIEVEMENT_CRITERIA_TYPE_MONEY_FROM_VENDORS:
+        case ACHIEVEMENT_CRITERIA_TYPE_NUMBER_OF_TALENT_RESETS:
+        case ACHIEVEMENT_CRITERIA_TYPE_QUEST_ABANDONED:
+        case ACHIEVEMENT_CRITERIA_TYPE_REACH_GUILD_LEVEL:
+        case ACHIEVEMENT_CRITERIA_TYPE_ROLL_GREED:
+        case ACHIEVEMENT_CRITERIA_TYPE_ROLL_NEED:
+        case ACHIEVEMENT_CRITERIA_TYPE_SPECIAL_PVP_KILL:
+        case ACHIEVEMENT_CRITERIA_TYPE_TOTAL_DAMAGE_RECEIVED:
+        case ACHIEVEMENT_CRITERIA_TYPE_TOTAL_HEALING_RECEIVED:
+        case ACHIEVEMENT_CRITERIA_TYPE_USE_LFD_TO_GROUP_WITH_PLAYERS:
+        case ACHIEVEMENT_CRITERIA_TYPE_VISIT_BARBER_SHOP:
+        case ACHIEVEMENT_CRITERIA_TYPE_WIN_DUEL:
+        case ACHIEVEMENT_CRITERIA_TYPE_WIN_RATED_ARENA:
+        case ACHIEVEMENT_CRITERIA_TYPE_WON_AUCTIONS:
+        case ACHIEVEMENT_CRITERIA_TYPE_COOK_SOME_MEALS:
+        case ACHIEVEMENT_CRITERIA_TYPE_WIN_CHALLENGE_DUNGEON:
+            return true;
+        default:
+            break;
+    }
+
+    return false;
+}
+
+AchievementCriteriaEntryList const& AchievementGlobalMgr::GetAchievementCriteriaByTypeAndAsset(AchievementCriteriaTypes p_Type, uint64 p_MiscValue1) const
+{
+    /// Login checks and events without asset evaluate the whole type
+    if (!p_MiscValue1 || !IsAssetIndexedCriteriaType(p_Type))
+        return m_AchievementCriteriasByType[p_Type];
+
+    static AchievementCriteriaEntryList const s_EmptyList;
+
+    if (p_MiscValue1 > std::numeric_limits<uint32>::max())
+        return s_EmptyList;
+
+    AchievementCriteriaByAsset::const_iterator l_Itr = m_AchievementCriteriasByAsset[p_Type].find(uint32(p_MiscValue1));
+    if (l_Itr == m_AchievementCriteriasByAsset[p_Type].end())
+        return s_EmptyList;
+
+    return l_Itr->second;
+}
+
+AchievementCriteriaThreadCounters::AchievementCriteriaThreadCounters() : Queued(0), Coalesced(0), Processed(0)
+{
+    for (uint32 l_Type = 0; l_Type < ACHIEVEMENT_CRITERIA_TYPE_TOTAL; ++l_Type)
+    {
+        TypeEvents[l_Type]    = 0;
+        TypeEvaluated[l_Type] = 0;
+        TypeSkipped[l_Type]   = 0;
+    }
+}
+
+/// Set once per thread, the counters stay owned by AchievementGlobalMgr so they outlive their thread
+static thread_local AchievementCriteriaThreadCounters* t_CriteriaCounters = nullptr;
+
+AchievementGlobalMgr::~AchievementGlobalMgr()
+{
+    for (AchievementCriteriaThreadCounters* l_Counters : m_ThreadCriteriaCounters)
+        delete l_Counters;
+}
+
+AchievementCriteriaThreadCounters* AchievementGlobalMgr::GetThreadCriteriaCounters()
+{
+    if (!t_CriteriaCounters)
+    {
+        AchievementCriteriaThreadCounters* l_Counters = new AchievementCriteriaThreadCounters();
+
+        std::lock_guard<std::mutex> l_Guard(m_ThreadCriteriaCountersLock);
+        m_ThreadCriteriaCounters.push_back(l_Counters);
+        t_CriteriaCounters = l_Counters;
+    }
+
+    return t_CriteriaCounters;
+}
+
+void AchievementGlobalMgr::GetCriteriaCounters(AchievementCriteriaTypeCounters* p_Types, AchievementCriteriaQueueCounters& p_Queue)
+{
+    std::lock_guard<std::mutex> l_Guard(m_ThreadCriteriaCountersLock);
+
+    for (AchievementCriteriaThreadCounters const* l_Counters : m_ThreadCriteriaCounters)
+    {
+        for (uint32 l_Type = 0; l_Type < ACHIEVEMENT_CRITERIA_TYPE_TOTAL; ++l_Type)
+        {
+            p_Types[l_Type].Events    += l_Counters->TypeEvents[l_Type].load(std::memory_order_relaxed);
+            p_Types[l_Type].Evaluated += l_Counters->TypeEvaluated[l_Type].load(std::memory_order_relaxed);
+            p_Types[l_Type].Skipped   += l_Counters->TypeSkipped[l_Type].load(std::memory_order_relaxed);
+        }
+
+        p_Queue.Queued    += l_Counters->Queued.load(std::memory_order_relaxed);
+        p_Queue.Coalesced += l_Counters->Coalesced.load(std::memory_order_relaxed);
+        p_Queue.Processed += l_Counters->Processed.load(std::memory_order_relaxed);
+    }
+}
+
+void AchievementGlobalMgr::StartCriteriaEventsRecording()
+{
+    std::lock_guard<std::mutex> l_Guard(m_RecordedCriteriaEventsLock);
+    m_RecordedCriteriaEvents.clear();
+    m_RecordCriteriaEvents = true;
+}
+
+void AchievementGlobalMgr::RecordCriteriaEvent(AchievementCriteriaTypes p_Type, uint64 p_MiscValue1, uint64 p_MiscValue2, uint64 p_MiscValue3)
+{
+    /// Bound the memory of a forgotten recording
+    static size_t const s_MaxRecordedEvents = 2000000;
+
+    std::lock_guard<std::mutex> l_Guard(m_RecordedCriteriaEventsLock);
+    if (m_RecordedCriteriaEvents.size() >= s_MaxRecordedEvents)
+    {
+        m_RecordCriteriaEvents = false;
+        return;
+    }
+
+    AchievementCriteriaEvent l_Event;
+    l_Event.Type       = p_Type;
+    l_Event.MiscValue1 = p_MiscValue1;
+    l_Event.MiscValue2 = p_MiscValue2;
+    l_Event.MiscValue3 = p_MiscValue3;
+    m_RecordedCriteriaEvents.push_back(l_Event);
+}
+
+std::vector<AchievementCriteriaEvent> AchievementGlobalMgr::GetRecordedCriteriaEvents()
+{
+    std::lock_guard<std::mutex> l_Guard(m_RecordedCriteriaEventsLock);
+    return m_RecordedCriteriaEvents;
+}
+
 //==========================================================
 AchievementEntry const* AchievementGlobalMgr::_GetAchievementEntryByCriteriaTree(CriteriaTreeEntry const* p_Criteria) const
 {
@@ -3854,6 +4065,9 @@ void AchievementGlobalMgr::LoadAchievementCriteriaList()
 
         m_AchievementCriteriasByType[l_Criteria->Type].push_back(l_Criteria);
 
+        if (IsAssetIndexedCriteriaType(AchievementCriteriaTypes(l_Criteria->Type)))
+            m_AchievementCriteriasByAsset[l_Criteria->Type][l_Criteria->raw.criteriaArg1].push_back(l_Criteria);
+
         if (l_Criteria->StartTimer)
             m_AchievementCriteriasByTimedType[l_Criteria->StartEvent].push_back(l_Criteria);
 
@@ -4214,31 +4428,92 @@ bool AchievementMgr<T>::RequiresScript(CriteriaEntry const* p_Criteria)
     }
 }
 
-void AchievementGlobalMgr::PrepareCriteriaUpdateTaskThread()
+void AchievementGlobalMgr::AddCriteriaEvent(AchievementCriteriaEventQueue& p_Queue, AchievementCriteriaQueuedEvent const& p_Event)
 {
-    AchievementCriteriaUpdateTask l_Task;
-    for (auto l_Iterator = m_LockedPlayersAchievementCriteriaTask.begin(); l_Iterator != m_LockedPlayersAchievementCriteriaTask.end(); l_Iterator++)
+    /// Only look at the latest events, repeated events of a tick are usually close
+    static size_t const s_MaxCoalesceLookup = 16;
+
+    AchievementCriteriaThreadCounters* l_Counters = GetThreadCriteriaCounters();
+    AchievementCriteriaThreadCounters::Add(l_Counters->Queued, 1);
+
+    AchievementCriteriaTypes l_Type = AchievementCriteriaTypes(p_Event.Type);
+
+    bool l_Accumulate = false;
+    switch (l_Type)
     {
-        while ((*l_Iterator).second.next(l_Task))
-            m_PlayersAchievementCriteriaTask[(*l_Iterator).first].push(l_Task);
+        /// Progress += miscValue2, the criteria don't depend on the unit (checked below)
+        case ACHIEVEMENT_CRITERIA_TYPE_KILL_CREATURE:
+        case ACHIEVEMENT_CRITERIA_TYPE_OWN_ITEM:
+        case ACHIEVEMENT_CRITERIA_TYPE_LOOT_ITEM:
+        case ACHIEVEMENT_CRITERIA_TYPE_CURRENCY:
+            l_Accumulate = true;
+            break;
+        /// Progress is read from the player state, a second identical event changes nothing
+        case ACHIEVEMENT_CRITERIA_TYPE_REACH_LEVEL:
+        case ACHIEVEMENT_CRITERIA_TYPE_REACH_SKILL_LEVEL:
+        case ACHIEVEMENT_CRITERIA_TYPE_LEARN_SKILL_LEVEL:
+        case ACHIEVEMENT_CRITERIA_TYPE_COMPLETE_QUEST_COUNT:
+        case ACHIEVEMENT_CRITERIA_TYPE_BUY_BANK_SLOT:
+        case ACHIEVEMENT_CRITERIA_TYPE_GAIN_REPUTATION:
+        case ACHIEVEMENT_CRITERIA_TYPE_GAIN_EXALTED_REPUTATION:
+        case ACHIEVEMENT_CRITERIA_TYPE_GAIN_REVERED_REPUTATION:
+        case ACHIEVEMENT_CRITERIA_TYPE_GAIN_HONORED_REPUTATION:
+        case ACHIEVEMENT_CRITERIA_TYPE_KNOWN_FACTIONS:
+        case ACHIEVEMENT_CRITERIA_TYPE_LEARN_SKILLLINE_SPELLS:
+        case ACHIEVEMENT_CRITERIA_TYPE_LEARN_SKILL_LINE:
+        case ACHIEVEMENT_CRITERIA_TYPE_EARN_HONORABLE_KILL:
+        case ACHIEVEMENT_CRITERIA_TYPE_HIGHEST_GOLD_VALUE_OWNED:
+            break;
+        default:
+            p_Queue.push_back(p_Event);
+            return;
     }
-}
 
-AchievementCriteriaUpdateRequest::AchievementCriteriaUpdateRequest(MapUpdater* p_Updater, AchievementCriteriaTaskQueue p_TaskQueue)
-: MapUpdaterTask(p_Updater), m_CriteriaUpdateTasks(p_TaskQueue)
-{
+    size_t l_Lookup = std::min(p_Queue.size(), s_MaxCoalesceLookup);
+    for (size_t l_I = p_Queue.size(); l_I > p_Queue.size() - l_Lookup; --l_I)
+    {
+        AchievementCriteriaQueuedEvent& l_Queued = p_Queue[l_I - 1];
+        if (l_Queued.Type != p_Event.Type || l_Queued.MiscValue1 != p_Event.MiscValue1 || l_Queued.MiscValue3 != p_Event.MiscValue3
+            || l_Queued.LoginCheck != p_Event.LoginCheck || l_Queued.PlayerOnly != p_Event.PlayerOnly)
+            continue;
 
-}
+        if (!l_Accumulate)
+        {
+            if (l_Queued.MiscValue2 != p_Event.MiscValue2 || l_Queued.UnitGUID != p_Event.UnitGUID)
+                continue;
 
-void AchievementCriteriaUpdateRequest::call()
-{
-    AchievementCriteriaUpdateTask l_Task;
-    while (!m_CriteriaUpdateTasks.empty())
-    {
-        l_Task = m_CriteriaUpdateTasks.front();
-        l_Task.Task(l_Task.PlayerGUID, l_Task.UnitGUID);
-        m_CriteriaUpdateTasks.pop();
+            AchievementCriteriaThreadCounters::Add(l_Counters->Coalesced, 1);
+            return;
+        }
+
+        /// Events without asset are login checks, and criteria data / modifier trees can check the unit of each event
+        if (!p_Event.MiscValue1 || p_Event.LoginCheck)
+            break;
+
+        /// Currency losses are rejected by the requirements, keep them apart
+        if (int64(l_Queued.MiscValue2) <= 0 || int64(p_Event.MiscValue2) <= 0)
+            break;
+
+        if (l_Queued.UnitGUID != p_Event.UnitGUID)
+        {
+            bool l_UnitDependent = false;
+            for (CriteriaEntry const* l_Criteria : GetAchievementCriteriaByTypeAndAsset(l_Type, p_Event.MiscValue1))
+            {
+                if (l_Criteria->ModifierTreeId || GetCriteriaDataSet(l_Criteria))
+                {
+                    l_UnitDependent = true;
+                    break;
+                }
+            }
+
+            if (l_UnitDependent)
+                break;
+        }
+
+        l_Queued.MiscValue2 += p_Event.MiscValue2;
+        AchievementCriteriaThreadCounters::Add(l_Counters->Coalesced, 1);
+        return;
     }
 
-    UpdateFinished();
+    p_Queue.push_back(p_Event);
 }
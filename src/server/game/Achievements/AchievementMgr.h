@@ -16,6 +16,9 @@
 #include "DBCStores.h"
 #include "MapUpdater.h"
 
+#include <atomic>
+#include <mutex>
+
 typedef std::vector<CriteriaEntry const*>            AchievementCriteriaEntryList;
 typedef std::vector<AchievementEntry const*>         AchievementEntryList;
 typedef std::vector<CriteriaTreeEntry const*>        AchievementCriteriaTreeList;
@@ -597,6 +600,27 @@ enum ProgressType
     PROGRESS_HIGHEST
 };
 
+typedef std::unordered_map<uint32 /*asset*/, AchievementCriteriaEntryList> AchievementCriteriaByAsset;
+
+/// Criteria update event captured by .debug bench criteria record
+struct AchievementCriteriaEvent
+{
+    uint32 Type;
+    uint64 MiscValue1;
+    uint64 MiscValue2;
+    uint64 MiscValue3;
+};
+
+/// Per criteria type dispatch counters, see .debug stats criteria
+struct AchievementCriteriaTypeCounters
+{
+    AchievementCriteriaTypeCounters() : Events(0), Evaluated(0), Skipped(0) { }
+
+    uint64 Events;
+    uint64 Evaluated;   ///< Criteria going through CanUpdateCriteria
+    uint64 Skipped;     ///< Criteria of the type not evaluated thanks to the asset index
+};
+
 template<class T>
 class AchievementMgr
 {
@@ -635,6 +659,9 @@ class AchievementMgr
         void SetCriteriaProgress(CriteriaEntry const* entry, uint64 changeValue, Player* referencePlayer, ProgressType ptype = PROGRESS_SET);
         void SetCompletedAchievementsIfNeeded(CriteriaEntry const* p_Criteria, Player* p_RefPlayer, bool p_LoginCheck = false);
 
+        /// Evaluate recorded events without updating any progress, returns the number of criteria evaluated
+        uint64 ReplayCriteriaEvents(std::vector<AchievementCriteriaEvent> const& p_Events, Player* p_ReferencePlayer, bool p_UseAssetIndex);
+
     private:
         void SendAchievementEarned(AchievementEntry const* achievement) const;
         void SendCriteriaUpdate(CriteriaEntry const* p_Entry, CriteriaProgress const* p_Progress, uint32 p_TimeElapsed, bool p_TimedCompleted, bool p_UpdateAccount) const;
@@ -666,24 +693,54 @@ class AchievementMgr
         bool m_NeedDBSync;
 };
 
-struct AchievementCriteriaUpdateTask
+/// Criteria update waiting in its player queue, processed by the map of the player (see Player::ProcessAchievementCriteriaEvents)
+struct AchievementCriteriaQueuedEvent
 {
-    uint64 PlayerGUID;
     uint64 UnitGUID;
-    std::function<void(uint64, uint64)> Task;
+    uint64 MiscValue1;
+    uint64 MiscValue2;
+    uint64 MiscValue3;
+    uint32 Type;
+    bool   LoginCheck;
+    bool   PlayerOnly;  ///< Don't forward the update to the guild
 };
 
-using LockedAchievementCriteriaTaskQueue   = ACE_Based::LockedQueue<AchievementCriteriaUpdateTask, ACE_Thread_Mutex>;
-using LockedPlayersAchievementCriteriaTask = ACE_Based::LockedMap<uint64, LockedAchievementCriteriaTaskQueue>;
+typedef std::vector<AchievementCriteriaQueuedEvent> AchievementCriteriaEventQueue;
 
-using AchievementCriteriaTaskQueue   = std::queue<AchievementCriteriaUpdateTask>;
-using PlayersAchievementCriteriaTask = std::map<uint32, AchievementCriteriaTaskQueue>;
+/// Player criteria queues counters, see .debug stats criteria
+struct AchievementCriteriaQueueCounters
+{
+    AchievementCriteriaQueueCounters() : Queued(0), Coalesced(0), Processed(0) { }
+
+    uint64 Queued;
+    uint64 Coalesced;   ///< Merged in an event already waiting
+    uint64 Processed;
+};
+
+/// Criteria counters of one thread. Only their thread writes them, so they are bumped with a plain
+/// load and store instead of a locked add, the atomics only make the reads of GetCriteriaCounters safe
+struct AchievementCriteriaThreadCounters
+{
+    AchievementCriteriaThreadCounters();
+
+    std::atomic<uint64> TypeEvents[ACHIEVEMENT_CRITERIA_TYPE_TOTAL];
+    std::atomic<uint64> TypeEvaluated[ACHIEVEMENT_CRITERIA_TYPE_TOTAL];
+    std::atomic<uint64> TypeSkipped[ACHIEVEMENT_CRITERIA_TYPE_TOTAL];
+    std::atomic<uint64> Queued;
+    std::atomic<uint64> Coalesced;
+    std::atomic<uint64> Processed;
+
+    static void Add(std::atomic<uint64>& p_Counter, uint64 p_Value)
+    {
+        p_Counter.store(p_Counter.load(std::memory_order_relaxed) + p_Value, std::memory_order_relaxed);
+    }
+};
 
 class AchievementGlobalMgr
 {
         friend class ACE_Singleton<AchievementGlobalMgr, ACE_Null_Mutex>;
-        AchievementGlobalMgr() {}
-        ~AchievementGlobalMgr() {}
+        AchievementGlobalMgr() : m_RecordCriteriaEvents(false) {}
+        ~AchievementGlobalMgr();
 
     public:
         static char const* GetCriteriaTypeString(uint32 type);
@@ -693,6 +750,30 @@ class AchievementGlobalMgr
             return m_AchievementCriteriasByType[type];
         }
 
+        /// Types whose criteria all require p_MiscValue1 to be their asset when p_MiscValue1 is set
+        static bool IsAssetIndexedCriteriaType(AchievementCriteriaTypes p_Type);
+
+        /// Only the criteria which can match p_MiscValue1, all the criteria of the type if it can't be filtered
+        AchievementCriteriaEntryList const& GetAchievementCriteriaByTypeAndAsset(AchievementCriteriaTypes p_Type, uint64 p_MiscValue1) const;
+
+        void AddCriteriaTypeCounters(AchievementCriteriaTypes p_Type, uint32 p_Evaluated, uint32 p_Skipped)
+        {
+            AchievementCriteriaThreadCounters* l_Counters = GetThreadCriteriaCounters();
+            AchievementCriteriaThreadCounters::Add(l_Counters->TypeEvents[p_Type], 1);
+            AchievementCriteriaThreadCounters::Add(l_Counters->TypeEvaluated[p_Type], p_Evaluated);
+            AchievementCriteriaThreadCounters::Add(l_Counters->TypeSkipped[p_Type], p_Skipped);
+        }
+
+        /// Sum of the counters of all the threads, p_Types must hold ACHIEVEMENT_CRITERIA_TYPE_TOTAL entries
+        void GetCriteriaCounters(AchievementCriteriaTypeCounters* p_Types, AchievementCriteriaQueueCounters& p_Queue);
+
+        /// Criteria events recording, for replay benchmarks
+        bool IsRecordingCriteriaEvents() const { return m_RecordCriteriaEvents.load(std::memory_order_relaxed); }
+        void StartCriteriaEventsRecording();
+        void StopCriteriaEventsRecording() { m_RecordCriteriaEvents = false; }
+        void RecordCriteriaEvent(AchievementCriteriaTypes p_Type, uint64 p_MiscValue1, uint64 p_MiscValue2, uint64 p_MiscValue3);
+        std::vector<AchievementCriteriaEvent> GetRecordedCriteriaEvents();
+
         AchievementCriteriaEntryList const& GetTimedAchievementCriteriaByType(AchievementCriteriaTimedTypes type) const
         {
             return m_AchievementCriteriasByTimedType[type];
@@ -795,28 +876,27 @@ class AchievementGlobalMgr
         AchievementEntry const* GetAchievement(uint32 achievementId) const;
         CriteriaEntry const* GetAchievementCriteria(uint32 achievementId) const;
 
-        void PrepareCriteriaUpdateTaskThread();
-
-        void AddCriteriaUpdateTask(AchievementCriteriaUpdateTask const& p_Task)
-        {
-            m_LockedPlayersAchievementCriteriaTask[p_Task.PlayerGUID].add(p_Task);
-        }
-
-        PlayersAchievementCriteriaTask const& GetPlayersCriteriaTask() const
-        {
-            return m_PlayersAchievementCriteriaTask;
-        }
+        /// Append p_Event to p_Queue, merging it into a waiting event when the result is the same
+        void AddCriteriaEvent(AchievementCriteriaEventQueue& p_Queue, AchievementCriteriaQueuedEvent const& p_Event);
 
-        void ClearPlayersCriteriaTask()
-        {
-            m_PlayersAchievementCriteriaTask.clear();
-        }
+        void AddProcessedCriteriaEvents(uint32 p_Count) { AchievementCriteriaThreadCounters::Add(GetThreadCriteriaCounters()->Processed, p_Count); }
 
     private:
         AchievementCriteriaDataMap m_criteriaDataMap;
 
         // store achievement criterias by type to speed up lookup
         AchievementCriteriaEntryList m_AchievementCriteriasByType[ACHIEVEMENT_CRITERIA_TYPE_TOTAL];
+        AchievementCriteriaByAsset m_AchievementCriteriasByAsset[ACHIEVEMENT_CRITERIA_TYPE_TOTAL];
+
+        /// Counters of the calling thread, registered on its first criteria update
+        AchievementCriteriaThreadCounters* GetThreadCriteriaCounters();
+
+        std::mutex m_ThreadCriteriaCountersLock;
+        std::vector<AchievementCriteriaThreadCounters*> m_ThreadCriteriaCounters;
+
+        std::atomic<bool> m_RecordCriteriaEvents;
+        std::mutex m_RecordedCriteriaEventsLock;
+        std::vector<AchievementCriteriaEvent> m_RecordedCriteriaEvents;
 
         AchievementCriteriaEntryList m_AchievementCriteriasByTimedType[ACHIEVEMENT_TIMED_TYPE_MAX];
 
@@ -834,23 +914,8 @@ class AchievementGlobalMgr
 
         AchievementRewards m_achievementRewards;
         AchievementRewardLocales m_achievementRewardLocales;
-
-        LockedPlayersAchievementCriteriaTask m_LockedPlayersAchievementCriteriaTask;  ///< All criteria update task are first storing here
-        PlayersAchievementCriteriaTask       m_PlayersAchievementCriteriaTask;        ///< Before thread process, all task stored will be move here
 };
 
 #define sAchievementMgr ACE_Singleton<AchievementGlobalMgr, ACE_Null_Mutex>::instance()
 
-class MapUpdater;
-class AchievementCriteriaUpdateRequest : public MapUpdaterTask
-{
-    public:
-        AchievementCriteriaUpdateRequest(MapUpdater* p_Updater, AchievementCriteriaTaskQueue p_TaskQueue);
-        virtual void call() override;
-
-    private:
-        AchievementCriteriaTaskQueue m_CriteriaUpdateTasks;
-
-};
-
 #endif
@@ -11,6 +11,8 @@
 #include "Group.h"
 #include "BattlegroundPacketFactory.hpp"
 
+#include <chrono>
+
 #ifdef CROSS
 #include <iostream>
 #include <fstream>
@@ -34,6 +36,10 @@ namespace MS
                 if (p_Group->m_BracketId != p_BracketId)
                     return false;
 
+                /// Cheap check first, the level check looks up every player of the group.
+                if ((p_Group->m_WantedBGs & l_BattlegroundMask) == 0)
+                    return false;
+
                 /// We check if all the players have the good level for entering the battleground.
                 for (auto l_Plrs : p_Group->m_Players)
                 {
@@ -45,7 +51,7 @@ namespace MS
                         return false;
                 }
 
-                return (p_Group->m_WantedBGs & l_BattlegroundMask) != 0;
+                return true;
             }
 
             static bool AreMatching(GroupQueueInfo const* p_A, GroupQueueInfo const* p_B)
@@ -99,9 +105,18 @@ namespace MS
             }
         }
 
+        BattlegroundScheduler::BracketQueue::BracketQueue()
+            : PlayerCount(),
+            WantedPlayers(),
+            Changed(false),
+            LastDecisionTime(0)
+        {
+        }
+
         BattlegroundScheduler::BattlegroundScheduler()
-            : m_QueuedGroups(),
-            m_BattlegroundOccurences()
+            : m_Queues(),
+            m_BattlegroundOccurences(),
+            m_Stats()
         {
             /// Initialize BattlegroundOccurences.
             for (std::size_t l_BracketId = 0; l_BracketId < Brackets::Count; l_BracketId++)
@@ -130,6 +145,11 @@ namespace MS
             }
             p_Group->m_BgTypeId = GetSchedulerType(p_BG->GetTypeID());
 
+            uint32 l_WaitTime = getMSTimeDiff(p_Group->m_JoinTime, getMSTime());
+            m_Stats.InvitedGroups++;
+            m_Stats.WaitTime += l_WaitTime;
+            m_Stats.MaxWaitTime = std::max(m_Stats.MaxWaitTime, l_WaitTime);
+
             /// Move group to invitations mgr and invite them to the battleground.
             sBattlegroundMgr->GetInvitationsMgr().InviteGroupToBG(p_Group, p_BG, p_Team);
         }
@@ -213,7 +233,7 @@ namespace MS
             }
 
             /// Add the GroupQueueInfo in the groups to match.
-            m_QueuedGroups[l_BracketId][l_GroupQueue->GetTeam()].emplace_back(l_GroupQueue);
+            QueueGroup(l_GroupQueue);
 
             return l_GroupQueue;
         }
@@ -263,7 +283,10 @@ namespace MS
             /// Remove player queue info from group queue info.
             auto pitr = l_Group->m_Players.find(p_Guid);
             if (pitr != l_Group->m_Players.end())
+            {
                 l_Group->m_Players.erase(pitr);
+                UpdateAggregates(l_Group, -1);
+            }
 
             /// Remove player queue info.
             if (l_Itr->second.Infos.size() == 1)
@@ -274,7 +297,7 @@ namespace MS
             // remove group queue info if needed
             if (l_Group->m_Players.empty())
             {
-                auto& l_Queue = m_QueuedGroups[l_BracketId][l_Group->GetTeam()];
+                auto& l_Queue = m_Queues[l_BracketId].Groups[l_Group->GetTeam()];
                 auto l_Itr = std::find(std::begin(l_Queue), std::end(l_Queue), l_Group);
 
                 if (std::end(l_Queue) != l_Itr)
@@ -335,21 +358,91 @@ namespace MS
 
         void BattlegroundScheduler::RemoveGroupFromQueues(GroupQueueInfo* p_Group)
         {
-            m_QueuedGroups[p_Group->m_BracketId][p_Group->GetTeam()].remove(p_Group);
+            auto& l_Queue = m_Queues[p_Group->m_BracketId].Groups[p_Group->GetTeam()];
+            auto l_Itr = std::find(std::begin(l_Queue), std::end(l_Queue), p_Group);
+            if (l_Itr != std::end(l_Queue))
+            {
+                l_Queue.erase(l_Itr);
+                UpdateAggregates(p_Group, -int32(p_Group->m_Players.size()));
+            }
 
             for (auto const& l_Itr : p_Group->m_Players)
                 m_QueuedPlayers.erase(l_Itr.first);
         }
 
+        void BattlegroundScheduler::QueueGroup(GroupQueueInfo* p_Group)
+        {
+            auto& l_Queue = m_Queues[p_Group->m_BracketId].Groups[p_Group->GetTeam()];
+
+            /// Groups join in order, so this is nearly always the end of the queue.
+            auto l_Itr = std::end(l_Queue);
+            while (l_Itr != std::begin(l_Queue) && (*std::prev(l_Itr))->m_JoinTime > p_Group->m_JoinTime)
+                --l_Itr;
+
+            l_Queue.insert(l_Itr, p_Group);
+            UpdateAggregates(p_Group, int32(p_Group->m_Players.size()));
+        }
+
+        void BattlegroundScheduler::UpdateAggregates(GroupQueueInfo const* p_Group, int32 p_Players)
+        {
+            BracketQueue& l_Queue = m_Queues[p_Group->m_BracketId];
+            uint32 l_Team = p_Group->GetTeam();
+
+            l_Queue.PlayerCount[l_Team] += p_Players;
+            for (std::size_t i = 0; i < BattlegroundType::Max; i++)
+            {
+                if (p_Group->m_WantedBGs & (1LL << i))
+                    l_Queue.WantedPlayers[l_Team][i] += p_Players;
+            }
+
+            l_Queue.Changed = true;
+        }
+
+        bool BattlegroundScheduler::MayStartBattleground(Bracket::Id p_BracketId) const
+        {
+            BracketQueue const& l_Queue = m_Queues[p_BracketId];
+
+            for (std::size_t i = 0; i < BattlegroundType::Max; i++)
+            {
+                BattlegroundType::Type l_BgType = static_cast<BattlegroundType::Type>(i);
+
+                uint32 l_Alliance = l_Queue.WantedPlayers[TEAM_ALLIANCE][i];
+                uint32 l_Horde    = l_Queue.WantedPlayers[TEAM_HORDE][i];
+                if (!l_Alliance && !l_Horde)
+                    continue;
+
+                if (sBattlegroundMgr->isTesting())
+                    return true;
+
+                /// Same requirements as FindMatches, on the wishes instead of the groups which actually fit.
+                if (BattlegroundType::IsCasualBattleground(l_BgType))
+                {
+                    Battleground* l_Template = sBattlegroundMgr->GetBattlegroundTemplate(l_BgType);
+                    if (l_Template && l_Alliance >= l_Template->GetMinPlayersPerTeam() && l_Horde >= l_Template->GetMinPlayersPerTeam())
+                        return true;
+                }
+                /// Arena groups of both factions may fill both sides, rated groups go to both of them.
+                else if (BattlegroundType::IsArena(l_BgType))
+                {
+                    if (l_Alliance + l_Horde >= uint32(BattlegroundType::GetArenaType(l_BgType)))
+                        return true;
+                }
+                else
+                    return true;
+            }
+
+            return false;
+        }
+
         void BattlegroundScheduler::AllocateGroupsInExistingBattlegrounds(Bracket::Id p_BracketId, std::size_t p_Team, std::vector<std::pair<float, std::size_t>>& p_Avg)
         {
             std::list<GroupQueueInfo*> l_ToRemove;
 
-            if (m_QueuedGroups[p_BracketId][p_Team].empty())
+            if (m_Queues[p_BracketId].Groups[p_Team].empty())
                 return;
 
             /// Insert groups in their categories.
-            for (GroupQueueInfo* l_Group : m_QueuedGroups[p_BracketId][p_Team])
+            for (GroupQueueInfo* l_Group : m_Queues[p_BracketId].Groups[p_Team])
             {
                 /// We first sort the averages and keep track of the indexes.
                 std::sort(std::begin(p_Avg), std::end(p_Avg), [](std::pair<float, std::size_t> const& p_A, std::pair<float, std::size_t> const& p_B)
@@ -421,7 +514,7 @@ namespace MS
             /// Accumulate group sizes.
             for (std::size_t l_Team = TEAM_ALLIANCE; l_Team <= TEAM_HORDE; l_Team++)
             {
-                for (GroupQueueInfo* l_Group : m_QueuedGroups[p_BracketId][l_Team])
+                for (GroupQueueInfo* l_Group : m_Queues[p_BracketId].Groups[l_Team])
                 {
                     /// Check if the group is of the right team.
                     if (l_Group->GetTeam() != l_Team)
@@ -597,7 +690,7 @@ namespace MS
 
             for (std::size_t l_Team = TEAM_ALLIANCE; l_Team <= TEAM_HORDE; l_Team++)
             {
-                for (GroupQueueInfo* l_Group : m_QueuedGroups[l_BracketId][l_Team])
+                for (GroupQueueInfo* l_Group : m_Queues[l_BracketId].Groups[l_Team])
                 {
                     if (l_Group->m_WantedBGs & BattlegroundMasks::AllArenas)
                         continue;
@@ -627,6 +720,10 @@ namespace MS
                 l_BattlegroundDump << l_Map->MapNameLang << " : (first : " << m_BattlegroundOccurences[l_BracketId][i].first << ", second : " << m_BattlegroundOccurences[l_BracketId][i].second << ")" << std::endl;
             }
 
+            l_BattlegroundDump << "Scheduling : " << m_Stats.Passes << " passes, avg " << (m_Stats.Passes ? m_Stats.PassTime / m_Stats.Passes : 0) << " us, max " << m_Stats.MaxPassTime << " us, "
+                << m_Stats.BracketDecisions << " bracket decisions, " << m_Stats.BracketSkips << " skipped" << std::endl;
+            l_BattlegroundDump << "Wait : " << m_Stats.InvitedGroups << " groups invited, avg " << (m_Stats.InvitedGroups ? m_Stats.WaitTime / m_Stats.InvitedGroups : 0) << " ms, max " << m_Stats.MaxWaitTime << " ms" << std::endl;
+
             l_BattlegroundDump << "======================================= " << std::endl;
 
 
@@ -643,8 +740,16 @@ namespace MS
             // Policy: trying to have a ratio of battlegrounds instances equals for each type.
             //////////////////////////////////////////////////////////////////////////////////
 
+            auto l_PassStart = std::chrono::steady_clock::now();
+
             for (std::size_t l_BracketId = 0; l_BracketId < Brackets::Count; l_BracketId++)
             {
+                BracketQueue& l_Queue = m_Queues[l_BracketId];
+
+                /// Nothing to allocate nor to start.
+                if (l_Queue.Groups[TEAM_ALLIANCE].empty() && l_Queue.Groups[TEAM_HORDE].empty())
+                    continue;
+
                 /// We first calculate the average number of players by BGType in order to fill entirely the battlegrounds.
                 std::vector<std::pair<float, std::size_t>> l_AvgHorde;
                 std::vector<std::pair<float, std::size_t>> l_AvgAlliance;
@@ -658,11 +763,14 @@ namespace MS
                     l_AvgAlliance[i] = std::make_pair(0.0f, i);
                 }
 
-                /// Calculating averages.
+                /// Calculating averages, a battleground type no queued group wishes is never picked.
                 for (std::size_t i = 0; i < BattlegroundType::Max; i++)
                 {
                     BattlegroundType::Type l_BgType = static_cast<BattlegroundType::Type>(i);
 
+                    if (!l_Queue.WantedPlayers[TEAM_ALLIANCE][i] && !l_Queue.WantedPlayers[TEAM_HORDE][i])
+                        continue;
+
                     /// We get the battleground template.
                     Battleground* l_Template = sBattlegroundMgr->GetBattlegroundTemplate(l_BgType);
                     if (!l_Template)
@@ -708,20 +816,29 @@ namespace MS
                 AllocateGroupsInExistingBattlegrounds(static_cast<Bracket::Id>(l_BracketId), TEAM_ALLIANCE, l_AvgAlliance);
                 AllocateGroupsInExistingBattlegrounds(static_cast<Bracket::Id>(l_BracketId), TEAM_HORDE, l_AvgHorde);
 
+                /// The same queue gives the same decision, until the time loosens the rated matching.
+                if (!l_Queue.Changed && getMSTimeDiff(l_Queue.LastDecisionTime, getMSTime()) < BATTLEGROUND_SCHEDULER_DECISION_INTERVAL)
+                {
+                    m_Stats.BracketSkips++;
+                    continue;
+                }
+
+                l_Queue.Changed = false;
+                l_Queue.LastDecisionTime = getMSTime();
+
+                if (!MayStartBattleground(static_cast<Bracket::Id>(l_BracketId)))
+                {
+                    m_Stats.BracketSkips++;
+                    continue;
+                }
+
+                m_Stats.BracketDecisions++;
+
                 /// Take a decision on what battleground can start from now.
+                /// Groups are queued in join order, so older groups join the most rapidly.
                 std::vector<float> l_NumPlayersByBGTypes(BattlegroundType::Max * 2);
                 std::vector<std::list<GroupQueueInfo*>> l_PotentialGroups(BattlegroundType::Max * 2);
 
-                /// We sort according to the join time because we want older groups to join the most rapidly.
-                m_QueuedGroups[l_BracketId][TEAM_ALLIANCE].sort([](GroupQueueInfo const* p_G1, GroupQueueInfo const* p_G2)
-                {
-                    return p_G1->m_JoinTime < p_G2->m_JoinTime;
-                });
-                m_QueuedGroups[l_BracketId][TEAM_HORDE].sort([](GroupQueueInfo const* p_G1, GroupQueueInfo const* p_G2)
-                {
-                    return p_G1->m_JoinTime < p_G2->m_JoinTime;
-                });
-
                 std::ostringstream l_BattlegroundDump;
 
                 /// Find the potential battlegrounds.
@@ -800,6 +917,11 @@ namespace MS
                     }
                 }
             }
+
+            uint32 l_PassTime = uint32(std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - l_PassStart).count());
+            m_Stats.Passes++;
+            m_Stats.PassTime += l_PassTime;
+            m_Stats.MaxPassTime = std::max(m_Stats.MaxPassTime, l_PassTime);
         }
 
         bool BattlegroundScheduler::TryCreateBattleground(BattlegroundType::Type p_DecidedBg, std::vector<std::list<GroupQueueInfo*>>& p_PotentialGroups, std::size_t p_BracketId)
@@ -854,7 +976,7 @@ namespace MS
                 /// We sort them according to their MMR.
                 l_Groups.sort([](GroupQueueInfo const* p_A, GroupQueueInfo const* p_B)
                 {
-                    return p_A->m_ArenaMatchmakerRating - p_B->m_ArenaMatchmakerRating;
+                    return p_A->m_ArenaMatchmakerRating < p_B->m_ArenaMatchmakerRating;
                 });
 
                 GroupQueueInfo* l_Previous = nullptr;
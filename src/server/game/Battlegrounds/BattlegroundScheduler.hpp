@@ -11,6 +11,10 @@
 
 # include "Battleground.h"
 
+/// Interval at which a bracket whose queue did not change looks again for a battleground to start,
+/// the rated matching loosens with the wait time and the players may level up in queue
+# define BATTLEGROUND_SCHEDULER_DECISION_INTERVAL 1000
+
 namespace MS
 {
     namespace Battlegrounds
@@ -45,10 +49,36 @@ namespace MS
             };
         }
 
+        /// Cost of the scheduling passes, and wait of the groups until their invitation, since startup.
+        struct SchedulerStats
+        {
+            uint64 Passes;
+            uint64 PassTime;                                                ///< In microseconds
+            uint32 MaxPassTime;                                             ///< In microseconds
+            uint64 BracketDecisions;                                        ///< Brackets in which a pass looked for a battleground to start
+            uint64 BracketSkips;                                            ///< Brackets in which it did not, nothing changed or nothing could start
+            uint64 InvitedGroups;
+            uint64 WaitTime;                                                ///< In milliseconds
+            uint32 MaxWaitTime;                                             ///< In milliseconds
+        };
+
         class BattlegroundScheduler
         {
             using QueuedPlayersMap = ACE_Based::LockedMap<uint64, PlayerQueueInfo>;
 
+            /// Queue of a bracket. The aggregates are maintained as groups join and leave, so a pass knows
+            /// without walking the groups which battlegrounds are wished and whether one of them may start.
+            struct BracketQueue
+            {
+                BracketQueue();
+
+                std::list<GroupQueueInfo*> Groups[2];                       ///< Queued groups of each team, in join order
+                uint32 PlayerCount[2];                                      ///< Queued players of each team
+                uint32 WantedPlayers[2][BattlegroundType::Max];             ///< Queued players of each team wishing each battleground type
+                bool Changed;                                               ///< A group joined or left since the last decision
+                uint32 LastDecisionTime;
+            };
+
         public:
             /// Constructor.
             BattlegroundScheduler();
@@ -106,12 +136,27 @@ namespace MS
             /// Try to create a battleground
             bool TryCreateBattleground(BattlegroundType::Type p_DecidedBg, std::vector<std::list<GroupQueueInfo*>>& p_PotentialGroups, std::size_t p_BracketId);
 
+            /// Cost of the scheduling passes and wait of the groups.
+            SchedulerStats const& GetStats() const { return m_Stats; }
+
+            /// Queued players of a bracket and team.
+            uint32 GetQueuedPlayerCount(std::size_t p_BracketId, std::size_t p_Team) const { return m_Queues[p_BracketId].PlayerCount[p_Team]; }
+
 #ifdef CROSS
             /// Dump all running battlegrounds with queue information (player in bg, invite sent ...etc) in a dump file for debugging purpose
             void DumpBattlegrounds();
 
 #endif /* CROSS */
         private:
+            /// Add the group to the queue of its bracket, after the groups which joined before it.
+            void QueueGroup(GroupQueueInfo* p_Group);
+
+            /// Count p_Players more (or less) players of the group in the aggregates of its bracket.
+            void UpdateAggregates(GroupQueueInfo const* p_Group, int32 p_Players);
+
+            /// Upper bound given by the aggregates: false if no battleground can start with the queued groups of the bracket.
+            bool MayStartBattleground(Bracket::Id p_BracketId) const;
+
             /// Allocates the groups in the existing battlegrounds depending on different criteria and respecting eligibility.
             /// @p_BracketId    : The bracket id.
             /// @p_Team         : The team to look after.
@@ -125,10 +170,11 @@ namespace MS
             void FindPotentialBGs(Bracket::Id p_BracketId, std::vector<float>& p_PotientialBGs, std::vector<std::list<GroupQueueInfo*>>& p_PotentialGroups);
 
         private:
-            std::list<GroupQueueInfo*> m_QueuedGroups[Brackets::Count][2];                                  ///< The queue of groups.
+            BracketQueue m_Queues[Brackets::Count];                                                         ///< The queue of groups.
             std::pair<float, std::size_t> m_BattlegroundOccurences[Brackets::Count][BattlegroundType::Max]; ///< The occurrences of battlegrounds during runtime.
             std::size_t m_TotalOccurences[Brackets::Count];                                                 ///< The total number of occurences during runtime.
             QueuedPlayersMap m_QueuedPlayers;                                                               ///< The queue of players that are in the groups.
+            SchedulerStats m_Stats;
         };
     } ///< namespace Battlegrounds.
 } ///< namespace MS.
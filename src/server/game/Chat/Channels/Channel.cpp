@@ -7,6 +7,7 @@
 ////////////////////////////////////////////////////////////////////////////////
 
 #include <regex>
+#include <chrono>
 
 #include "Channel.h"
 #include "Chat.h"
@@ -233,6 +234,7 @@ void Channel::Join(uint64 p, const char *pass)
 
     m_Lock.acquire();
     m_Players[p] = pinfo;
+    AddMember(p, player);
     m_Lock.release();
 
     MakeYouJoined(&data);
@@ -295,6 +297,7 @@ void Channel::Leave(uint64 p, bool send)
         bool changeowner = m_Players[p].IsOwner();
 
         m_Lock.acquire();
+        RemoveMember(p);
         m_Players.erase(p);
         m_Lock.release();
 
@@ -378,7 +381,11 @@ void Channel::KickOrBan(uint64 good, const char *badname, bool ban)
             if (notify)
                 SendToAll(&data);
 
+            m_Lock.acquire();
+            RemoveMember(bad->GetGUID());
             m_Players.erase(bad->GetGUID());
+            m_Lock.release();
+
             bad->LeftChannel(this);
 
             if (changeowner && m_ownership && !m_Players.empty())
@@ -854,42 +861,173 @@ void Channel::SetOwner(uint64 guid, bool exclaim)
     }
 }
 
-void Channel::SendToAll(WorldPacket* data, uint64 p, uint64 p_SenderGUID)
+void Channel::AddMember(uint64 p_Guid, Player* p_Player)
+{
+    uint32 l_NewIndex = uint32(m_Members.size());
+    m_Players[p_Guid].MemberIndex = l_NewIndex;
+
+    Member l_Member;
+    l_Member.Guid    = p_Guid;
+    l_Member.Session = p_Player ? p_Player->GetSession() : nullptr;
+    m_Members.push_back(l_Member);
+
+    /// Ignores in both directions between the new member and the others
+    PlayerSocial* l_Social = p_Player ? p_Player->GetSocial() : nullptr;
+    if (l_Social && !l_Social->GetNumberOfSocialsWithFlag(SOCIAL_FLAG_IGNORED))
+        l_Social = nullptr;
+
+    for (uint32 l_Index = 0; l_Index < l_NewIndex; ++l_Index)
+    {
+        Member const& l_Other = m_Members[l_Index];
+
+        Player* l_OtherPlayer = l_Other.Session ? l_Other.Session->GetPlayer() : nullptr;
+        if (l_OtherPlayer && l_OtherPlayer->GetSocial() && l_OtherPlayer->GetSocial()->HasIgnore(GUID_LOPART(p_Guid)))
+            SetIgnoreBit(p_Guid, l_Index, true);
+
+        if (l_Social && l_Social->HasIgnore(GUID_LOPART(l_Other.Guid)))
+            SetIgnoreBit(l_Other.Guid, l_NewIndex, true);
+    }
+}
+
+void Channel::RemoveMember(uint64 p_Guid)
+{
+    PlayerList::const_iterator l_Itr = m_Players.find(p_Guid);
+    if (l_Itr == m_Players.end())
+        return;
+
+    uint32 l_Index = l_Itr->second.MemberIndex;
+    if (l_Index >= m_Members.size() || m_Members[l_Index].Guid != p_Guid)
+        return;
+
+    uint32 l_Last = uint32(m_Members.size() - 1);
+
+    /// The last member takes the free index, its ignore bits follow
+    if (l_Index != l_Last)
+    {
+        m_Members[l_Index] = m_Members[l_Last];
+        m_Players[m_Members[l_Index].Guid].MemberIndex = l_Index;
+    }
+
+    m_Members.pop_back();
+    m_IgnoredBy.erase(p_Guid);
+
+    for (IgnoreBitmaps::iterator l_Bitmap = m_IgnoredBy.begin(); l_Bitmap != m_IgnoredBy.end();)
+    {
+        std::vector<uint64>& l_Bits = l_Bitmap->second;
+
+        bool l_LastIgnores = (l_Last / 64) < l_Bits.size() && ((l_Bits[l_Last / 64] >> (l_Last % 64)) & 1);
+        if (l_LastIgnores)
+            l_Bits[l_Last / 64] &= ~(uint64(1) << (l_Last % 64));
+
+        if (l_Index != l_Last && (l_Index / 64) < l_Bits.size())
+            l_Bits[l_Index / 64] &= ~(uint64(1) << (l_Index % 64));
+
+        if (l_Index != l_Last && l_LastIgnores)
+            l_Bits[l_Index / 64] |= uint64(1) << (l_Index % 64);
+
+        if (std::all_of(l_Bits.begin(), l_Bits.end(), [](uint64 p_Word) { return p_Word == 0; }))
+            l_Bitmap = m_IgnoredBy.erase(l_Bitmap);
+        else
+            ++l_Bitmap;
+    }
+}
+
+void Channel::SetIgnoreBit(uint64 p_Sender, uint32 p_MemberIndex, bool p_Ignored)
+{
+    if (!p_Ignored)
+    {
+        IgnoreBitmaps::iterator l_Itr = m_IgnoredBy.find(p_Sender);
+        if (l_Itr != m_IgnoredBy.end() && (p_MemberIndex / 64) < l_Itr->second.size())
+            l_Itr->second[p_MemberIndex / 64] &= ~(uint64(1) << (p_MemberIndex % 64));
+        return;
+    }
+
+    std::vector<uint64>& l_Bits = m_IgnoredBy[p_Sender];
+    if (l_Bits.size() <= p_MemberIndex / 64)
+        l_Bits.resize(p_MemberIndex / 64 + 1, 0);
+
+    l_Bits[p_MemberIndex / 64] |= uint64(1) << (p_MemberIndex % 64);
+}
+
+void Channel::UpdateIgnore(uint64 p_Member, uint64 p_Ignored, bool p_Ignore)
 {
     m_Lock.acquire();
-    for (PlayerList::const_iterator i = m_Players.begin(); i != m_Players.end(); ++i)
+
+    PlayerList::const_iterator l_Itr = m_Players.find(p_Member);
+    if (l_Itr != m_Players.end() && IsOn(p_Ignored))
+        SetIgnoreBit(p_Ignored, l_Itr->second.MemberIndex, p_Ignore);
+
+    m_Lock.release();
+}
+
+void Channel::SendToAll(WorldPacket* data, uint64 p, uint64 /*p_SenderGUID*/)
+{
+    std::chrono::steady_clock::time_point l_Start = std::chrono::steady_clock::now();
+
+    m_Lock.acquire();
+
+    /// Members ignoring the sender, precomputed at join and ignore list changes
+    std::vector<uint64> const* l_IgnoredBy = nullptr;
+    if (p)
     {
-        Player* player = ObjectAccessor::FindPlayer(i->first);
-        if (player)
+        IgnoreBitmaps::const_iterator l_Itr = m_IgnoredBy.find(p);
+        if (l_Itr != m_IgnoredBy.end())
+            l_IgnoredBy = &l_Itr->second;
+    }
+
+    uint32 l_Deliveries = 0;
+    uint32 l_Ignored    = 0;
+
+    for (uint32 l_Index = 0; l_Index < m_Members.size(); ++l_Index)
+    {
+        WorldSession* l_Session = m_Members[l_Index].Session;
+        if (!l_Session || !l_Session->GetPlayer())
+            continue;
+
+        if (l_IgnoredBy && (l_Index / 64) < l_IgnoredBy->size() && (((*l_IgnoredBy)[l_Index / 64] >> (l_Index % 64)) & 1))
         {
-#ifndef CROSS
-            if (!p || !player->GetSocial()->HasIgnore(GUID_LOPART(p)))
-            {
-                if (IsWorld() || IsConstant())
-                    player->GetSession()->SendPacket(data);
-                else if (!(IsWorld() || IsConstant()))
-                    player->GetSession()->SendPacket(data);
-            }
-#else /* CROSS */
-            if (!p || !player->GetSocial() || !player->GetSocial()->HasIgnore(GUID_LOPART(p)))
-                player->GetSession()->SendPacket(data);
-#endif /* CROSS */
+            ++l_Ignored;
+            continue;
         }
+
+        /// Same packet for all the members
+        l_Session->SendPacket(data);
+        ++l_Deliveries;
     }
+
+    uint32 l_FanOutTime = uint32(std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - l_Start).count());
+    uint32 l_Now = getMSTime();
+
+    /// Single writer under m_Lock, the atomics only make the reads of .debug stats channels safe
+    m_Stats.Messages.fetch_add(1, std::memory_order_relaxed);
+    m_Stats.Deliveries.fetch_add(l_Deliveries, std::memory_order_relaxed);
+    m_Stats.Ignored.fetch_add(l_Ignored, std::memory_order_relaxed);
+    m_Stats.LastFanOutTime.store(l_FanOutTime, std::memory_order_relaxed);
+    m_Stats.TotalFanOutTime.fetch_add(l_FanOutTime, std::memory_order_relaxed);
+    if (l_FanOutTime > m_Stats.MaxFanOutTime.load(std::memory_order_relaxed))
+        m_Stats.MaxFanOutTime.store(l_FanOutTime, std::memory_order_relaxed);
+
+    uint32 l_WindowMessages = m_Stats.WindowMessages.load(std::memory_order_relaxed) + 1;
+    uint32 l_WindowTime     = getMSTimeDiff(m_Stats.WindowStart.load(std::memory_order_relaxed), l_Now);
+    if (l_WindowTime >= IN_MILLISECONDS)
+    {
+        m_Stats.MessagesPerSecond.store(l_WindowMessages * IN_MILLISECONDS / l_WindowTime, std::memory_order_relaxed);
+        m_Stats.WindowStart.store(l_Now, std::memory_order_relaxed);
+        l_WindowMessages = 0;
+    }
+
+    m_Stats.WindowMessages.store(l_WindowMessages, std::memory_order_relaxed);
+
     m_Lock.release();
 }
 
 void Channel::SendToAllButOne(WorldPacket* data, uint64 who)
 {
     m_Lock.acquire();
-    for (PlayerList::const_iterator i = m_Players.begin(); i != m_Players.end(); ++i)
+    for (Member const& l_Member : m_Members)
     {
-        if (i->first != who)
-        {
-            Player* player = ObjectAccessor::FindPlayer(i->first);
-            if (player)
-                player->GetSession()->SendPacket(data);
-        }
+        if (l_Member.Guid != who && l_Member.Session && l_Member.Session->GetPlayer())
+            l_Member.Session->SendPacket(data);
     }
     m_Lock.release();
 }
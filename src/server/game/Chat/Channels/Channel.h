@@ -16,6 +16,8 @@
 #include "WorldPacket.h"
 #include "LockedMap.h"
 
+#include <atomic>
+
 enum ChatNotify
 {
     CHAT_JOINED_NOTICE                = 0x00,           //+ "%s joined channel.";
@@ -107,6 +109,24 @@ enum ChannelMemberFlags
 };
 
 class Player;
+class WorldSession;
+
+/// Fan-out counters of a channel, written by the sender holding the channel lock, read without it by .debug stats channels
+struct ChannelStats
+{
+    ChannelStats() : Messages(0), Deliveries(0), Ignored(0), LastFanOutTime(0), MaxFanOutTime(0), TotalFanOutTime(0),
+        WindowStart(0), WindowMessages(0), MessagesPerSecond(0) { }
+
+    std::atomic<uint64> Messages;           ///< Packets sent to all the members
+    std::atomic<uint64> Deliveries;         ///< Sessions the packets were sent to
+    std::atomic<uint64> Ignored;            ///< Members skipped by the ignore bitmaps
+    std::atomic<uint32> LastFanOutTime;     ///< In microseconds
+    std::atomic<uint32> MaxFanOutTime;
+    std::atomic<uint64> TotalFanOutTime;
+    std::atomic<uint32> WindowStart;
+    std::atomic<uint32> WindowMessages;
+    std::atomic<uint32> MessagesPerSecond;  ///< Over the last complete second
+};
 
 class Channel
 {
@@ -115,9 +135,10 @@ class Channel
         uint64 player;
         uint8 flags;
         uint32 LocaleFilter;
+        uint32 MemberIndex;         ///< Index in m_Members
 
         PlayerInfo()
-            : LocaleFilter(0xFFFFFFFF)
+            : LocaleFilter(0xFFFFFFFF), MemberIndex(0)
         {
 
         }
@@ -144,9 +165,22 @@ class Channel
         }
     };
 
+    /// Member as seen by the fan-out, the session stays valid until the player leaves (Player::CleanupChannels at logout and on cross removal)
+    struct Member
+    {
+        uint64 Guid;
+        WorldSession* Session;
+    };
+
+    /// Sender guid -> bit per member index, set when that member ignores the sender
+    typedef std::unordered_map<uint64, std::vector<uint64>> IgnoreBitmaps;
+
     typedef     ACE_Based::LockedMap<uint64, PlayerInfo> PlayerList;
     PlayerList  m_Players;
     mutable ACE_Thread_Mutex m_Lock;
+    std::vector<Member> m_Members;      ///< Guarded by m_Lock
+    IgnoreBitmaps m_IgnoredBy;          ///< Guarded by m_Lock
+    ChannelStats m_Stats;               ///< Written under m_Lock
     typedef     std::set<uint64> BannedList;
     BannedList  banned;
     bool        m_announce;
@@ -198,6 +232,11 @@ class Channel
         void MakeVoiceOn(WorldPacket* data, uint64 guid);                       //+ 0x22
         void MakeVoiceOff(WorldPacket* data, uint64 guid);                      //+ 0x23
 
+        /// Members handles and ignore bitmaps, m_Lock must be held
+        void AddMember(uint64 p_Guid, Player* p_Player);
+        void RemoveMember(uint64 p_Guid);
+        void SetIgnoreBit(uint64 p_Sender, uint32 p_MemberIndex, bool p_Ignored);
+
         void SendToAll(WorldPacket* data, uint64 p = 0, uint64 p_SenderGUID = 0);
         void SendToAllButOne(WorldPacket* data, uint64 who);
         void SendToOne(WorldPacket* data, uint64 who);
@@ -289,6 +328,11 @@ class Channel
         void SetOwnership(bool ownership) { m_ownership = ownership; };
         static void CleanOldChannelsInDB();
 
+        /// A member added or removed p_Ignored from its ignore list
+        void UpdateIgnore(uint64 p_Member, uint64 p_Ignored, bool p_Ignore);
+
+        ChannelStats const& GetStats() const { return m_Stats; }
+
         /// Update world chat locale filtering for a specific player
         /// @p_Player : Player instance to update
         void UpdateChatLocaleFiltering(Player* p_Player);
@@ -90,6 +90,13 @@ void ChannelMgr::LeftChannel(std::string const& name)
     }
 }
 
+void ChannelMgr::VisitChannels(std::function<void(Channel const*)> const& p_Visitor) const
+{
+    ChannelMap::ReadGuard l_Guard(channels.GetLock());
+    for (auto const& l_Itr : const_cast<ChannelMap&>(channels).getSource())
+        p_Visitor(l_Itr.second);
+}
+
 void ChannelMgr::MakeNotOnPacket(WorldPacket* data, std::string name)
 {
     data->Initialize(SMSG_CHANNEL_NOTIFY, (1+10));  // we guess size
@@ -12,6 +12,8 @@
 #include "Channel.h"
 #include "World.h"
 
+#include <functional>
+
 class ChannelMgr
 {
     public:
@@ -23,6 +25,9 @@ class ChannelMgr
         Channel* GetJoinChannel(std::string name, uint32 channel_id);
         Channel* GetChannel(std::string name, Player* p, bool pkt = true);
         void LeftChannel(std::string const& name);
+
+        /// The channels can't be deleted while they are visited
+        void VisitChannels(std::function<void(Channel const*)> const& p_Visitor) const;
     private:
         ChannelMap channels;
         void MakeNotOnPacket(WorldPacket* data, std::string name);
@@ -14,9 +14,15 @@
 LexicsCutter::LexicsCutter()
 {
     InvalidChars = "~`!@#$%^&*()-_+=[{]}|\\;:'\",<.>/?1234567890";
+
+    IgnoreMiddleSpaces  = true;
+    IgnoreLetterRepeat  = true;
+    CheckLetterContains = false;
+
+    WordStartNode = 0;
 }
 
-bool LexicsCutter::ReadUTF8(std::string& in, std::string& out, unsigned int& pos)
+bool LexicsCutter::ReadUTF8(std::string const& in, std::string& out, unsigned int& pos)
 {
     if (pos >= in.length()) return false;
 
@@ -33,6 +39,28 @@ bool LexicsCutter::ReadUTF8(std::string& in, std::string& out, unsigned int& pos
     return true;
 }
 
+bool LexicsCutter::ReadCodePoint(std::string const& p_In, uint32& p_CodePoint, unsigned int& p_Pos)
+{
+    if (p_Pos >= p_In.length())
+        return false;
+
+    unsigned char l_Lead = p_In[p_Pos++];
+    int l_ToRead = trailingBytesForUTF8[l_Lead];
+
+    /// Malformed sequences are read byte per byte
+    if (!l_ToRead || l_ToRead > 3 || p_Pos + l_ToRead > p_In.length())
+    {
+        p_CodePoint = l_Lead;
+        return true;
+    }
+
+    p_CodePoint = l_Lead & (0x3F >> l_ToRead);
+    while (l_ToRead-- > 0)
+        p_CodePoint = (p_CodePoint << 6) | (uint8(p_In[p_Pos++]) & 0x3F);
+
+    return true;
+}
+
 std::string LexicsCutter::trim(std::string& s, const std::string& drop)
 {
     std::string r = s.erase(s.find_last_not_of(drop) + 1);
@@ -96,16 +124,58 @@ bool LexicsCutter::ReadLetterAnalogs(std::string& FileName)
                 av.push_back(lanalog);
             }
 
-            // store vector in hash map
-            AnalogMap[lchar] = av;
+            // a letter and its analogs are one class for the automaton, classes sharing a letter are merged
+            uint32 l_Letter = 0;
+            unsigned int l_Pos = 0;
+            ReadCodePoint(lchar, l_Letter, l_Pos);
+
+            for (std::string const& l_Analog : av)
+            {
+                uint32 l_CodePoint = 0;
+                l_Pos = 0;
+                if (ReadCodePoint(l_Analog, l_CodePoint, l_Pos))
+                    MergeAnalogClasses(l_Letter, l_CodePoint);
+            }
         }
     }
 
     fclose(ma_file);
 
+    // point every analog straight to its class, the smallest code point of it
+    for (LC_NormalizeMap::iterator l_Itr = NormalizeMap.begin(); l_Itr != NormalizeMap.end(); ++l_Itr)
+        l_Itr->second = FindAnalogClass(l_Itr->first);
+
     return true;
 }
 
+uint32 LexicsCutter::FindAnalogClass(uint32 p_CodePoint) const
+{
+    LC_NormalizeMap::const_iterator l_Itr = NormalizeMap.find(p_CodePoint);
+    while (l_Itr != NormalizeMap.end() && l_Itr->second != p_CodePoint)
+    {
+        p_CodePoint = l_Itr->second;
+        l_Itr = NormalizeMap.find(p_CodePoint);
+    }
+
+    return p_CodePoint;
+}
+
+void LexicsCutter::MergeAnalogClasses(uint32 p_First, uint32 p_Second)
+{
+    p_First  = FindAnalogClass(p_First);
+    p_Second = FindAnalogClass(p_Second);
+
+    if (p_First == p_Second)
+        return;
+
+    // the smallest code point stays the class, whatever the order of the lines
+    if (p_Second < p_First)
+        std::swap(p_First, p_Second);
+
+    NormalizeMap[p_First]  = p_First;
+    NormalizeMap[p_Second] = p_First;
+}
+
 bool LexicsCutter::ReadInnormativeWords(std::string& FileName)
 {
     FILE *ma_file = NULL;
@@ -147,34 +217,13 @@ bool LexicsCutter::ReadInnormativeWords(std::string& FileName)
         line_s = line;
         line_s = trim(line_s, "\x0A\x0D");
 
-        // create word vector of vectors
-        LC_WordVector vw;
+        std::vector< uint32 > l_Word;
+        uint32 l_CodePoint = 0;
         pos = 0;
-        while (ReadUTF8(line_s, lchar, pos))
-        {
-            // create letter set
-            LC_LetterSet vl;
-
-            // initialize letter set with letter read
-            vl.insert(lchar);
-
-            // find letter analogs and push them onto the vector
-            LC_AnalogMap::iterator itr = AnalogMap.find(lchar);
-            if (itr != AnalogMap.end())
-            {
-                // analogs present, iterate
-                for (LC_AnalogVector::iterator itr2 = itr->second.begin(); itr2 != itr->second.end(); itr2++)
-                {
-                    vl.insert(*itr2);
-                }
-            }
+        while (ReadCodePoint(line_s, l_CodePoint, pos))
+            l_Word.push_back(l_CodePoint);
 
-            // add letter vector to word vector
-            vw.push_back(vl);
-        }
-
-        // push new word to words list
-        WordList.push_back(vw);
+        Words.push_back(l_Word);
     }
 
     fclose(ma_file);
@@ -184,96 +233,189 @@ bool LexicsCutter::ReadInnormativeWords(std::string& FileName)
 
 void LexicsCutter::MapInnormativeWords()
 {
-    // process all the words in the vector
-    for (unsigned int i = 0; i < WordList.size(); i++)
+    /// Build the trie of the normalized words, the text goes through the same normalization in CheckLexics
+    /// Letter repeats are kept, only the repeats of the text are ignored by CheckLexics
+    std::vector< std::map< uint32, uint32 > > l_Children(1);
+    Nodes.assign(1, LC_Node());
+    Nodes[0].Fail   = 0;
+    Nodes[0].Depth  = 0;
+    Nodes[0].Output    = false;
+    Nodes[0].WordStart = false;
+
+    for (std::vector< uint32 > const& l_Word : Words)
     {
-        // parse all analogs in the first word letter
-        for (LC_LetterSet::iterator itr = (*WordList[i].begin()).begin(); itr != (*WordList[i].begin()).end(); itr++)
+        uint32 l_Node = 0;
+
+        for (uint32 l_CodePoint : l_Word)
         {
-            // map the word to its first letter variants
-            WordMap.insert(std::pair< std::string, unsigned int >(*itr, i));
+            /// The leading space is kept, the word then only matches at the beginning of a word of the phrase
+            if (IgnoreMiddleSpaces && l_CodePoint == ' ' && l_Node)
+                continue;
+
+            uint32 l_Letter = Normalize(l_CodePoint);
+
+            std::map< uint32, uint32 >::const_iterator l_Itr = l_Children[l_Node].find(l_Letter);
+            if (l_Itr != l_Children[l_Node].end())
+            {
+                l_Node = l_Itr->second;
+                continue;
+            }
+
+            uint32 l_Child = uint32(Nodes.size());
+            l_Children[l_Node][l_Letter] = l_Child;
+            l_Children.push_back(std::map< uint32, uint32 >());
+
+            LC_Node l_New;
+            l_New.Fail      = 0;
+            l_New.Depth     = Nodes[l_Node].Depth + 1;
+            l_New.Output    = false;
+            l_New.WordStart = l_Node ? Nodes[l_Node].WordStart : l_Letter == ' ';
+            Nodes.push_back(l_New);
+
+            l_Node = l_Child;
         }
+
+        if (l_Node)
+            Nodes[l_Node].Output = true;
     }
-}
 
-bool LexicsCutter::CompareWord(std::string& str, unsigned int pos, LC_WordVector word)
-{
-    std::string lchar_prev;
-    std::string lchar;
+    WordStartNode = l_Children[0].count(' ') ? l_Children[0][' '] : 0;
 
-    // read first letter of the word into lchar_prev
-    ReadUTF8(str, lchar, pos);
+    /// Flatten the edges, they are needed by Step to compute the failure links
+    Edges.clear();
+    for (uint32 l_Node = 0; l_Node < Nodes.size(); ++l_Node)
+    {
+        Nodes[l_Node].EdgeBegin = uint32(Edges.size());
+        for (std::map< uint32, uint32 >::const_iterator l_Itr = l_Children[l_Node].begin(); l_Itr != l_Children[l_Node].end(); ++l_Itr)
+            Edges.push_back(LC_Edge(l_Itr->first, l_Itr->second));
+        Nodes[l_Node].EdgeEnd = uint32(Edges.size());
+    }
+
+    /// Failure links in breadth first order, a node fails to the longest proper suffix present in the trie
+    std::vector< uint32 > l_Queue;
+    l_Queue.reserve(Nodes.size());
+    l_Queue.push_back(0);
 
-    // okay, here we go, comparing word
-    // first letter is already okay, we do begin from second and go on
-    LC_WordVector::iterator i = word.begin();
-    i++;
-    while (i != word.end())
+    for (size_t l_Index = 0; l_Index < l_Queue.size(); ++l_Index)
     {
-        // get letter from word, return false if the string is shorter
-        if (!ReadUTF8(str, lchar, pos))
-            return false;
+        uint32 l_Node = l_Queue[l_Index];
 
-        // check, if the letter is in the set
-        LC_LetterSet ls = *i;
-        if (ls.count(lchar) == 0)
+        for (uint32 l_Edge = Nodes[l_Node].EdgeBegin; l_Edge < Nodes[l_Node].EdgeEnd; ++l_Edge)
         {
-            // letter is not in set, but we must check, if it is not space or repeat
-            if ((!(IgnoreMiddleSpaces && (lchar == " "))) &&
-                (!(IgnoreLetterRepeat && (lchar == lchar_prev))))
+            uint32 l_Child = Edges[l_Edge].second;
+
+            if (l_Node)
             {
-                return false;
+                Nodes[l_Child].Fail = Step(Nodes[l_Node].Fail, Edges[l_Edge].first);
+                Nodes[l_Child].Output |= Nodes[Nodes[l_Child].Fail].Output;
             }
-        }
-        else
-        {
-            if (CheckLetterContains)
-                if (str.size() == pos)
-                    return true;
 
-            // next word letter
-            i++;
+            l_Queue.push_back(l_Child);
         }
-        // set previous string letter to compare if needed (this check can really conserve time)
-        if (IgnoreLetterRepeat)
-            lchar_prev = lchar;
     }
+}
 
-    return true;
+uint32 LexicsCutter::Normalize(uint32 p_CodePoint) const
+{
+    LC_NormalizeMap::const_iterator l_Itr = NormalizeMap.find(p_CodePoint);
+    return l_Itr != NormalizeMap.end() ? l_Itr->second : p_CodePoint;
 }
 
-bool LexicsCutter::CheckLexics(std::string& Phrase)
+uint32 LexicsCutter::GetChild(uint32 p_Node, uint32 p_CodePoint) const
 {
-    std::string lchar;
-    LC_WordMap::iterator i;
-    std::pair< LC_WordMap::iterator, LC_WordMap::iterator > ii;
+    std::vector< LC_Edge >::const_iterator l_Begin = Edges.begin() + Nodes[p_Node].EdgeBegin;
+    std::vector< LC_Edge >::const_iterator l_End   = Edges.begin() + Nodes[p_Node].EdgeEnd;
+
+    std::vector< LC_Edge >::const_iterator l_Itr = std::lower_bound(l_Begin, l_End, LC_Edge(p_CodePoint, 0));
+    if (l_Itr == l_End || l_Itr->first != p_CodePoint)
+        return 0;
+
+    return l_Itr->second;
+}
+
+uint32 LexicsCutter::Step(uint32 p_Node, uint32 p_CodePoint) const
+{
+    for (;;)
+    {
+        if (uint32 l_Child = GetChild(p_Node, p_CodePoint))
+            return l_Child;
+
+        if (!p_Node)
+            return 0;
 
-    if (Phrase.size() == 0)
+        p_Node = Nodes[p_Node].Fail;
+    }
+}
+
+uint32 LexicsCutter::Advance(uint32 p_Node, uint32 p_Letter, bool p_Repeat) const
+{
+    /// A repeated letter extends the match if the word repeats it too, else it is ignored
+    if (IgnoreLetterRepeat && p_Repeat && p_Node && !GetChild(p_Node, p_Letter))
+        return p_Node;
+
+    return Step(p_Node, p_Letter);
+}
+
+bool LexicsCutter::CheckLexics(std::string const& Phrase) const
+{
+    if (Phrase.empty() || Nodes.size() <= 1)
         return false;
 
-    // first, convert the string, adding spaces and removing invalid characters
-    // also create fast position vector for the new positions
-    std::string str = " ";
-    unsigned int pos = 0;
-    while (ReadUTF8(Phrase, lchar, pos))
-        str.append(lchar);
-
-    // string prepared, now parse it and scan for all the words
-    unsigned int pos_prev = 0;
-    pos = 0;
-    while (ReadUTF8(str, lchar, pos))
+    uint32 l_Node = 0;
+    uint32 l_Previous = 0;
+    bool l_HasPrevious = false;
+
+    /// When the middle spaces are ignored, l_Node never reads a space, the words with a leading space are matched
+    /// by l_WordNode, which starts again from WordStartNode after a space unless the next letter extends its word
+    bool l_CheckWordStart = IgnoreMiddleSpaces && WordStartNode;
+    uint32 l_WordNode = 0;
+    bool l_AfterSpace = false;
+
+    /// The phrase begins with a word, as if it was preceded by a space
+    uint32 l_CodePoint = ' ';
+    unsigned int l_Pos = 0;
+
+    do
     {
-        // got character, now try to find wordmap for it
-        ii = WordMap.equal_range(lchar);
-        for (i = ii.first; i != ii.second; i++)
+        if (IgnoreMiddleSpaces && l_CodePoint == ' ')
         {
-            // compare word at initial position
-            if (CompareWord(str, pos_prev, WordList[i->second]))
-                return true;
+            l_AfterSpace = true;
+            continue;
         }
-        // set initial position to the current position
-        pos_prev = pos;
+
+        uint32 l_Letter = Normalize(l_CodePoint);
+        bool l_Repeat = l_HasPrevious && l_Letter == l_Previous;
+
+        l_Previous    = l_Letter;
+        l_HasPrevious = true;
+
+        l_Node = Advance(l_Node, l_Letter, l_Repeat);
+        if (Nodes[l_Node].Output)
+            return true;
+
+        if (!l_CheckWordStart)
+            continue;
+
+        if (l_AfterSpace)
+        {
+            if (!Nodes[l_WordNode].WordStart || l_WordNode == WordStartNode || !GetChild(l_WordNode, l_Letter))
+                l_WordNode = WordStartNode;
+
+            l_AfterSpace = false;
+        }
+
+        l_WordNode = Advance(l_WordNode, l_Letter, l_Repeat && l_WordNode != WordStartNode);
+        if (Nodes[l_WordNode].Output)
+            return true;
     }
+    while (ReadCodePoint(Phrase, l_CodePoint, l_Pos));
+
+    /// The message ends with the beginning of a word
+    if (CheckLetterContains && Nodes[l_Node].Depth >= 2)
+        return true;
+
+    if (CheckLetterContains && l_CheckWordStart && Nodes[l_WordNode].WordStart && Nodes[l_WordNode].Depth >= 3)
+        return true;
 
     return false;
 }
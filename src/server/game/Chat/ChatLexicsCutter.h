@@ -2,11 +2,6 @@
 #define CHATLEXICSCUTTER_H
 
 typedef std::vector< std::string > LC_AnalogVector;
-typedef std::map< std::string, LC_AnalogVector > LC_AnalogMap;
-typedef std::set< std::string > LC_LetterSet;
-typedef std::vector< LC_LetterSet > LC_WordVector;
-typedef std::vector< LC_WordVector > LC_WordList;
-typedef std::multimap< std::string, unsigned int > LC_WordMap;
 
 static int trailingBytesForUTF8[256] = {
     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
@@ -19,28 +14,64 @@ static int trailingBytesForUTF8[256] = {
     2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2, 3,3,3,3,3,3,3,3,4,4,4,4,5,5,5,5
 };
 
+/// Aho-Corasick automaton state, its edges are LC_Edges[EdgeBegin, EdgeEnd) sorted by code point
+struct LC_Node
+{
+    uint32 EdgeBegin;
+    uint32 EdgeEnd;
+    uint32 Fail;
+    uint16 Depth;
+    bool   Output;      ///< A word ends here or on the failure chain
+    bool   WordStart;   ///< The path of the node begins with the word start space
+};
+
+typedef std::pair< uint32, uint32 > LC_Edge;            ///< Normalized code point, target node
+typedef std::unordered_map< uint32, uint32 > LC_NormalizeMap;
+
 class LexicsCutter
 {
     protected:
-        LC_AnalogMap AnalogMap;
-        LC_WordList WordList;
-        LC_WordMap WordMap;
-
         std::string InvalidChars;
 
+        /// Innormative words as code points, as read from the file
+        std::vector< std::vector< uint32 > > Words;
+
+        /// Letter analogs code point -> smallest code point of its analog class
+        LC_NormalizeMap NormalizeMap;
+
+        std::vector< LC_Node > Nodes;
+        std::vector< LC_Edge > Edges;
+
+        /// Child of the root for the leading space of the words only matching at the beginning of a word, 0 if none
+        uint32 WordStartNode;
+
+        uint32 Normalize(uint32 p_CodePoint) const;
+        uint32 FindAnalogClass(uint32 p_CodePoint) const;
+        void MergeAnalogClasses(uint32 p_First, uint32 p_Second);
+        uint32 Step(uint32 p_Node, uint32 p_CodePoint) const;
+        uint32 GetChild(uint32 p_Node, uint32 p_CodePoint) const;
+        uint32 Advance(uint32 p_Node, uint32 p_Letter, bool p_Repeat) const;
+
     public:
         LexicsCutter();
 
-        static bool ReadUTF8(std::string& in, std::string& out, unsigned int& pos);
+        static bool ReadUTF8(std::string const& in, std::string& out, unsigned int& pos);
+        static bool ReadCodePoint(std::string const& p_In, uint32& p_CodePoint, unsigned int& p_Pos);
 
         std::string trim(std::string& s, const std::string& drop = " ");
         static std::string ltrim(std::string &data);
         bool ReadLetterAnalogs(std::string& FileName);
         bool ReadInnormativeWords(std::string& FileName);
+
+        /// Compile the words into the automaton, the Ignore* settings must be set before
         void MapInnormativeWords();
-        bool CompareWord(std::string& str, unsigned int pos, LC_WordVector word);
-        bool CheckLexics(std::string& Phrase);
-        
+
+        /// Linear time scan of the phrase
+        bool CheckLexics(std::string const& Phrase) const;
+
+        uint32 GetNodeCount() const { return uint32(Nodes.size()); }
+        uint32 GetWordCount() const { return uint32(Words.size()); }
+
         std::vector< std::pair< unsigned int, unsigned int > > Found;
         bool IgnoreMiddleSpaces;
         bool IgnoreLetterRepeat;
@@ -0,0 +1,182 @@
+////////////////////////////////////////////////////////////////////////////////
+//
+//  MILLENIUM-STUDIO
+//  Copyright 2016 Millenium-studio SARL
+//  All Rights Reserved.
+//
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef _THREATHEAP_H
+#define _THREATHEAP_H
+
+#include "Define.h"
+
+#include <algorithm>
+#include <vector>
+
+/// Intrusive binary max-heap on threat.
+/// Each element stores its own position (GetThreatHeapIndex / SetThreatHeapIndex) so it can be
+/// moved in O(log n) when its threat changes and removed in O(log n) without searching it.
+/// Equal threats are ordered by insertion (GetThreatHeapSequence / SetThreatHeapSequence), so the selection between them is deterministic.
+/// T must provide float getThreat() const.
+template<class T> class ThreatHeap
+{
+    public:
+        ThreatHeap() : m_NextSequence(0) { }
+
+        bool Empty() const { return m_Elements.empty(); }
+        uint32 Size() const { return uint32(m_Elements.size()); }
+
+        /// Elements in heap order, for visits where the order does not matter
+        std::vector<T*> const& GetElements() const { return m_Elements; }
+
+        T* Top() const { return m_Elements.empty() ? nullptr : m_Elements.front(); }
+
+        bool Contains(T const* p_Element) const
+        {
+            uint32 l_Index = p_Element->GetThreatHeapIndex();
+            return l_Index < m_Elements.size() && m_Elements[l_Index] == p_Element;
+        }
+
+        void Insert(T* p_Element)
+        {
+            p_Element->SetThreatHeapIndex(uint32(m_Elements.size()));
+            p_Element->SetThreatHeapSequence(m_NextSequence++);
+            m_Elements.push_back(p_Element);
+            SiftUp(uint32(m_Elements.size() - 1));
+        }
+
+        void Remove(T* p_Element)
+        {
+            if (!Contains(p_Element))
+                return;
+
+            uint32 l_Index = p_Element->GetThreatHeapIndex();
+            uint32 l_Last  = uint32(m_Elements.size() - 1);
+
+            if (l_Index != l_Last)
+            {
+                Place(m_Elements[l_Last], l_Index);
+                m_Elements.pop_back();
+                Restore(l_Index);
+            }
+            else
+                m_Elements.pop_back();
+        }
+
+        /// Move the element after its threat changed
+        void Update(T* p_Element)
+        {
+            if (Contains(p_Element))
+                Restore(p_Element->GetThreatHeapIndex());
+        }
+
+        void Clear()
+        {
+            m_Elements.clear();
+            m_NextSequence = 0;
+        }
+
+        /// Call p_Visitor(T*) in descending threat order until it returns false, O(k log k) for k visited elements
+        template<class Visitor> void VisitByThreat(Visitor p_Visitor) const
+        {
+            if (m_Elements.empty())
+                return;
+
+            /// Frontier of the visit, a max-heap of positions in m_Elements
+            std::vector<uint32> l_Frontier;
+            l_Frontier.reserve(16);
+            l_Frontier.push_back(0);
+
+            auto l_Less = [this](uint32 p_A, uint32 p_B) -> bool
+            {
+                return Before(m_Elements[p_B], m_Elements[p_A]);
+            };
+
+            while (!l_Frontier.empty())
+            {
+                std::pop_heap(l_Frontier.begin(), l_Frontier.end(), l_Less);
+                uint32 l_Index = l_Frontier.back();
+                l_Frontier.pop_back();
+
+                if (!p_Visitor(m_Elements[l_Index]))
+                    return;
+
+                for (uint32 l_Child = 2 * l_Index + 1; l_Child <= 2 * l_Index + 2 && l_Child < m_Elements.size(); ++l_Child)
+                {
+                    l_Frontier.push_back(l_Child);
+                    std::push_heap(l_Frontier.begin(), l_Frontier.end(), l_Less);
+                }
+            }
+        }
+
+    private:
+        /// Heap order: more threat first, then the oldest insertion
+        static bool Before(T const* p_A, T const* p_B)
+        {
+            if (p_A->getThreat() != p_B->getThreat())
+                return p_A->getThreat() > p_B->getThreat();
+
+            return p_A->GetThreatHeapSequence() < p_B->GetThreatHeapSequence();
+        }
+
+        void Place(T* p_Element, uint32 p_Index)
+        {
+            m_Elements[p_Index] = p_Element;
+            p_Element->SetThreatHeapIndex(p_Index);
+        }
+
+        void Restore(uint32 p_Index)
+        {
+            if (p_Index > 0 && Before(m_Elements[p_Index], m_Elements[(p_Index - 1) / 2]))
+                SiftUp(p_Index);
+            else
+                SiftDown(p_Index);
+        }
+
+        void SiftUp(uint32 p_Index)
+        {
+            T* l_Element = m_Elements[p_Index];
+
+            while (p_Index > 0)
+            {
+                uint32 l_Parent = (p_Index - 1) / 2;
+                if (!Before(l_Element, m_Elements[l_Parent]))
+                    break;
+
+                Place(m_Elements[l_Parent], p_Index);
+                p_Index = l_Parent;
+            }
+
+            Place(l_Element, p_Index);
+        }
+
+        void SiftDown(uint32 p_Index)
+        {
+            T* l_Element = m_Elements[p_Index];
+            uint32 l_Size = uint32(m_Elements.size());
+
+            for (;;)
+            {
+                uint32 l_Child = 2 * p_Index + 1;
+                if (l_Child >= l_Size)
+                    break;
+
+                if (l_Child + 1 < l_Size && Before(m_Elements[l_Child + 1], m_Elements[l_Child]))
+                    ++l_Child;
+
+                if (!Before(m_Elements[l_Child], l_Element))
+                    break;
+
+                Place(m_Elements[l_Child], p_Index);
+                p_Index = l_Child;
+            }
+
+            Place(l_Element, p_Index);
+        }
+
+        std::vector<T*> m_Elements;
+        uint32 m_NextSequence;
+};
+
+#endif
@@ -89,6 +89,8 @@ HostileReference::HostileReference(Unit* refUnit, ThreatManager* threatManager,
     iUnitGuid = refUnit->GetGUID();
     iOnline = true;
     iAccessible = true;
+    iThreatHeapIndex = 0;
+    iThreatHeapSequence = 0;
 }
 
 //============================================================
@@ -249,21 +251,84 @@ void ThreatContainer::clearReferences()
         delete (*i);
     }
     iThreatList.clear();
+    iThreatListSorted = true;
+    iThreatHeap.Clear();
+    iReferencesByGuid.clear();
+}
+
+//============================================================
+
+void ThreatContainer::addReference(HostileReference* hostileRef)
+{
+    hostileRef->iThreatListItr = iThreatList.insert(iThreatList.end(), hostileRef);
+    iThreatListSorted = false;
+    iThreatHeap.Insert(hostileRef);
+    iReferencesByGuid[hostileRef->getUnitGuid()] = hostileRef;
+}
+
+//============================================================
+
+void ThreatContainer::remove(HostileReference* hostileRef)
+{
+    // the reference may not be in this container
+    if (!iThreatHeap.Contains(hostileRef))
+        return;
+
+    iThreatList.erase(hostileRef->iThreatListItr);
+    iThreatHeap.Remove(hostileRef);
+
+    std::unordered_map<uint64, HostileReference*>::iterator itr = iReferencesByGuid.find(hostileRef->getUnitGuid());
+    if (itr != iReferencesByGuid.end() && itr->second == hostileRef)
+        iReferencesByGuid.erase(itr);
+}
+
+//============================================================
+
+void ThreatContainer::updateReference(HostileReference* hostileRef)
+{
+    iThreatHeap.Update(hostileRef);
+    iThreatListSorted = false;
 }
 
 //============================================================
 // Return the HostileReference of NULL, if not found
-HostileReference* ThreatContainer::getReferenceByTarget(Unit* victim)
+HostileReference* ThreatContainer::getReferenceByTarget(Unit* victim) const
 {
     if (!victim)
         return NULL;
 
-    uint64 guid = victim->GetGUID();
-    for (std::list<HostileReference*>::const_iterator i = iThreatList.begin(); i != iThreatList.end(); ++i)
-        if ((*i) && (*i)->getUnitGuid() == guid)
-            return (*i);
+    return getReferenceByGuid(victim->GetGUID());
+}
+
+HostileReference* ThreatContainer::getReferenceByGuid(uint64 guid) const
+{
+    std::unordered_map<uint64, HostileReference*>::const_iterator itr = iReferencesByGuid.find(guid);
+    return itr != iReferencesByGuid.end() ? itr->second : NULL;
+}
+
+//============================================================
+// The list is only sorted for the callers that walk it
+
+std::list<HostileReference*> const& ThreatContainer::getThreatList() const
+{
+    if (!iThreatListSorted)
+    {
+        iThreatList.sort(JadeCore::ThreatOrderPred());
+        iThreatListSorted = true;
+    }
+
+    return iThreatList;
+}
+
+std::list<HostileReference*> ThreatContainer::GetThreatList() const
+{
+    if (!iThreatListSorted)
+    {
+        iThreatList.sort(JadeCore::ThreatOrderPred());
+        iThreatListSorted = true;
+    }
 
-    return NULL;
+    return iThreatList;
 }
 
 //============================================================
@@ -286,13 +351,10 @@ void ThreatContainer::modifyThreatPercent(Unit* victim, int32 percent)
 }
 
 //============================================================
-// Check if the list is dirty and sort if necessary
+// The heap is kept ordered on each threat change, only the flag is left
 
 void ThreatContainer::update()
 {
-    if (iDirty && iThreatList.size() > 1)
-        iThreatList.sort(JadeCore::ThreatOrderPred());
-
     iDirty = false;
 }
 
@@ -302,16 +364,16 @@ void ThreatContainer::update()
 
 HostileReference* ThreatContainer::selectNextVictim(Creature* attacker, HostileReference* currentVictim)
 {
-    HostileReference* currentRef = NULL;
-    bool found = false;
+    HostileReference* result = NULL;
     bool noPriorityTargetFound = false;
+    bool onlySecondChoiceTargets = false;
+    uint32 visited = 0;
+    uint32 count = iThreatHeap.Size();
 
-    std::list<HostileReference*>::const_iterator lastRef = iThreatList.end();
-    --lastRef;
-
-    for (std::list<HostileReference*>::const_iterator iter = iThreatList.begin(); iter != iThreatList.end() && !found;)
+    // visit the references by descending threat, stops at the first acceptable one
+    auto selector = [&](HostileReference* currentRef) -> bool
     {
-        currentRef = (*iter);
+        ++visited;
 
         Unit* target = currentRef->getTarget();
         ASSERT(target);                                     // if the ref has status online the target must be there !
@@ -319,21 +381,17 @@ HostileReference* ThreatContainer::selectNextVictim(Creature* attacker, HostileR
         // some units are prefered in comparison to others
         if (!noPriorityTargetFound && (target->IsImmunedToDamage(attacker->GetMeleeDamageSchoolMask()) || target->HasNegativeAuraWithInterruptFlag(AURA_INTERRUPT_FLAG_TAKE_DAMAGE)))
         {
-            if (iter != lastRef)
+            // the last one is handled by the second pass
+            if (visited == count)
             {
-                // current victim is a second choice target, so don't compare threat with it below
-                if (currentRef == currentVictim)
-                    currentVictim = NULL;
-                ++iter;
-                continue;
-            }
-            else
-            {
-                // if we reached to this point, everyone in the threatlist is a second choice target. In such a situation the target with the highest threat should be attacked.
-                noPriorityTargetFound = true;
-                iter = iThreatList.begin();
-                continue;
+                onlySecondChoiceTargets = true;
+                return false;
             }
+
+            // current victim is a second choice target, so don't compare threat with it below
+            if (currentRef == currentVictim)
+                currentVictim = NULL;
+            return true;
         }
 
         if (attacker->canCreatureAttack(target))           // skip non attackable currently targets
@@ -346,30 +404,40 @@ HostileReference* ThreatContainer::selectNextVictim(Creature* attacker, HostileR
                     if (currentVictim != currentRef && attacker->canCreatureAttack(currentVictim->getTarget()))
                         currentRef = currentVictim;            // for second case, if currentvictim is attackable
 
-                    found = true;
-                    break;
+                    result = currentRef;
+                    return false;
                 }
 
                 if (currentRef->getThreat() > 1.3f * currentVictim->getThreat() ||
                     (currentRef->getThreat() > 1.1f * currentVictim->getThreat() &&
                     attacker->IsWithinMeleeRange(target)))
                 {                                           //implement 110% threat rule for targets in melee range
-                    found = true;                           //and 130% rule for targets in ranged distances
-                    break;                                  //for selecting alive targets
+                    result = currentRef;                    //and 130% rule for targets in ranged distances
+                    return false;                           //for selecting alive targets
                 }
             }
             else                                            // select any
             {
-                found = true;
-                break;
+                result = currentRef;
+                return false;
             }
         }
-        ++iter;
+
+        return true;
+    };
+
+    iThreatHeap.VisitByThreat(selector);
+
+    // if we reached the last one without result, everyone in the threatlist is a second choice target.
+    // In such a situation the target with the highest threat should be attacked.
+    if (onlySecondChoiceTargets)
+    {
+        noPriorityTargetFound = true;
+        visited = 0;
+        iThreatHeap.VisitByThreat(selector);
     }
-    if (!found)
-        currentRef = NULL;
 
-    return currentRef;
+    return result;
 }
 
 //============================================================
@@ -517,6 +585,10 @@ void ThreatManager::processThreatEvent(ThreatRefStatusChangeEvent* threatRefStat
             if ((getCurrentVictim() == hostilRef && threatRefStatusChangeEvent->getFValue()<0.0f) ||
                 (getCurrentVictim() != hostilRef && threatRefStatusChangeEvent->getFValue()>0.0f))
                 setDirty(true);                             // the order in the threat list might have changed
+            if (hostilRef->isOnline())
+                iThreatContainer.updateReference(hostilRef);
+            else
+                iThreatOfflineContainer.updateReference(hostilRef);
             break;
         case UEV_THREAT_REF_ONLINE_STATUS:
             if (!hostilRef->isOnline())
@@ -534,8 +606,9 @@ void ThreatManager::processThreatEvent(ThreatRefStatusChangeEvent* threatRefStat
             {
                 if (getCurrentVictim() && hostilRef->getThreat() > (1.1f * getCurrentVictim()->getThreat()))
                     setDirty(true);
-                iThreatContainer.addReference(hostilRef);
+                /// A reference has a single heap index and list iterator, leave the old container before joining the new one
                 iThreatOfflineContainer.remove(hostilRef);
+                iThreatContainer.addReference(hostilRef);
             }
             break;
         case UEV_THREAT_REF_REMOVE_FROM_LIST:
@@ -570,29 +643,11 @@ bool ThreatManager::isNeedUpdateToClient(uint32 time)
 // Reset all aggro without modifying the threadlist.
 void ThreatManager::resetAllAggro()
 {
-    std::list<HostileReference*> &threatList = getThreatList();
-    if (threatList.empty())
-        return;
-
-    for (std::list<HostileReference*>::iterator itr = threatList.begin(); itr != threatList.end(); ++itr)
-    {
-        (*itr)->setThreat(0);
-    }
-
-    setDirty(true);
+    if (iThreatContainer.resetThreat([](HostileReference*) { return true; }))
+        setDirty(true);
 }
 
 bool ThreatManager::HaveInThreatList(uint64 p_Guid) const
 {
-    std::list<HostileReference*> l_ThreatList = GetThreatList();
-    if (l_ThreatList.empty())
-        return false;
-
-    for (HostileReference* l_Iter : l_ThreatList)
-    {
-        if (p_Guid == l_Iter->getUnitGuid())
-            return true;
-    }
-
-    return false;
+    return iThreatContainer.getReferenceByGuid(p_Guid) != NULL;
 }
@@ -13,6 +13,7 @@
 #include "SharedDefines.h"
 #include "LinkedReference/Reference.h"
 #include "UnitEvents.h"
+#include "ThreatHeap.h"
 
 //==============================================================
 
@@ -112,7 +113,17 @@ class HostileReference : public Reference<Unit, ThreatManager>
 
         // Tell our refFrom (source) object, that the link is cut (Target destroyed)
         void sourceObjectDestroyLink();
+
+        //=================================================
+        // position in the ThreatHeap of the container holding the reference
+
+        uint32 GetThreatHeapIndex() const { return iThreatHeapIndex; }
+        void SetThreatHeapIndex(uint32 index) { iThreatHeapIndex = index; }
+        uint32 GetThreatHeapSequence() const { return iThreatHeapSequence; }
+        void SetThreatHeapSequence(uint32 sequence) { iThreatHeapSequence = sequence; }
     private:
+        friend class ThreatContainer;
+
         // Inform the source, that the status of that reference was changed
         void fireStatusChanged(ThreatRefStatusChangeEvent& threatRefStatusChangeEvent);
 
@@ -123,27 +134,39 @@ class HostileReference : public Reference<Unit, ThreatManager>
         uint64 iUnitGuid;
         bool iOnline;
         bool iAccessible;
+        uint32 iThreatHeapIndex;
+        uint32 iThreatHeapSequence;                         // insertion order in the ThreatHeap, breaks threat ties
+        std::list<HostileReference*>::iterator iThreatListItr;  // position in the list of the container holding the reference
 };
 
 //==============================================================
 class ThreatManager;
 
+// The references are kept in a ThreatHeap ordered by threat and indexed by target guid, so threat changes,
+// lookups and the victim selection don't scan nor sort the whole list. The std::list is kept for the scripts
+// and only sorted when they ask for it.
 class ThreatContainer
 {
     private:
-        std::list<HostileReference*> iThreatList;
+        mutable std::list<HostileReference*> iThreatList;
+        mutable bool iThreatListSorted;
+        ThreatHeap<HostileReference> iThreatHeap;
+        std::unordered_map<uint64, HostileReference*> iReferencesByGuid;
         bool iDirty;
     protected:
         friend class ThreatManager;
 
-        void remove(HostileReference* hostileRef) { iThreatList.remove(hostileRef); }
-        void addReference(HostileReference* hostileRef) { iThreatList.push_back(hostileRef); }
+        void remove(HostileReference* hostileRef);
+        void addReference(HostileReference* hostileRef);
         void clearReferences();
 
-        // Sort the list if necessary
+        // Move the reference in the heap after its threat changed
+        void updateReference(HostileReference* hostileRef);
+
+        // Clear the dirty flag, the order is kept by the heap
         void update();
     public:
-        ThreatContainer() { iDirty = false; }
+        ThreatContainer() : iThreatListSorted(true), iDirty(false) { }
         ~ThreatContainer() { clearReferences(); }
 
         HostileReference* addThreat(Unit* victim, float threat);
@@ -156,14 +179,43 @@ class ThreatContainer
 
         bool isDirty() const { return iDirty; }
 
-        bool empty() const { return iThreatList.empty(); }
+        bool empty() const { return iThreatHeap.Empty(); }
+
+        uint32 size() const { return iThreatHeap.Size(); }
+
+        HostileReference* getMostHated() const { return iThreatHeap.Top(); }
+
+        HostileReference* getReferenceByTarget(Unit* victim) const;
+        HostileReference* getReferenceByGuid(uint64 guid) const;
+
+        // Call visitor(HostileReference*) in descending threat order until it returns false, O(k log k) for k visited references
+        template<class Visitor> void visitByThreat(Visitor visitor) const { iThreatHeap.VisitByThreat(visitor); }
+
+        // All the references, not ordered and without copy. Don't change threats while iterating it.
+        std::vector<HostileReference*> const& getReferences() const { return iThreatHeap.GetElements(); }
+
+        // Set the threat of the references matching the predicate to 0, returns true if any matched.
+        // Walks a copy: a threat change can move a reference to the other container of the manager.
+        template<class PREDICATE> bool resetThreat(PREDICATE predicate)
+        {
+            std::vector<HostileReference*> references = getReferences();
+            bool reset = false;
+
+            for (HostileReference* ref : references)
+            {
+                if (!predicate(ref))
+                    continue;
 
-        HostileReference* getMostHated() { return iThreatList.empty() ? NULL : iThreatList.front(); }
+                ref->setThreat(0);
+                reset = true;
+            }
 
-        HostileReference* getReferenceByTarget(Unit* victim);
+            return reset;
+        }
 
-        std::list<HostileReference*>& getThreatList() { return iThreatList; }
-        std::list<HostileReference*> GetThreatList() const { return iThreatList; }
+        // Sorted by threat on access, changed only through the container
+        std::list<HostileReference*> const& getThreatList() const;
+        std::list<HostileReference*> GetThreatList() const;
 };
 
 //=================================================
@@ -212,27 +264,18 @@ class ThreatManager
         // Reset all aggro of unit in threadlist satisfying the predicate.
         template<class PREDICATE> void resetAggro(PREDICATE predicate)
         {
-            std::list<HostileReference*> &threatList = getThreatList();
-            if (threatList.empty())
-                return;
-
-            for (std::list<HostileReference*>::iterator itr = threatList.begin(); itr != threatList.end(); ++itr)
-            {
-                HostileReference* ref = (*itr);
-
-                if (predicate(ref->getTarget()))
-                {
-                    ref->setThreat(0);
-                    setDirty(true);
-                }
-            }
+            if (iThreatContainer.resetThreat([&predicate](HostileReference* ref) { return predicate(ref->getTarget()); }))
+                setDirty(true);
         }
 
+        // Visit the online references in descending threat order, without sorting the threat list
+        template<class Visitor> void visitByThreat(Visitor visitor) const { iThreatContainer.visitByThreat(visitor); }
+
         // methods to access the lists from the outside to do some dirty manipulation (scriping and such)
         // I hope they are used as little as possible.
-        std::list<HostileReference*>& getThreatList() { return iThreatContainer.getThreatList(); }
+        std::list<HostileReference*> const& getThreatList() const { return iThreatContainer.getThreatList(); }
         std::list<HostileReference*> GetThreatList() const { return iThreatContainer.GetThreatList(); }
-        std::list<HostileReference*>& getOfflineThreatList() { return iThreatOfflineContainer.getThreatList(); }
+        std::list<HostileReference*> const& getOfflineThreatList() const { return iThreatOfflineContainer.getThreatList(); }
         ThreatContainer& getOnlineContainer() { return iThreatContainer; }
         ThreatContainer& getOfflineContainer() { return iThreatOfflineContainer; }
 
@@ -252,13 +295,16 @@ class ThreatManager
 
 namespace JadeCore
 {
-    // Binary predicate for sorting HostileReferences based on threat value
+    // Binary predicate for sorting HostileReferences based on threat value, equal threats in the ThreatHeap order
     class ThreatOrderPred
     {
         public:
             ThreatOrderPred(bool ascending = false) : m_ascending(ascending) {}
             bool operator() (HostileReference const* a, HostileReference const* b) const
             {
+                if (a->getThreat() == b->getThreat())
+                    return m_ascending ? a->GetThreatHeapSequence() > b->GetThreatHeapSequence() : a->GetThreatHeapSequence() < b->GetThreatHeapSequence();
+
                 return m_ascending ? a->getThreat() < b->getThreat() : a->getThreat() > b->getThreat();
             }
         private:
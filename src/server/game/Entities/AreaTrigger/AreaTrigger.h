@@ -246,6 +246,8 @@ typedef std::map<uint32, AreaTriggerTemplateList> AreaTriggerTemplateContainer;
 class AreaTrigger : public WorldObject, public GridObject<AreaTrigger>
 {
     public:
+        OBJECT_POOL_ALLOCATED(OBJECT_POOL_AREATRIGGER)
+
         AreaTrigger();
         ~AreaTrigger();
 
@@ -24,6 +24,7 @@
 #include "MapManager.h"
 #include "CreatureAI.h"
 #include "CreatureAISelector.h"
+#include "CreatureAIFactory.h"
 #include "Formulas.h"
 #include "WaypointMovementGenerator.h"
 #include "InstanceScript.h"
@@ -139,7 +140,7 @@ lootForPickPocketed(false), lootForBody(false), m_groupLootTimer(0), lootingGrou
 m_PlayerDamageReq(0), m_lootRecipient(0), m_lootRecipientGroup(0), m_corpseRemoveTime(0), m_respawnTime(0),
 m_respawnDelay(300), m_corpseDelay(60), m_respawnradius(0.0f), m_reactState(REACT_AGGRESSIVE),
 m_defaultMovementType(IDLE_MOTION_TYPE), m_DBTableGuid(0), m_equipmentId(0), m_OriginalEquipmentId(0), m_AlreadyCallAssistance(false),
-m_AlreadySearchedAssistance(false), m_regenHealth(true), m_AI_locked(false), m_meleeDamageSchoolMask(SPELL_SCHOOL_MASK_NORMAL),
+m_AlreadySearchedAssistance(false), m_regenHealth(true), m_AI_locked(false), m_SpawnAIFactory(nullptr), m_meleeDamageSchoolMask(SPELL_SCHOOL_MASK_NORMAL),
 m_creatureInfo(NULL), m_NativeCreatureInfo(nullptr), m_creatureData(NULL), m_CreatureScript(nullptr), m_path_id(0), m_formation(NULL)
 {
     m_NeedRespawn = false;
@@ -168,6 +169,7 @@ m_creatureInfo(NULL), m_NativeCreatureInfo(nullptr), m_creatureData(NULL), m_Cre
     ResetLootMode(); // restore default loot mode
     TriggerJustRespawned = false;
     m_isTempWorldObject = false;
+    m_IsUnobservedWildBattlePet = false;
 
     m_StartEncounterTime = 0;
     m_DumpGroupTimer     = 0;
@@ -196,6 +198,7 @@ void Creature::AddToWorld()
             m_zoneScript->OnCreatureCreate(this);
         sObjectAccessor->AddObject(this);
         Unit::AddToWorld();
+        RegisterVignetteTrackers();
         SearchFormation();
         AIM_Initialize();
         if (IsVehicle())
@@ -855,7 +858,14 @@ bool Creature::AIM_Initialize(CreatureAI* ai)
 
     Motion_Initialize();
 
-    i_AI = ai ? ai : FactorySelector::selectAI(this);
+    if (ai)
+        i_AI = ai;
+    else if (m_SpawnAIFactory)
+        i_AI = m_SpawnAIFactory->Create(this);
+    else
+        i_AI = FactorySelector::selectAI(this);
+
+    m_SpawnAIFactory = nullptr;
     delete oldAI;
     IsAIEnabled = true;
     i_AI->InitializeAI();
@@ -1587,9 +1597,9 @@ bool Creature::CreateFromProto(uint32 guidlow, uint32 Entry, uint32 vehId, uint3
     return true;
 }
 
-bool Creature::LoadCreatureFromDB(uint32 guid, Map* map, bool addToMap)
+bool Creature::LoadCreatureFromDB(uint32 guid, Map* map, bool addToMap, CreatureData const* p_Data)
 {
-    CreatureData const* data = sObjectMgr->GetCreatureData(guid);
+    CreatureData const* data = p_Data ? p_Data : sObjectMgr->GetCreatureData(guid);
 
     if (!data)
     {
@@ -3123,3 +3133,35 @@ void Creature::DumpGroup()
 
     AddGroupDump(l_GroupDump);
 }
+
+void Creature::RegisterVignetteTrackers()
+{
+    if (Vignette::Manager::s_UnitSourcedVignettes.load(std::memory_order_relaxed) <= 0)
+        return;
+
+    /// Vignettes created before the creature was added to the map could not register themselves
+    Map::PlayerList const& l_Players = GetMap()->GetPlayers();
+    for (Map::PlayerList::const_iterator l_Itr = l_Players.begin(); l_Itr != l_Players.end(); ++l_Itr)
+    {
+        Player* l_Player = l_Itr->getSource();
+        if (l_Player->GetVignetteMgr().HasVignetteFromSource(GetGUID()))
+            AddVignetteTracker(l_Player->GetGUID());
+    }
+}
+
+void Creature::PushVignettePositions()
+{
+    for (auto l_Itr = m_VignetteTrackers.begin(); l_Itr != m_VignetteTrackers.end();)
+    {
+        Player* l_Player = ObjectAccessor::GetPlayer(*this, *l_Itr);
+
+        /// Player gone or vignette removed since, stop tracking
+        if (!l_Player || !l_Player->GetVignetteMgr().OnSourceRelocated(this))
+        {
+            l_Itr = m_VignetteTrackers.erase(l_Itr);
+            continue;
+        }
+
+        ++l_Itr;
+    }
+}
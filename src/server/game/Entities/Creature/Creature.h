@@ -25,6 +25,7 @@ class Player;
 class WorldSession;
 class CreatureGroup;
 class CreatureScript;
+template<class T, class Key> class FactoryHolder;
 
 enum CreatureFlagsExtra
 {
@@ -514,6 +515,7 @@ typedef std::map<uint32, time_t> CreatureSpellCooldowns;
 class Creature : public Unit, public GridObject<Creature>, public MapObject
 {
     public:
+        OBJECT_POOL_ALLOCATED(OBJECT_POOL_CREATURE)
 
         explicit Creature(bool isWorldObject = true);
         virtual ~Creature();
@@ -594,6 +596,8 @@ class Creature : public Unit, public GridObject<Creature>, public MapObject
         bool IsInEvadeMode() const { return HasUnitState(UNIT_STATE_EVADE); }
 
         bool AIM_Initialize(CreatureAI* ai = nullptr);
+        /// AI factory chosen before the creature is loaded, used by the next AIM_Initialize only
+        void SetSpawnAIFactory(FactoryHolder<CreatureAI, std::string> const* p_Factory) { m_SpawnAIFactory = p_Factory; }
         void Motion_Initialize();
 
         bool isCanGiveSpell(Unit* /*caster*/, SpellInfo const* p_ProcSpell)
@@ -683,8 +687,9 @@ class Creature : public Unit, public GridObject<Creature>, public MapObject
 
         void setDeathState(DeathState s) override;
 
-        bool LoadFromDB(uint32 guid, Map* map) { return LoadCreatureFromDB(guid, map, false); }
-        bool LoadCreatureFromDB(uint32 guid, Map* map, bool addToMap = true);
+        bool LoadFromDB(uint32 guid, Map* map, CreatureData const* p_Data = nullptr) { return LoadCreatureFromDB(guid, map, false, p_Data); }
+        /// p_Data is the spawn data of guid when the caller already looked it up
+        bool LoadCreatureFromDB(uint32 guid, Map* map, bool addToMap = true, CreatureData const* p_Data = nullptr);
         void SaveToDB();
                                                             // overriden in Pet
         virtual void SaveToDB(uint32 mapid, uint32 spawnMask, uint32 phaseMask);
@@ -838,6 +843,7 @@ class Creature : public Unit, public GridObject<Creature>, public MapObject
         void FarTeleportTo(Map* map, float X, float Y, float Z, float O);
 
         bool m_isTempWorldObject; //true when possessed
+        bool m_IsUnobservedWildBattlePet;   ///< Wild battle pet no player has seen yet, see WildBattlePetMgr::s_Observed
 
         void ForcedDespawn(uint32 timeMSToDespawn = 0);
 
@@ -867,8 +873,20 @@ class Creature : public Unit, public GridObject<Creature>, public MapObject
             m_MovementInform.push_back(std::make_pair(p_Type, p_ID));
         }
 
+        /// Players with a vignette following this creature, their vignette is moved when the creature is relocated
+        void AddVignetteTracker(uint64 p_PlayerGuid) const { m_VignetteTrackers.insert(p_PlayerGuid); }
+        void RemoveVignetteTracker(uint64 p_PlayerGuid) const { m_VignetteTrackers.erase(p_PlayerGuid); }
+        /// Called by Map once the creature is relocated
+        void UpdateVignettePositions()
+        {
+            if (!m_VignetteTrackers.empty())
+                PushVignettePositions();
+        }
+
     private:
         void DoRespawn();
+        void RegisterVignetteTrackers();
+        void PushVignettePositions();
 
         bool m_NeedRespawn;
         int m_RespawnFrameDelay;
@@ -908,6 +926,7 @@ class Creature : public Unit, public GridObject<Creature>, public MapObject
         bool m_AlreadySearchedAssistance;
         bool m_regenHealth;
         bool m_AI_locked;
+        FactoryHolder<CreatureAI, std::string> const* m_SpawnAIFactory;
 
         SpellSchoolMask m_meleeDamageSchoolMask;
         uint32 m_originalEntry;
@@ -946,6 +965,8 @@ class Creature : public Unit, public GridObject<Creature>, public MapObject
         bool TriggerJustRespawned;
 
         std::list<std::pair<uint32, uint32>> m_MovementInform;
+
+        mutable std::set<uint64> m_VignetteTrackers;
 };
 
 class AssistDelayEvent : public BasicEvent
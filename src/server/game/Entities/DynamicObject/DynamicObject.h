@@ -28,6 +28,8 @@ enum DynamicObjectType
 class DynamicObject : public WorldObject, public GridObject<DynamicObject>
 {
     public:
+        OBJECT_POOL_ALLOCATED(OBJECT_POOL_DYNAMICOBJECT)
+
         DynamicObject(bool isWorldObject);
         ~DynamicObject();
 
@@ -897,9 +897,9 @@ void GameObject::SaveToDB(uint32 mapid, uint32 spawnMask, uint32 phaseMask)
     WorldDatabase.CommitTransaction(trans);
 }
 
-bool GameObject::LoadGameObjectFromDB(uint32 guid, Map* map, bool addToMap)
+bool GameObject::LoadGameObjectFromDB(uint32 guid, Map* map, bool addToMap, GameObjectData const* p_Data)
 {
-    GameObjectData const* data = sObjectMgr->GetGOData(guid);
+    GameObjectData const* data = p_Data ? p_Data : sObjectMgr->GetGOData(guid);
 
     if (!data)
     {
@@ -2425,18 +2425,25 @@ void GameObject::BuildValuesUpdate(uint8 updateType, ByteBuffer* data, Player* t
     UpdateMask updateMask;
     updateMask.SetCount(m_valuesCount);
 
-    uint32* flags = GameObjectUpdateFieldFlags;
     uint32 visibleFlag = UF_FLAG_PUBLIC | UF_FLAG_VIEWER_DEPENDENT;
     if (GetOwnerGUID() == target->GetGUID())
         visibleFlag |= UF_FLAG_OWNER;
 
-    for (uint16 index = 0; index < m_valuesCount; ++index)
+    BuildValuesUpdateMask(updateType == UPDATETYPE_VALUES ? &_changesMask : nullptr, visibleFlag, _fieldNotifyFlags, updateMask);
+
+    updateMask.SetBit(OBJECT_FIELD_DYNAMIC_FLAGS);
+    updateMask.SetBit(GAMEOBJECT_FIELD_PERCENT_HEALTH);
+    if (forcedFlags)
+        updateMask.SetBit(GAMEOBJECT_FIELD_FLAGS);
+    if (IsTransport())
+        updateMask.SetBit(GAMEOBJECT_FIELD_LEVEL);
+
+    UpdateMask::ClientUpdateMaskType const* blocks = updateMask.GetBlocks();
+    for (uint32 block = 0; block < updateMask.GetBlockCount(); ++block)
     {
-        if (_fieldNotifyFlags & flags[index] ||
-            ((updateType == UPDATETYPE_VALUES ? _changesMask.GetBit(index) : m_uint32Values[index]) && (flags[index] & visibleFlag)) ||
-            (index == GAMEOBJECT_FIELD_FLAGS && forcedFlags) || index == OBJECT_FIELD_DYNAMIC_FLAGS || index == GAMEOBJECT_FIELD_PERCENT_HEALTH || (index == GAMEOBJECT_FIELD_LEVEL && IsTransport()))
+        for (UpdateMask::ClientUpdateMaskType bits = blocks[block]; bits; bits &= bits - 1)
         {
-            updateMask.SetBit(index);
+            uint16 index = uint16(block * UpdateMask::CLIENT_UPDATE_MASK_BITS + UpdateMask::GetLowestBit(bits));
 
             if (index == OBJECT_FIELD_DYNAMIC_FLAGS)
             {
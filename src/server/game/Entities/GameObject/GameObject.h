@@ -932,6 +932,8 @@ enum eGoBCustomFlags
 class GameObject : public WorldObject, public GridObject<GameObject>, public MapObject
 {
     public:
+        OBJECT_POOL_ALLOCATED(OBJECT_POOL_GAMEOBJECT)
+
         explicit GameObject();
         ~GameObject();
 
@@ -969,8 +971,9 @@ class GameObject : public WorldObject, public GridObject<GameObject>, public Map
 
         void SaveToDB();
         void SaveToDB(uint32 mapid, uint32 spawnMask, uint32 phaseMask);
-        bool LoadFromDB(uint32 guid, Map* map) { return LoadGameObjectFromDB(guid, map, false); }
-        bool LoadGameObjectFromDB(uint32 guid, Map* map, bool addToMap = true);
+        bool LoadFromDB(uint32 guid, Map* map, GameObjectData const* p_Data = nullptr) { return LoadGameObjectFromDB(guid, map, false, p_Data); }
+        /// p_Data is the spawn data of guid when the caller already looked it up
+        bool LoadGameObjectFromDB(uint32 guid, Map* map, bool addToMap = true, GameObjectData const* p_Data = nullptr);
         void DeleteFromDB();
 
         void SetOwnerGUID(uint64 owner)
@@ -19,6 +19,7 @@
 #include "ObjectMgr.h"
 #include "UpdateData.h"
 #include "UpdateMask.h"
+#include "UpdateFieldVisibility.h"
 #include "Util.h"
 #include "MapManager.h"
 #include "ObjectAccessor.h"
@@ -853,28 +854,15 @@ void Object::BuildValuesUpdate(uint8 updateType, ByteBuffer* data, Player* targe
     uint32* flags = NULL;
     uint32 visibleFlag = GetUpdateFieldData(target, flags);
 
-    int sendedCount = 0;
+    BuildValuesUpdateMask(updateType == UPDATETYPE_VALUES ? &_changesMask : nullptr, visibleFlag, _fieldNotifyFlags, updateMask);
 
-    for (uint16 index = 0; index < m_valuesCount; ++index)
+    UpdateMask::ClientUpdateMaskType const* blocks = updateMask.GetBlocks();
+    for (uint32 block = 0; block < updateMask.GetBlockCount(); ++block)
     {
-        if (_fieldNotifyFlags & flags[index] ||
-            ((updateType == UPDATETYPE_VALUES ? _changesMask.GetBit(index) : m_uint32Values[index]) && (flags[index] & visibleFlag)))
-        {
-            updateMask.SetBit(index);
-            fieldBuffer << m_uint32Values[index];
-
-            ++sendedCount;
-        }
-    }
-
-    for (uint16 index = 0; index < m_valuesCount; ++index)
-    {
-        if (updateMask.GetBit(index))
-            --sendedCount;
+        for (UpdateMask::ClientUpdateMaskType bits = blocks[block]; bits; bits &= bits - 1)
+            fieldBuffer << m_uint32Values[block * UpdateMask::CLIENT_UPDATE_MASK_BITS + UpdateMask::GetLowestBit(bits)];
     }
 
-    ASSERT(sendedCount == 0);
-
     *data << uint8(updateMask.GetBlockCount());
     updateMask.AppendToPacket(data);
     data->append(fieldBuffer);
@@ -1038,6 +1026,76 @@ uint32 Object::GetUpdateFieldData(Player const* target, uint32*& flags) const
     return visibleFlag;
 }
 
+UpdateFieldVisibility const* Object::GetUpdateFieldVisibility() const
+{
+    switch (GetTypeId())
+    {
+        case TYPEID_ITEM:
+        case TYPEID_CONTAINER:
+            return &ContainerUpdateFieldVisibility;
+        case TYPEID_UNIT:
+        case TYPEID_PLAYER:
+            return &PlayerUpdateFieldVisibility;
+        case TYPEID_GAMEOBJECT:
+            return &GameObjectUpdateFieldVisibility;
+        case TYPEID_DYNAMICOBJECT:
+            return &DynamicObjectUpdateFieldVisibility;
+        case TYPEID_CORPSE:
+            return &CorpseUpdateFieldVisibility;
+        case TYPEID_AREATRIGGER:
+            return &AreaTriggerUpdateFieldVisibility;
+        case TYPEID_SCENEOBJECT:
+            return &SceneObjectUpdateFieldVisibility;
+        case TYPEID_CONVERSATION:
+            return &ConversationUpdateFieldVisibility;
+        default:
+            return nullptr;
+    }
+}
+
+void Object::BuildValuesUpdateMask(UpdateMask const* p_Changes, uint32 p_VisibleFlags, uint32 p_ForcedFlags, UpdateMask& p_Mask) const
+{
+    typedef UpdateMask::ClientUpdateMaskType Block;
+
+    UpdateFieldVisibility const* l_Visibility = GetUpdateFieldVisibility();
+    if (!l_Visibility)
+        return;
+
+    uint32 l_BlockCount = p_Mask.GetBlockCount();
+    ASSERT(l_BlockCount <= l_Visibility->GetBlockCount());
+
+    Block* l_Blocks = p_Mask.GetBlocks();
+    Block const* l_Visible = l_Visibility->GetVisibleMask(p_VisibleFlags);
+
+    if (p_Changes)
+    {
+        /// Plain loops over whole blocks, vectorized by the compiler
+        Block const* l_Changes = p_Changes->GetBlocks();
+        for (uint32 l_Block = 0; l_Block < l_BlockCount; ++l_Block)
+            l_Blocks[l_Block] = l_Changes[l_Block] & l_Visible[l_Block];
+    }
+    else
+    {
+        for (uint32 l_Block = 0; l_Block < l_BlockCount; ++l_Block)
+        {
+            uint32 l_First = l_Block * UpdateMask::CLIENT_UPDATE_MASK_BITS;
+            uint32 l_Count = std::min<uint32>(UpdateMask::CLIENT_UPDATE_MASK_BITS, m_valuesCount - l_First);
+
+            Block l_NonZero = 0;
+            for (uint32 l_Bit = 0; l_Bit < l_Count; ++l_Bit)
+                l_NonZero |= Block(m_uint32Values[l_First + l_Bit] != 0) << l_Bit;
+
+            l_Blocks[l_Block] = l_NonZero & l_Visible[l_Block];
+        }
+    }
+
+    l_Visibility->AddFlagMask(p_ForcedFlags, l_Blocks, l_BlockCount);
+
+    /// The masks cover the biggest type sharing the table (players for the units), drop the fields past the end of this one
+    if (uint32 l_Tail = m_valuesCount % UpdateMask::CLIENT_UPDATE_MASK_BITS)
+        l_Blocks[l_BlockCount - 1] &= (Block(1) << l_Tail) - 1;
+}
+
 uint32 Object::GetDynamicUpdateFieldData(Player const* target, uint32*& flags) const
 {
     uint32 visibleFlag = UF_FLAG_PUBLIC;
@@ -3504,9 +3562,7 @@ void WorldObject::GetCreatureListInGrid(std::list<Creature*>& creatureList, floa
 
 void WorldObject::GetPlayerListInGrid(std::list<Player*>& playerList, float maxSearchRange, bool p_Self /*= false*/) const
 {
-    JadeCore::AnyPlayerInObjectRangeCheck checker(this, maxSearchRange, true, p_Self);
-    JadeCore::PlayerListSearcher<JadeCore::AnyPlayerInObjectRangeCheck> searcher(this, playerList, checker);
-    VisitNearbyWorldObject(maxSearchRange, searcher);
+    GetMap()->GetPlayerListInRange(this, maxSearchRange, playerList, true, p_Self);
 }
 
 void WorldObject::GetGameObjectListWithEntryInGridAppend(std::list<GameObject*>& gameobjectList, uint32 entry, float maxSearchRange) const
@@ -16,6 +16,7 @@
 #include "ObjectDefines.h"
 #include "GridDefines.h"
 #include "Map.h"
+#include "ObjectPool.h"
 #include "UpdateMask.h"
 
 
@@ -102,6 +103,7 @@ class WorldSession;
 class Creature;
 class Player;
 class UpdateMask;
+class UpdateFieldVisibility;
 class InstanceScript;
 class GameObject;
 class TempSummon;
@@ -383,6 +385,13 @@ class Object
         // FG: some hacky helpers
         void ForceValuesUpdateAtIndex(uint32);
 
+        /// Precomputed field masks of the type of the object, null for TYPEID_OBJECT
+        UpdateFieldVisibility const* GetUpdateFieldVisibility() const;
+
+        /// Fields of a values update, built a block at a time from the precomputed masks.
+        /// p_Changes is null for a create (every non zero field), fields having one of p_ForcedFlags are sent even unchanged.
+        void BuildValuesUpdateMask(UpdateMask const* p_Changes, uint32 p_VisibleFlags, uint32 p_ForcedFlags, UpdateMask& p_Mask) const;
+
         Player* ToPlayer() { if (IsPlayer()) return reinterpret_cast<Player*>(this); else return NULL; }
         Player const* ToPlayer() const { if (IsPlayer()) return reinterpret_cast<Player const*>(this); else return NULL; }
         bool IsPlayer() const { return m_objectTypeId == TYPEID_PLAYER; }
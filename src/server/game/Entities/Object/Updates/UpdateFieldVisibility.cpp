@@ -0,0 +1,93 @@
+////////////////////////////////////////////////////////////////////////////////
+//
+//  MILLENIUM-STUDIO
+//  Copyright 2016 Millenium-studio SARL
+//  All Rights Reserved.
+//
+////////////////////////////////////////////////////////////////////////////////
+
+#include "UpdateFieldVisibility.h"
+
+/// The flag tables are constant initialized, so they are filled before these are built
+UpdateFieldVisibility const ContainerUpdateFieldVisibility(ContainerUpdateFieldFlags, CONTAINER_END);
+UpdateFieldVisibility const PlayerUpdateFieldVisibility(PlayerUpdateFieldFlags, PLAYER_END);
+UpdateFieldVisibility const GameObjectUpdateFieldVisibility(GameObjectUpdateFieldFlags, GAMEOBJECT_END);
+UpdateFieldVisibility const DynamicObjectUpdateFieldVisibility(DynamicObjectUpdateFieldFlags, DYNAMICOBJECT_END);
+UpdateFieldVisibility const CorpseUpdateFieldVisibility(CorpseUpdateFieldFlags, CORPSE_END);
+UpdateFieldVisibility const AreaTriggerUpdateFieldVisibility(AreaTriggerUpdateFieldFlags, AREATRIGGER_END);
+UpdateFieldVisibility const SceneObjectUpdateFieldVisibility(SceneObjectUpdateFieldFlags, SCENEOBJECT_END);
+UpdateFieldVisibility const ConversationUpdateFieldVisibility(ConversationUpdateFieldFlags, CONVERSATION_END);
+
+UpdateFieldVisibility::UpdateFieldVisibility(uint32 const* p_Flags, uint32 p_Count)
+{
+    m_BlockCount = (p_Count + UpdateMask::CLIENT_UPDATE_MASK_BITS - 1) / UpdateMask::CLIENT_UPDATE_MASK_BITS;
+
+    for (uint32 l_Relation = 0; l_Relation < UF_RELATION_COUNT; ++l_Relation)
+        m_Visible[l_Relation].assign(m_BlockCount, 0);
+
+    for (uint32 l_Flag = 0; l_Flag < UPDATEFIELD_FLAG_COUNT; ++l_Flag)
+        m_ByFlag[l_Flag].assign(m_BlockCount, 0);
+
+    for (uint32 l_Index = 0; l_Index < p_Count; ++l_Index)
+    {
+        uint32 l_Block = l_Index / UpdateMask::CLIENT_UPDATE_MASK_BITS;
+        Block l_Bit = Block(1) << (l_Index % UpdateMask::CLIENT_UPDATE_MASK_BITS);
+
+        for (uint32 l_Flag = 0; l_Flag < UPDATEFIELD_FLAG_COUNT; ++l_Flag)
+        {
+            if (p_Flags[l_Index] & (1 << l_Flag))
+                m_ByFlag[l_Flag][l_Block] |= l_Bit;
+        }
+
+        for (uint32 l_Relation = 0; l_Relation < UF_RELATION_COUNT; ++l_Relation)
+        {
+            uint32 l_VisibleFlags = UF_FLAG_PUBLIC | UF_FLAG_VIEWER_DEPENDENT;
+            if (l_Relation & UF_RELATION_SELF)
+                l_VisibleFlags |= UF_FLAG_PRIVATE;
+            if (l_Relation & UF_RELATION_OWNER)
+                l_VisibleFlags |= UF_FLAG_OWNER;
+            if (l_Relation & UF_RELATION_SPECIAL_INFO)
+                l_VisibleFlags |= UF_FLAG_SPECIAL_INFO;
+            if (l_Relation & UF_RELATION_PARTY_MEMBER)
+                l_VisibleFlags |= UF_FLAG_PARTY_MEMBER;
+
+            if (p_Flags[l_Index] & l_VisibleFlags)
+                m_Visible[l_Relation][l_Block] |= l_Bit;
+        }
+    }
+}
+
+uint32 UpdateFieldVisibility::GetRelation(uint32 p_VisibleFlags)
+{
+    uint32 l_Relation = 0;
+
+    if (p_VisibleFlags & UF_FLAG_PRIVATE)
+        l_Relation |= UF_RELATION_SELF;
+    if (p_VisibleFlags & UF_FLAG_OWNER)
+        l_Relation |= UF_RELATION_OWNER;
+    if (p_VisibleFlags & UF_FLAG_SPECIAL_INFO)
+        l_Relation |= UF_RELATION_SPECIAL_INFO;
+    if (p_VisibleFlags & UF_FLAG_PARTY_MEMBER)
+        l_Relation |= UF_RELATION_PARTY_MEMBER;
+
+    return l_Relation;
+}
+
+void UpdateFieldVisibility::AddFlagMask(uint32 p_Flags, Block* p_Mask, uint32 p_BlockCount) const
+{
+    for (uint32 l_Flag = 0; l_Flag < UPDATEFIELD_FLAG_COUNT; ++l_Flag)
+    {
+        if (!(p_Flags & (1 << l_Flag)))
+            continue;
+
+        /// Plain loop over whole blocks, vectorized by the compiler
+        Block const* l_FlagMask = m_ByFlag[l_Flag].data();
+        for (uint32 l_Block = 0; l_Block < p_BlockCount; ++l_Block)
+            p_Mask[l_Block] |= l_FlagMask[l_Block];
+    }
+}
+
+size_t UpdateFieldVisibility::GetMemorySize() const
+{
+    return sizeof(*this) + (UF_RELATION_COUNT + UPDATEFIELD_FLAG_COUNT) * m_BlockCount * sizeof(Block);
+}
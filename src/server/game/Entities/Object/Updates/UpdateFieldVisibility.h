@@ -0,0 +1,67 @@
+////////////////////////////////////////////////////////////////////////////////
+//
+//  MILLENIUM-STUDIO
+//  Copyright 2016 Millenium-studio SARL
+//  All Rights Reserved.
+//
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef _UPDATEFIELDVISIBILITY_H
+#define _UPDATEFIELDVISIBILITY_H
+
+#include "Define.h"
+#include "UpdateFieldFlags.h"
+#include "UpdateMask.h"
+
+#include <vector>
+
+/// Relation of the viewer to the object, the part of the visible flags of Object::GetUpdateFieldData depending on the viewer.
+/// UF_FLAG_PUBLIC and UF_FLAG_VIEWER_DEPENDENT are visible to everyone.
+enum UpdateFieldRelation
+{
+    UF_RELATION_SELF            = 0x01,                     ///< UF_FLAG_PRIVATE
+    UF_RELATION_OWNER           = 0x02,                     ///< UF_FLAG_OWNER
+    UF_RELATION_SPECIAL_INFO    = 0x04,                     ///< UF_FLAG_SPECIAL_INFO, empathy
+    UF_RELATION_PARTY_MEMBER    = 0x08,                     ///< UF_FLAG_PARTY_MEMBER
+    UF_RELATION_COUNT           = 0x10
+};
+
+#define UPDATEFIELD_FLAG_COUNT 11                           ///< Bits used by UpdatefieldFlags
+
+/// Value fields of an object type visible to each viewer relation, and fields having each flag, as packed
+/// UpdateMask blocks built once from the UpdateFieldFlags table of the type.
+/// A values update mask is then a few AND / OR per block instead of a flag test per field.
+class UpdateFieldVisibility
+{
+    public:
+        typedef UpdateMask::ClientUpdateMaskType Block;
+
+        UpdateFieldVisibility(uint32 const* p_Flags, uint32 p_Count);
+
+        static uint32 GetRelation(uint32 p_VisibleFlags);
+
+        /// Fields visible with the flags returned by Object::GetUpdateFieldData
+        Block const* GetVisibleMask(uint32 p_VisibleFlags) const { return m_Visible[GetRelation(p_VisibleFlags)].data(); }
+
+        /// OR the fields having any of p_Flags into the first p_BlockCount blocks of p_Mask
+        void AddFlagMask(uint32 p_Flags, Block* p_Mask, uint32 p_BlockCount) const;
+
+        uint32 GetBlockCount() const { return m_BlockCount; }
+        size_t GetMemorySize() const;
+
+    private:
+        uint32 m_BlockCount;
+        std::vector<Block> m_Visible[UF_RELATION_COUNT];
+        std::vector<Block> m_ByFlag[UPDATEFIELD_FLAG_COUNT];
+};
+
+extern UpdateFieldVisibility const ContainerUpdateFieldVisibility;
+extern UpdateFieldVisibility const PlayerUpdateFieldVisibility;
+extern UpdateFieldVisibility const GameObjectUpdateFieldVisibility;
+extern UpdateFieldVisibility const DynamicObjectUpdateFieldVisibility;
+extern UpdateFieldVisibility const CorpseUpdateFieldVisibility;
+extern UpdateFieldVisibility const AreaTriggerUpdateFieldVisibility;
+extern UpdateFieldVisibility const SceneObjectUpdateFieldVisibility;
+extern UpdateFieldVisibility const ConversationUpdateFieldVisibility;
+
+#endif // _UPDATEFIELDVISIBILITY_H
@@ -13,6 +13,11 @@
 #include "Errors.h"
 #include "ByteBuffer.h"
 
+#if COMPILER == COMPILER_MICROSOFT
+#  include <intrin.h>
+#endif
+
+/// One bit per field, packed the way the client reads it: bit j of block i is field i * CLIENT_UPDATE_MASK_BITS + j
 class UpdateMask
 {
     public:
@@ -26,11 +31,11 @@ class UpdateMask
 
         UpdateMask() : _fieldCount(0), _blockCount(0), _bits(nullptr) { }
 
-        UpdateMask(UpdateMask const& right) : _bits(nullptr)
+        UpdateMask(UpdateMask const& right) : _fieldCount(0), _blockCount(0), _bits(nullptr)
         {
             SetCount(right.GetCount());
             if (right._bits)
-                memcpy(_bits, right._bits, sizeof (uint8) * _blockCount * 32);
+                memcpy(_bits, right._bits, sizeof(ClientUpdateMaskType) * _blockCount);
         }
 
         ~UpdateMask()
@@ -42,25 +47,20 @@ class UpdateMask
             }
         }
 
-        void SetBit(uint32 index) { _bits[index] = 1; }
-        void UnsetBit(uint32 index) { _bits[index] = 0; }
-        bool GetBit(uint32 index) const { return _bits[index] != 0; }
+        void SetBit(uint32 index) { _bits[index / CLIENT_UPDATE_MASK_BITS] |= ClientUpdateMaskType(1) << (index % CLIENT_UPDATE_MASK_BITS); }
+        void UnsetBit(uint32 index) { _bits[index / CLIENT_UPDATE_MASK_BITS] &= ~(ClientUpdateMaskType(1) << (index % CLIENT_UPDATE_MASK_BITS)); }
+        bool GetBit(uint32 index) const { return ((_bits[index / CLIENT_UPDATE_MASK_BITS] >> (index % CLIENT_UPDATE_MASK_BITS)) & 1) != 0; }
 
         void AppendToPacket(ByteBuffer* data)
         {
             for (uint32 i = 0; i < GetBlockCount(); ++i)
-            {
-                ClientUpdateMaskType maskPart = 0;
-                for (uint32 j = 0; j < CLIENT_UPDATE_MASK_BITS; ++j)
-                {
-                    if (_bits[CLIENT_UPDATE_MASK_BITS * i + j])
-                        maskPart |= 1 << j;
-                }
-
-                *data << maskPart;
-            }
+                *data << _bits[i];
         }
 
+        /// Whole blocks, for the masks built word at a time (see Object::BuildValuesUpdate)
+        ClientUpdateMaskType* GetBlocks() { return _bits; }
+        ClientUpdateMaskType const* GetBlocks() const { return _bits; }
+
         uint32 GetBlockCount() const { return _blockCount; }
         uint32 GetCount() const { return _fieldCount; }
 
@@ -78,21 +78,21 @@ class UpdateMask
             if (!valuesCount)
                 return;
 
-            _bits = new uint8[_blockCount * CLIENT_UPDATE_MASK_BITS];
-            memset(_bits, 0, sizeof (uint8) * _blockCount * CLIENT_UPDATE_MASK_BITS);
+            _bits = new ClientUpdateMaskType[_blockCount];
+            memset(_bits, 0, sizeof(ClientUpdateMaskType) * _blockCount);
         }
 
         void AddBlock()
         {
-            uint8* curr = _bits;
+            ClientUpdateMaskType* curr = _bits;
             _fieldCount += CLIENT_UPDATE_MASK_BITS;
             ++_blockCount;
 
-            _bits = new uint8[_blockCount * CLIENT_UPDATE_MASK_BITS];
-            memset(&_bits[(_blockCount - 1) * CLIENT_UPDATE_MASK_BITS], 0, sizeof (uint8) * CLIENT_UPDATE_MASK_BITS);
+            _bits = new ClientUpdateMaskType[_blockCount];
+            _bits[_blockCount - 1] = 0;
             if (curr)
             {
-                memcpy(_bits, curr, sizeof (uint8) * (_blockCount - 1) * CLIENT_UPDATE_MASK_BITS);
+                memcpy(_bits, curr, sizeof(ClientUpdateMaskType) * (_blockCount - 1));
                 delete[] curr;
             }
         }
@@ -100,7 +100,7 @@ class UpdateMask
         void Clear()
         {
             if (_bits)
-                memset(_bits, 0, sizeof (uint8) * _blockCount * CLIENT_UPDATE_MASK_BITS);
+                memset(_bits, 0, sizeof(ClientUpdateMaskType) * _blockCount);
         }
 
         UpdateMask& operator=(UpdateMask const& right)
@@ -109,14 +109,15 @@ class UpdateMask
                 return *this;
 
             SetCount(right.GetCount());
-            memcpy(_bits, right._bits, sizeof (uint8) * _blockCount * CLIENT_UPDATE_MASK_BITS);
+            if (right._bits)
+                memcpy(_bits, right._bits, sizeof(ClientUpdateMaskType) * _blockCount);
             return *this;
         }
 
         UpdateMask& operator&=(UpdateMask const& right)
         {
             ASSERT(right.GetCount() <= GetCount());
-            for (uint32 i = 0; i < _fieldCount; ++i)
+            for (uint32 i = 0; i < right._blockCount; ++i)
                 _bits[i] &= right._bits[i];
 
             return *this;
@@ -125,7 +126,7 @@ class UpdateMask
         UpdateMask& operator|=(UpdateMask const& right)
         {
             ASSERT(right.GetCount() <= GetCount());
-            for (uint32 i = 0; i < _fieldCount; ++i)
+            for (uint32 i = 0; i < right._blockCount; ++i)
                 _bits[i] |= right._bits[i];
 
             return *this;
@@ -138,10 +139,22 @@ class UpdateMask
             return ret;
         }
 
+        /// Index of the lowest set bit of a non zero block, to walk the set fields in order
+        static uint32 GetLowestBit(ClientUpdateMaskType block)
+        {
+#if COMPILER == COMPILER_MICROSOFT
+            unsigned long index;
+            _BitScanForward(&index, block);
+            return uint32(index);
+#else
+            return uint32(__builtin_ctz(block));
+#endif
+        }
+
     private:
         uint32 _fieldCount;
         uint32 _blockCount;
-        uint8* _bits;
+        ClientUpdateMaskType* _bits;
 };
 
 #endif
@@ -68,6 +68,7 @@
 #include "UpdateFieldFlags.h"
 #include "SceneObject.h"
 #include "PetBattle.h"
+#include "WildBattlePet.h"
 #include "MSCallback.hpp"
 #include "Vignette.hpp"
 #include "WowTime.hpp"
@@ -7606,6 +7607,12 @@ void Player::CleanupChannels()
     sLog->outDebug(LOG_FILTER_CHATSYS, "Player: channels cleaned up!");
 }
 
+void Player::UpdateChannelsIgnore(uint64 p_Guid, bool p_Ignored)
+{
+    for (Channel* l_Channel : m_channels)
+        l_Channel->UpdateIgnore(GetGUID(), p_Guid, p_Ignored);
+}
+
 void Player::UpdateChatLocaleFiltering()
 {
     for (auto l_It = m_channels.begin(); l_It != m_channels.end(); ++l_It)
@@ -23622,6 +23629,10 @@ void Player::SaveToDB(bool create /*=false*/, MS::Utilities::CallBackPtr p_Callb
         return;
     }
 
+    /// Apply the criteria events still queued, those queued while the player is off a map would be lost at logout,
+    /// their progress is then saved with the rest of the achievements below
+    ProcessAchievementCriteriaEvents();
+
     // first save/honor gain after midnight will also update the player's honor fields
     UpdateHonorFields();
 
@@ -27739,11 +27750,22 @@ inline void UpdateVisibilityOf_helper(GuidUnorderedSet& s64, GameObject* target,
         s64.insert(target->GetGUID());
 }
 
+/// First time a wild battle pet gets visible to a player
+inline void OnWildBattlePetObserved(Creature* p_Creature)
+{
+    if (!p_Creature->m_IsUnobservedWildBattlePet)
+        return;
+
+    p_Creature->m_IsUnobservedWildBattlePet = false;
+    ++WildBattlePetMgr::s_Observed;
+}
+
 template<>
 inline void UpdateVisibilityOf_helper(GuidUnorderedSet& s64, Creature* target, std::set<Unit*>& v)
 {
     s64.insert(target->GetGUID());
     v.insert(target);
+    OnWildBattlePetObserved(target);
 }
 
 template<>
@@ -27791,6 +27813,9 @@ void Player::UpdateVisibilityOf(WorldObject* target)
             m_clientGUIDs.insert(target->GetGUID());
             m_VignetteMgr.OnWorldObjectAppear(target);
 
+            if (target->GetTypeId() == TYPEID_UNIT)
+                OnWildBattlePetObserved(target->ToCreature());
+
             #ifdef TRINITY_DEBUG
                 sLog->outDebug(LOG_FILTER_MAPS, "Object %u (Type: %u) is visible now for player %u. Distance = %f", target->GetGUIDLow(), target->GetTypeId(), GetGUIDLow(), GetDistance(target));
             #endif
@@ -31047,39 +31072,64 @@ void Player::UpdateAchievementCriteria(AchievementCriteriaTypes p_Type, uint64 p
     if (sWorld->getBoolConfig(CONFIG_ACHIEVEMENT_DISABLE))
         return;
 
-    AchievementCriteriaUpdateTask l_Task;
-    l_Task.PlayerGUID = GetGUID();
-    l_Task.UnitGUID   = p_Unit ? p_Unit->GetGUID() : 0;
-    l_Task.Task = [p_Type, p_MiscValue1, p_MiscValue2, p_MiscValue3, p_LoginCheck](uint64 const& p_PlayerGuid, uint64 const& p_UnitGUID) -> void
+    AchievementCriteriaQueuedEvent l_Event;
+    l_Event.UnitGUID   = p_Unit ? p_Unit->GetGUID() : 0;
+    l_Event.MiscValue1 = p_MiscValue1;
+    l_Event.MiscValue2 = p_MiscValue2;
+    l_Event.MiscValue3 = p_MiscValue3;
+    l_Event.Type       = p_Type;
+    l_Event.LoginCheck = p_LoginCheck;
+    l_Event.PlayerOnly = false;
+
+    QueueAchievementCriteriaEvent(l_Event);
+}
+
+void Player::QueueAchievementCriteriaEvent(AchievementCriteriaQueuedEvent const& p_Event)
+{
+    std::lock_guard<std::mutex> l_Guard(m_PendingCriteriaEventsLock);
+    sAchievementMgr->AddCriteriaEvent(m_PendingCriteriaEvents, p_Event);
+}
+
+void Player::ProcessAchievementCriteriaEvents()
+{
     {
-        /// Task will be executed async
-        /// We need to ensure the player still exist
-        Player* l_Player = HashMapHolder<Player>::Find(p_PlayerGuid);
-        if (l_Player == nullptr)
+        std::lock_guard<std::mutex> l_Guard(m_PendingCriteriaEventsLock);
+        if (m_PendingCriteriaEvents.empty())
             return;
 
-        /// Same for the unit
-        Unit* l_Unit = p_UnitGUID ? Unit::GetUnit(*l_Player, p_UnitGUID) : nullptr;
+        /// Events queued while processing wait for the next update
+        m_ProcessedCriteriaEvents.swap(m_PendingCriteriaEvents);
+    }
+
+#ifndef CROSS
+    Guild* l_Guild = sGuildMgr->GetGuildById(GetGuildId());
+#endif
+
+    for (AchievementCriteriaQueuedEvent const& l_Event : m_ProcessedCriteriaEvents)
+    {
+        AchievementCriteriaTypes l_Type = AchievementCriteriaTypes(l_Event.Type);
+        /// No unit lookup when flushed off a map from SaveToDB
+        Unit* l_Unit = l_Event.UnitGUID && FindMap() ? Unit::GetUnit(*this, l_Event.UnitGUID) : nullptr;
 
-        l_Player->GetAchievementMgr().UpdateAchievementCriteria(p_Type, p_MiscValue1, p_MiscValue2, p_MiscValue3, l_Unit, l_Player, p_LoginCheck);
+        m_achievementMgr.UpdateAchievementCriteria(l_Type, l_Event.MiscValue1, l_Event.MiscValue2, l_Event.MiscValue3, l_Unit, this, l_Event.LoginCheck);
 
         // Update only individual achievement criteria here, otherwise we may get multiple updates
         // from a single boss kill
-        if (sAchievementMgr->IsGroupCriteriaType(p_Type))
-            return;
+        if (l_Event.PlayerOnly || sAchievementMgr->IsGroupCriteriaType(l_Type))
+            continue;
 
 #ifndef CROSS
-        if (Guild* l_Guild = sGuildMgr->GetGuildById(l_Player->GetGuildId()))
-            l_Guild->GetAchievementMgr().UpdateAchievementCriteria(p_Type, p_MiscValue1, p_MiscValue2, p_MiscValue3, l_Unit, l_Player, p_LoginCheck);
+        if (l_Guild)
+            l_Guild->GetAchievementMgr().UpdateAchievementCriteria(l_Type, l_Event.MiscValue1, l_Event.MiscValue2, l_Event.MiscValue3, l_Unit, this, l_Event.LoginCheck);
 #else /* CROSS */
         /// @TODO: Cross sync
-        //if (Guild* l_Guild = sGuildMgr->GetGuildById(l_Player->GetGuildId()))
-        //    l_Guild->GetAchievementMgr().UpdateAchievementCriteria(p_Type, p_MiscValue1, p_MiscValue2, p_MiscValue3, l_Unit, l_Player, p_LoginCheck);
+        //if (Guild* l_Guild = sGuildMgr->GetGuildById(GetGuildId()))
+        //    l_Guild->GetAchievementMgr().UpdateAchievementCriteria(l_Type, l_Event.MiscValue1, l_Event.MiscValue2, l_Event.MiscValue3, l_Unit, this, l_Event.LoginCheck);
 #endif /* CROSS */
-        
-    };
+    }
 
-    sAchievementMgr->AddCriteriaUpdateTask(l_Task);
+    sAchievementMgr->AddProcessedCriteriaEvents(uint32(m_ProcessedCriteriaEvents.size()));
+    m_ProcessedCriteriaEvents.clear();
 }
 
 void Player::CompletedAchievement(AchievementEntry const* entry)
@@ -35684,6 +35734,9 @@ void Player::RemovePlayer()
     uint64 realguid = GetRealGUID();
     uint64 newguid = GetGUID();
 
+    ///- Leave all channels before the session is deleted, their members keep the session
+    CleanupChannels();
+
     CleanupsBeforeDelete();
 
     if (pSession)
@@ -35699,6 +35752,9 @@ void Player::RemovePlayer()
         delete pSession;
     }
 
+    if (Map* l_Map = FindMap())
+        l_Map->GetPlayerSpatialHash().Remove(this);
+
     if (IsInGrid())
         RemoveFromGrid();
 
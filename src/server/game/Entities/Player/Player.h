@@ -2753,6 +2753,8 @@ class Player : public Unit, public GridObject<Player>
         void JoinedChannel(Channel* c);
         void LeftChannel(Channel* c);
         void CleanupChannels();
+        /// Forward an ignore list change to the channels fan-out
+        void UpdateChannelsIgnore(uint64 p_Guid, bool p_Ignored);
         void UpdateChatLocaleFiltering();
         void UpdateLocalChannels(uint32 newZone);
         void LeaveLFGChannel();
@@ -3361,6 +3363,9 @@ class Player : public Unit, public GridObject<Player>
         AchievementMgr<Player>& GetAchievementMgr() { return m_achievementMgr; }
         AchievementMgr<Player> const& GetAchievementMgr() const { return m_achievementMgr; }
         void UpdateAchievementCriteria(AchievementCriteriaTypes type, uint64 miscValue1 = 0, uint64 miscValue2 = 0, uint64 miscValue3 = 0, Unit* unit = NULL, bool p_LoginCheck = false);
+        void QueueAchievementCriteriaEvent(AchievementCriteriaQueuedEvent const& p_Event);
+        /// Run the criteria updates queued since the last call, from the map update and from SaveToDB
+        void ProcessAchievementCriteriaEvents();
         void CompletedAchievement(AchievementEntry const* entry);
 
         bool HasTitle(uint32 bitIndex);
@@ -4194,6 +4199,9 @@ class Player : public Unit, public GridObject<Player>
         uint32 m_oldpetspell;
 
         AchievementMgr<Player> m_achievementMgr;
+        std::mutex m_PendingCriteriaEventsLock;
+        AchievementCriteriaEventQueue m_PendingCriteriaEvents;      ///< Filled from any thread
+        AchievementCriteriaEventQueue m_ProcessedCriteriaEvents;    ///< Swapped with m_PendingCriteriaEvents by the map, keeps its capacity
         ReputationMgr  m_reputationMgr;
 
         SpellCooldowns m_spellCooldowns;
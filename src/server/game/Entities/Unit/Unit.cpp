@@ -298,6 +298,7 @@ Unit::Unit(bool isWorldObject): WorldObject(isWorldObject)
 
     m_IsInKillingProcess = false;
     m_VisibilityUpdScheduled = false;
+    m_VisibilityUpdateSlot = NoVisibilityUpdateSlot;
 
     for (int i = 0; i < MAX_POWERS; ++i) ///< Comparison of integers of different signs: 'int' and 'Powers'
         m_lastRegenTime[i] = getMSTime();
@@ -16339,6 +16340,9 @@ void Unit::RemoveFromWorld()
             }
         }
 
+        if (IsVisibilityUpdatePending())
+            GetMap()->CancelVisibilityUpdate(this);
+
         WorldObject::RemoveFromWorld();
         m_duringRemoveFromWorld = false;
     }
@@ -20222,61 +20226,34 @@ public:
     }
 };
 
-float g_RequiredMoveDistanceSq[6] =
-{
-    20.0f,  ///< MAP_COMMON
-    25.0f,  ///< MAP_INSTANCE
-    25.0f,  ///< MAP_RAID
-    16.0f,  ///< MAP_BATTLEGROUND,
-     1.0f,  ///< MAP_ARENA
-    25.0f   ///< MAP_SCENARIO
-};
-
-class Unit::VisibilityUpdateTask : public BasicEvent
+bool Unit::UpdateVisibilityAfterMove(float p_MinDistanceSq)
 {
-    Unit& m_owner;
-public:
-    explicit VisibilityUpdateTask(Unit * me) : BasicEvent(), m_owner(*me) {}
-
-    virtual bool Execute(uint64 , uint32)
-    {
-        UpdateVisibility(&m_owner);
-        return true;
-    }
-
-    static void UpdateVisibility(Unit* me)
+    if (!m_sharedVision.empty())
     {
-        if (!me->m_sharedVision.empty())
+        for (SharedVisionList::const_iterator l_Itr = m_sharedVision.begin(); l_Itr != m_sharedVision.end();)
         {
-            for (SharedVisionList::const_iterator it = me->m_sharedVision.begin(); it != me->m_sharedVision.end();)
-            {
-                Player * tmp = *it;
-                ++it;
-                tmp->UpdateVisibilityForPlayer();
-            }
+            Player* l_Player = *l_Itr;
+            ++l_Itr;
+            l_Player->UpdateVisibilityForPlayer();
         }
+    }
 
-        Map* l_Map = me->FindMap();
-        if (!l_Map)
-            return;
-
-        float l_DistanceX = me->m_LastNotifyPosition.GetPositionX() - me->GetPositionX();
-        float l_DistanceY = me->m_LastNotifyPosition.GetPositionY() - me->GetPositionY();
-        float l_DistanceZ = me->m_LastNotifyPosition.GetPositionZ() - me->GetPositionZ();
-        float l_DistanceSQ = l_DistanceX*l_DistanceX + l_DistanceY*l_DistanceY + l_DistanceZ*l_DistanceZ;
+    float l_DistanceX = m_LastNotifyPosition.GetPositionX() - GetPositionX();
+    float l_DistanceY = m_LastNotifyPosition.GetPositionY() - GetPositionY();
+    float l_DistanceZ = m_LastNotifyPosition.GetPositionZ() - GetPositionZ();
+    float l_DistanceSQ = l_DistanceX*l_DistanceX + l_DistanceY*l_DistanceY + l_DistanceZ*l_DistanceZ;
 
-        float l_MinDistanceSQ = g_RequiredMoveDistanceSq[l_Map->GetEntry()->instanceType];
-        if (l_DistanceSQ < l_MinDistanceSQ)
-            return;
+    if (l_DistanceSQ < p_MinDistanceSq)
+        return false;
 
-        me->m_LastNotifyPosition.Relocate(me->GetPositionX(), me->GetPositionY(), me->GetPositionZ());
+    m_LastNotifyPosition.Relocate(GetPositionX(), GetPositionY(), GetPositionZ());
 
-        if (me->isType(TYPEMASK_PLAYER))
-            ((Player*)me)->UpdateVisibilityForPlayer();
+    if (isType(TYPEMASK_PLAYER))
+        ((Player*)this)->UpdateVisibilityForPlayer();
 
-        me->WorldObject::UpdateObjectVisibility(true);
-    }
-};
+    WorldObject::UpdateObjectVisibility(true);
+    return true;
+}
 
 void Unit::UpdateObjectVisibility(bool forced)
 {
@@ -20287,8 +20264,8 @@ void Unit::UpdateObjectVisibility(bool forced)
 
         WorldObject::UpdateObjectVisibility(true);
     }
-    else
-        m_Events.AddEvent(new VisibilityUpdateTask(this), m_Events.CalculateTime(1));
+    else if (IsInWorld())
+        GetMap()->ScheduleVisibilityUpdate(this);
     AINotifyTask::ScheduleAINotify(this);
 }
 
@@ -22120,7 +22097,7 @@ void Unit::SendThreatListUpdate()
         l_Data.appendPackGUID(GetGUID());
         l_Data << l_Count;
 
-        std::list<HostileReference*>& l_ThreatList = getThreatManager().getThreatList();
+        std::list<HostileReference*> const& l_ThreatList = getThreatManager().getThreatList();
         for (std::list<HostileReference*>::const_iterator l_Iter = l_ThreatList.begin(); l_Iter != l_ThreatList.end(); ++l_Iter)
         {
             l_Data.appendPackGUID((*l_Iter)->getUnitGuid());
@@ -22142,7 +22119,7 @@ void Unit::SendChangeCurrentVictimOpcode(HostileReference* p_HostileReference)
         l_Data.appendPackGUID(p_HostileReference->getUnitGuid());
         l_Data << l_Count;
 
-        std::list<HostileReference*>& l_ThreatList = getThreatManager().getThreatList();
+        std::list<HostileReference*> const& l_ThreatList = getThreatManager().getThreatList();
         for (std::list<HostileReference*>::const_iterator l_Iter = l_ThreatList.begin(); l_Iter != l_ThreatList.end(); ++l_Iter)
         {
             l_Data.appendPackGUID((*l_Iter)->getUnitGuid());
@@ -22606,15 +22583,19 @@ void Unit::BuildValuesUpdate(uint8 updateType, ByteBuffer* data, Player* target)
     uint32* flags;
     uint32 visibleFlag = GetUpdateFieldData(target, flags);
 
+    /// Fields with UF_FLAG_SPECIAL_INFO are sent to a viewer seeing them even unchanged
+    BuildValuesUpdateMask(updateType == UPDATETYPE_VALUES ? &_changesMask : nullptr, visibleFlag, _fieldNotifyFlags | (visibleFlag & UF_FLAG_SPECIAL_INFO), updateMask);
+
+    if (HasFlag(UNIT_FIELD_AURA_STATE, PER_CASTER_AURA_STATE_MASK))
+        updateMask.SetBit(UNIT_FIELD_AURA_STATE);
+
     Creature const* creature = ToCreature();
-    for (uint16 index = 0; index < m_valuesCount; ++index)
+    UpdateMask::ClientUpdateMaskType const* blocks = updateMask.GetBlocks();
+    for (uint32 block = 0; block < updateMask.GetBlockCount(); ++block)
     {
-        if (_fieldNotifyFlags & flags[index] ||
-            ((flags[index] & visibleFlag) & UF_FLAG_SPECIAL_INFO) ||
-            ((updateType == UPDATETYPE_VALUES ? _changesMask.GetBit(index) : m_uint32Values[index]) && (flags[index] & visibleFlag)) ||
-            (index == UNIT_FIELD_AURA_STATE && HasFlag(UNIT_FIELD_AURA_STATE, PER_CASTER_AURA_STATE_MASK)))
+        for (UpdateMask::ClientUpdateMaskType bits = blocks[block]; bits; bits &= bits - 1)
         {
-            updateMask.SetBit(index);
+            uint16 index = uint16(block * UpdateMask::CLIENT_UPDATE_MASK_BITS + UpdateMask::GetLowestBit(bits));
 
             if (index == UNIT_FIELD_NPC_FLAGS)
             {
@@ -2774,6 +2774,13 @@ class Unit : public WorldObject
         void GetZoneAndAreaId(uint32& p_ZoneId, uint32& p_AreaId, bool p_ForceRecalc = false) const;
 
         Position m_LastNotifyPosition;
+
+        /// Batched visibility update of the map, the slot is the index in the map mover list, see Map::ScheduleVisibilityUpdate
+        static uint32 const NoVisibilityUpdateSlot = 0xFFFFFFFF;
+        bool IsVisibilityUpdatePending() const { return m_VisibilityUpdateSlot != NoVisibilityUpdateSlot; }
+        uint32 GetVisibilityUpdateSlot() const { return m_VisibilityUpdateSlot; }
+        void SetVisibilityUpdateSlot(uint32 p_Slot) { m_VisibilityUpdateSlot = p_Slot; }
+        bool UpdateVisibilityAfterMove(float p_MinDistanceSq);
         Position m_LastOutdoorPosition;
         bool m_LastOutdoorStatus;
         bool IsOutdoors();
@@ -2926,9 +2933,9 @@ class Unit : public WorldObject
 
     private:
         class AINotifyTask;
-        class VisibilityUpdateTask;
         Position m_lastVisibilityUpdPos;
         bool m_VisibilityUpdScheduled;
+        uint32 m_VisibilityUpdateSlot;
         uint32 m_rootTimes;
 
         uint32 m_state;                                     // Even derived shouldn't modify
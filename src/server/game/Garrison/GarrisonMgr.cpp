@@ -35,6 +35,10 @@ namespace MS { namespace Garrison
 
         m_CacheLastTokenAmount = 0;
 
+        m_NextUpdateResync  = 0;
+        m_AbilityMapID      = 0;
+        m_AbilityInGarrison = false;
+
         m_GarrisonScript = nullptr;
         m_CanRecruitFollower = p_Owner->HasCharacterWorldState(CharacterWorldStates::GarrisonTavernBoolCanRecruitFollower) ? p_Owner->GetCharacterWorldStateValue(CharacterWorldStates::GarrisonTavernBoolCanRecruitFollower) : 1;
 
@@ -404,6 +408,7 @@ namespace MS { namespace Garrison
 
             /// Force mission distribution update
             m_MissionDistributionLastUpdate = 0;
+            ScheduleUpdate(UpdateType::MissionDistribution);
 
             /// Fix bug in mission distribution TEMP CODE
             uint32 l_MaxMissionCount            = ceil(m_Followers.size() * GARRISON_MISSION_DISTRIB_FOLLOWER_COEFF);
@@ -688,21 +693,98 @@ namespace MS { namespace Garrison
     //////////////////////////////////////////////////////////////////////////
     //////////////////////////////////////////////////////////////////////////
 
+    std::atomic<uint64> UpdateScheduler::s_Ticks(0);
+    std::atomic<uint64> UpdateScheduler::s_Runs[UpdateType::Max];
+    std::atomic<uint64> UpdateScheduler::s_Resyncs(0);
+
+    char const* UpdateScheduler::GetTypeName(UpdateType::Type p_Type)
+    {
+        switch (p_Type)
+        {
+            case UpdateType::Buildings:
+                return "buildings";
+            case UpdateType::Followers:
+                return "followers";
+            case UpdateType::Cache:
+                return "cache";
+            case UpdateType::MissionDistribution:
+                return "mission distribution";
+            case UpdateType::Ability:
+                return "garrison ability";
+            case UpdateType::WorkOrders:
+                return "work orders";
+            default:
+                return "unknown";
+        }
+    }
+
     /// Update the garrison
     void Manager::Update()
     {
-        /// Update buildings
-        UpdateBuildings();
-        /// Update followers
-        UpdateFollowers();
-        /// Update cache
-        UpdateCache();
-        /// Update mission distribution
-        UpdateMissionDistribution();
-        /// Update garrison ability
-        UpdateGarrisonAbility();
-        /// Update work order
-        UpdateWorkOrders();
+        uint32 l_Now = time(nullptr);
+
+        UpdateScheduler::s_Ticks++;
+
+        if (l_Now >= m_NextUpdateResync)
+        {
+            ScheduleAllUpdates();
+            m_NextUpdateResync = l_Now + Globals::UpdateResyncInterval;
+            UpdateScheduler::s_Resyncs++;
+        }
+
+        /// The garrison ability depends on where the owner is
+        bool l_InGarrison = m_Owner->IsInGarrison();
+        if (m_Owner->GetMapId() != m_AbilityMapID || l_InGarrison != m_AbilityInGarrison)
+        {
+            m_AbilityMapID      = m_Owner->GetMapId();
+            m_AbilityInGarrison = l_InGarrison;
+            m_UpdateScheduler.ScheduleNow(UpdateType::Ability);
+        }
+
+        /// An update rescheduled by the updates of this tick runs at the next tick
+        m_UpdateScheduler.PopDue(l_Now, m_DueUpdates);
+
+        for (UpdateType::Type l_Type : m_DueUpdates)
+        {
+            UpdateScheduler::s_Runs[l_Type]++;
+
+            switch (l_Type)
+            {
+                case UpdateType::Buildings:
+                    UpdateBuildings();
+                    break;
+                case UpdateType::Followers:
+                    UpdateFollowers();
+                    break;
+                case UpdateType::Cache:
+                    UpdateCache();
+                    break;
+                case UpdateType::MissionDistribution:
+                    UpdateMissionDistribution();
+                    break;
+                case UpdateType::Ability:
+                    UpdateGarrisonAbility();
+                    break;
+                case UpdateType::WorkOrders:
+                    UpdateWorkOrders();
+                    break;
+                default:
+                    break;
+            }
+        }
+    }
+
+    /// Run a periodic update at the next garrison update, after a change of the state it handles
+    void Manager::ScheduleUpdate(UpdateType::Type p_Type)
+    {
+        m_UpdateScheduler.ScheduleNow(p_Type);
+    }
+
+    /// Schedule every periodic update
+    void Manager::ScheduleAllUpdates()
+    {
+        for (uint8 l_Type = 0; l_Type < UpdateType::Max; ++l_Type)
+            m_UpdateScheduler.ScheduleNow(UpdateType::Type(l_Type));
     }
 
     //////////////////////////////////////////////////////////////////////////
@@ -831,6 +913,8 @@ namespace MS { namespace Garrison
 
         m_CacheLastTokenAmount  = 0;
         m_CacheLastUsage        = time(0);
+
+        ScheduleUpdate(UpdateType::Cache);
     }
 
     //////////////////////////////////////////////////////////////////////////
@@ -841,6 +925,10 @@ namespace MS { namespace Garrison
     {
         InitPlots();    ///< AKA update plots
 
+        ScheduleUpdate(UpdateType::Cache);
+        /// UpdateWorkOrders does nothing outside of the garrison, it doesn't reschedule itself
+        ScheduleUpdate(UpdateType::WorkOrders);
+
         /// Enable AI Client collision manager
         m_Owner->SetFlag(UNIT_FIELD_NPC_FLAGS + 1, UNIT_NPC_FLAG2_AI_OBSTACLE);
 
@@ -885,6 +973,10 @@ namespace MS { namespace Garrison
     {
         Interfaces::GarrisonSite* l_GarrisonScript = GetGarrisonScript();
 
+        /// Cache and ability are quest dependent
+        ScheduleUpdate(UpdateType::Cache);
+        ScheduleUpdate(UpdateType::Ability);
+
         if (l_GarrisonScript)
         {
             /// Broadcast event
@@ -899,6 +991,10 @@ namespace MS { namespace Garrison
     {
         Interfaces::GarrisonSite* l_GarrisonScript = GetGarrisonScript();
 
+        /// Cache and ability are quest dependent
+        ScheduleUpdate(UpdateType::Cache);
+        ScheduleUpdate(UpdateType::Ability);
+
         if (l_GarrisonScript)
         {
             /// Broadcast event
@@ -913,6 +1009,10 @@ namespace MS { namespace Garrison
     {
         Interfaces::GarrisonSite* l_GarrisonScript = GetGarrisonScript();
 
+        /// Cache and ability are quest dependent
+        ScheduleUpdate(UpdateType::Cache);
+        ScheduleUpdate(UpdateType::Ability);
+
         if (l_GarrisonScript)
         {
             /// Broadcast event
@@ -2657,6 +2757,7 @@ namespace MS { namespace Garrison
 
                 m_NumFollowerActivation--;
                 m_NumFollowerActivationRegenTimestamp = time(0);
+                ScheduleUpdate(UpdateType::Followers);
 
                 l_It->Flags = l_It->Flags & ~GARRISON_FOLLOWER_FLAG_INACTIVE;
                 l_Follower = &(*l_It);
@@ -3416,6 +3517,7 @@ namespace MS { namespace Garrison
         CharacterDatabase.AsyncQuery(l_Stmt);
 
         m_WorkOrders.push_back(l_WorkOrder);
+        ScheduleUpdate(UpdateType::WorkOrders);
 
         return l_WorkOrder.DatabaseID;
     }
@@ -3432,6 +3534,7 @@ namespace MS { namespace Garrison
             if (l_It->DatabaseID == p_DBID)
             {
                 m_WorkOrders.erase(l_It);
+                ScheduleUpdate(UpdateType::WorkOrders);
                 break;
             }
         }
@@ -3748,6 +3851,7 @@ namespace MS { namespace Garrison
         InitDataForLevel();
         InitPlots();
         UpdateStats();
+        ScheduleAllUpdates();
     }
 
     /// Init data for level
@@ -3918,6 +4022,10 @@ namespace MS { namespace Garrison
     /// Update plot game object
     void Manager::UpdatePlot(uint32 p_PlotInstanceID)
     {
+        /// Building state or plot game objects changed
+        ScheduleUpdate(UpdateType::Buildings);
+        ScheduleUpdate(UpdateType::WorkOrders);
+
         if (!m_Owner->IsInGarrison())
             return;
 
@@ -4161,7 +4269,10 @@ namespace MS { namespace Garrison
                             m_PlotsGameObjects[p_PlotInstanceID].push_back(l_Cosmetic->GetGUID());
 
                             if (l_Cosmetic->GetGoType() == GAMEOBJECT_TYPE_GARRISON_SHIPMENT)
+                            {
                                 m_PlotsWorkOrderGob[p_PlotInstanceID] = l_Cosmetic->GetGUID();
+                                ScheduleUpdate(UpdateType::WorkOrders);
+                            }
                         }
                     }
                 }
@@ -4307,6 +4418,9 @@ namespace MS { namespace Garrison
                 /// Nothing more needed, client auto deduce notification
                 UpdatePlot(l_Building->PlotInstanceID);
             }
+            /// Next construction to complete
+            else if (!l_Building->Active && !l_Building->BuiltNotified)
+                m_UpdateScheduler.Schedule(UpdateType::Buildings, l_Building->TimeBuiltEnd + 1);
         }
     }
 
@@ -4324,6 +4438,9 @@ namespace MS { namespace Garrison
 
             m_Owner->SendDirectMessage(&l_Data);
         }
+
+        if (m_NumFollowerActivation < Globals::FollowerActivationMaxStack)
+            m_UpdateScheduler.Schedule(UpdateType::Followers, m_NumFollowerActivationRegenTimestamp + DAY + 1);
     }
 
     /// Update cache
@@ -4358,6 +4475,10 @@ namespace MS { namespace Garrison
 
         uint32 l_NumRessourceGenerated = std::min((uint32)((time(0) - m_CacheLastUsage) / Globals::CacheTokenGenerateTime), (uint32)Globals::CacheMaxToken);
 
+        /// Next token generated
+        if (l_NumRessourceGenerated < Globals::CacheMaxToken)
+            m_UpdateScheduler.Schedule(UpdateType::Cache, m_CacheLastUsage + (l_NumRessourceGenerated + 1) * Globals::CacheTokenGenerateTime);
+
         if (!m_CacheGameObjectGUID)
         {
             m_CacheLastTokenAmount = l_NumRessourceGenerated;
@@ -4664,6 +4785,8 @@ namespace MS { namespace Garrison
             }
             m_MissionDistributionLastUpdate = time(0);
         }
+
+        m_UpdateScheduler.Schedule(UpdateType::MissionDistribution, m_MissionDistributionLastUpdate + Globals::MissionDistributionInterval + 1);
     }
 
     bool Manager::EvaluateMissionConditions(GarrMissionEntry const* p_Entry)
@@ -4861,6 +4984,9 @@ namespace MS { namespace Garrison
                 {
                     if (l_PlotWorkOrder[l_OrderI]->CompleteTime <= l_CurrentTimeStamp)
                         l_Complete = true;
+                    /// The display changes when the first shipment of the plot completes
+                    else
+                        m_UpdateScheduler.Schedule(UpdateType::WorkOrders, l_PlotWorkOrder[l_OrderI]->CompleteTime);
                 }
 
                 if (l_ShipmentsSize < l_ShipmentContainerEntry->ShipmentAmountNeeded[0])
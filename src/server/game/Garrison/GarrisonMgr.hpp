@@ -18,6 +18,7 @@
 #include "GarrisonWorkOrder.hpp"
 #include "GarrisonShipmentManager.hpp"
 #include "GarrisonBuildingManager.hpp"
+#include "GarrisonUpdateScheduler.hpp"
 #include "../../../scripts/Draenor/Garrison/GarrisonScriptData.hpp"
 
 #include "Interfaces/Interface_GarrisonSite.hpp"
@@ -50,8 +51,10 @@ namespace MS { namespace Garrison
             /// Delete garrison
             static void DeleteFromDB(uint64 p_PlayerGUID, SQLTransaction p_Transation);
 
-            /// Update the garrison
+            /// Update the garrison, runs the periodic updates that are due
             void Update();
+            /// Run a periodic update at the next garrison update, after a change of the state it handles
+            void ScheduleUpdate(UpdateType::Type p_Type);
 
             /// Set garrison level
             void SetLevel(uint32 p_Level);
@@ -404,6 +407,9 @@ namespace MS { namespace Garrison
             /// Uninit plots
             void UninitPlots();
 
+            /// Schedule every periodic update, at load and as a safety net for the changes not scheduling their update
+            void ScheduleAllUpdates();
+
             /// Update garrison stats
             void UpdateStats();
 
@@ -454,6 +460,12 @@ namespace MS { namespace Garrison
 
             GarrisonMissionReward m_PendingMissionReward;
 
+            UpdateScheduler m_UpdateScheduler;
+            std::vector<UpdateType::Type> m_DueUpdates;
+            uint32 m_NextUpdateResync;              ///< Timestamp of the next ScheduleAllUpdates
+            uint32 m_AbilityMapID;                  ///< Owner location the garrison ability was updated for
+            bool m_AbilityInGarrison;
+
     };
 
 }   ///< namespace Garrison
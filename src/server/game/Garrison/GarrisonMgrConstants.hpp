@@ -40,7 +40,8 @@ namespace MS { namespace Garrison
             ShipyardBuildingType            = 9,
             ShipyardBuildingID              = 205,
             ShipyardPlotID                  = 98,
-            MaxActiveFollowerAllowedCount   = 20
+            MaxActiveFollowerAllowedCount   = 20,
+            UpdateResyncInterval            = MINUTE        ///< Every periodic update is run at least that often, @see UpdateScheduler
         };
     }
 
@@ -0,0 +1,105 @@
+////////////////////////////////////////////////////////////////////////////////
+//
+//  MILLENIUM-STUDIO
+//  Copyright 2016 Millenium-studio SARL
+//  All Rights Reserved.
+//
+////////////////////////////////////////////////////////////////////////////////
+#ifndef CROSS
+#ifndef GARRISON_UPDATE_SCHEDULER_HPP_GARRISON
+#define GARRISON_UPDATE_SCHEDULER_HPP_GARRISON
+
+#include "Common.h"
+
+#include <algorithm>
+#include <atomic>
+#include <functional>
+#include <vector>
+
+namespace MS { namespace Garrison
+{
+    /// Periodic updates of a garrison
+    namespace UpdateType
+    {
+        enum Type : uint8
+        {
+            Buildings,
+            Followers,
+            Cache,
+            MissionDistribution,
+            Ability,
+            WorkOrders,
+            Max
+        };
+    }
+
+    /// Due times of the periodic updates of a garrison.
+    /// Each update schedules its next run from the state it just handled (next shipment completion, next cache
+    /// token, next mission distribution...), the state changes schedule the updates they affect to run at once.
+    /// Due times are kept in a min-heap, entries replaced by a sooner schedule are skipped when popped.
+    class UpdateScheduler
+    {
+        public:
+            static uint32 const Unscheduled = 0xFFFFFFFF;
+
+            UpdateScheduler()
+            {
+                std::fill(m_DueTimes, m_DueTimes + UpdateType::Max, Unscheduled);
+            }
+
+            /// Run p_Type at p_DueTime, an earlier schedule is kept
+            void Schedule(UpdateType::Type p_Type, uint32 p_DueTime)
+            {
+                if (p_DueTime >= m_DueTimes[p_Type])
+                    return;
+
+                m_DueTimes[p_Type] = p_DueTime;
+                m_Heap.push_back(std::make_pair(p_DueTime, p_Type));
+                std::push_heap(m_Heap.begin(), m_Heap.end(), std::greater<Entry>());
+            }
+
+            /// Run p_Type at the next update
+            void ScheduleNow(UpdateType::Type p_Type)
+            {
+                Schedule(p_Type, 0);
+            }
+
+            /// Unschedule and return the updates due at p_Now
+            void PopDue(uint32 p_Now, std::vector<UpdateType::Type>& p_Types)
+            {
+                p_Types.clear();
+
+                while (!m_Heap.empty() && m_Heap.front().first <= p_Now)
+                {
+                    Entry l_Entry = m_Heap.front();
+                    std::pop_heap(m_Heap.begin(), m_Heap.end(), std::greater<Entry>());
+                    m_Heap.pop_back();
+
+                    /// Replaced by a sooner schedule, already popped
+                    if (m_DueTimes[l_Entry.second] != l_Entry.first)
+                        continue;
+
+                    m_DueTimes[l_Entry.second] = Unscheduled;
+                    p_Types.push_back(UpdateType::Type(l_Entry.second));
+                }
+            }
+
+            /// Garrison updates ticked, runs of each update, resyncs, for .debug stats schedule
+            static std::atomic<uint64> s_Ticks;
+            static std::atomic<uint64> s_Runs[UpdateType::Max];
+            static std::atomic<uint64> s_Resyncs;
+
+            static char const* GetTypeName(UpdateType::Type p_Type);
+
+        private:
+            typedef std::pair<uint32, uint8> Entry;
+
+            std::vector<Entry> m_Heap;
+            uint32 m_DueTimes[UpdateType::Max];
+    };
+
+}   ///< namespace Garrison
+}   ///< namespace MS
+
+#endif  ///< GARRISON_UPDATE_SCHEDULER_HPP_GARRISON
+#endif
@@ -410,7 +410,7 @@ void ObjectMgr::LoadCreatureTemplates()
     uint32 oldMSTime = getMSTime();
 
     //                                                 0           1          2           3          4       5
-    QueryResult result = WorldDatabase.Query("SELECT entry, KillCredit1, KillCredit2, modelid1, modelid2, modelid3, "
+    StreamedQueryResult result = WorldDatabase.QueryStream("SELECT entry, KillCredit1, KillCredit2, modelid1, modelid2, modelid3, "
     //                                           6        7      8           9       10           11            12       13      14     15       16       17         18        19        20
                                              "modelid4, name, femaleName, subname, IconName, gossip_menu_id, minlevel, maxlevel, exp, exp_req, faction, npcflag, npcflag2, speed_walk, speed_run, "
     //                                             21       22   23      24            25           26               27               28          29             30
@@ -959,7 +959,7 @@ void ObjectMgr::LoadCreatureAddons()
     uint32 l_OldMSTime = getMSTime();
 
     ///                                                0      1       2      3       4       5      6       7
-    QueryResult l_Result = WorldDatabase.Query("SELECT guid, path_id, mount, bytes1, bytes2, emote, auras, animkit FROM creature_addon");
+    StreamedQueryResult l_Result = WorldDatabase.QueryStream("SELECT guid, path_id, mount, bytes1, bytes2, emote, auras, animkit FROM creature_addon");
     if (!l_Result)
     {
         sLog->outInfo(LOG_FILTER_SERVER_LOADING, ">> Loaded 0 creature addon definitions. DB table `creature_addon` is empty.");
@@ -1618,7 +1618,7 @@ void ObjectMgr::LoadCreatures()
         l_Query += l_TempQueryEnding;
     }
 
-    QueryResult result = WorldDatabase.Query(l_Query.c_str());
+    StreamedQueryResult result = WorldDatabase.QueryStream(l_Query.c_str());
 
     if (!result)
     {
@@ -1975,7 +1975,7 @@ void ObjectMgr::LoadGameobjects()
         l_Query += l_TempQueryEnding;
     }
 
-    QueryResult result = WorldDatabase.Query(l_Query.c_str());
+    StreamedQueryResult result = WorldDatabase.QueryStream(l_Query.c_str());
 
     if (!result)
     {
@@ -4107,7 +4107,7 @@ void ObjectMgr::LoadQuests()
 
     mExclusiveQuestGroups.clear();
 
-    QueryResult result = WorldDatabase.Query("SELECT "
+    StreamedQueryResult result = WorldDatabase.QueryStream("SELECT "
         "Id, Method, Level, MinLevel, MaxLevel, PackageID, ZoneOrSort, Type, SuggestedPlayers, LimitTime, RequiredTeam, RequiredClasses, RequiredRaces, RequiredSkillId, RequiredSkillPoints, "
         "RequiredMinRepFaction, RequiredMaxRepFaction, RequiredMinRepValue, RequiredMaxRepValue, "
         "PrevQuestId, NextQuestId, ExclusiveGroup, NextQuestIdChain, RewardXPId, RewardMoney, RewardMoneyMaxLevel, RewardSpell, RewardSpellCast, RewardHonor, RewardHonorMultiplier, "
@@ -9115,7 +9115,7 @@ void ObjectMgr::LoadVendors()
 
     std::set<uint32> skip_vendors;
 
-    QueryResult result = WorldDatabase.Query("SELECT entry, item, maxcount, incrtime, ExtendedCost, type, PlayerConditionID FROM npc_vendor ORDER BY entry, slot ASC");
+    StreamedQueryResult result = WorldDatabase.QueryStream("SELECT entry, item, maxcount, incrtime, ExtendedCost, type, PlayerConditionID FROM npc_vendor ORDER BY entry, slot ASC");
     if (!result)
     {
 
@@ -9204,7 +9204,7 @@ void ObjectMgr::LoadGossipMenuItems()
 
     _gossipMenuItemsStore.clear();
 
-    QueryResult result = WorldDatabase.Query(
+    StreamedQueryResult result = WorldDatabase.QueryStream(
         //          0              1            2           3              4
         "SELECT menu_id, id, option_icon, option_text, option_id, npc_option_npcflag, "
         //       5              6           7          8         9
@@ -0,0 +1,25 @@
+////////////////////////////////////////////////////////////////////////////////
+//
+//  MILLENIUM-STUDIO
+//  Copyright 2016 Millenium-studio SARL
+//  All Rights Reserved.
+//
+////////////////////////////////////////////////////////////////////////////////
+
+#include "DynamicVisibility.h"
+#include "World.h"
+
+uint8 DynamicVisibilityMgr::ComputeLevel(uint8 p_CurrentLevel, uint32 p_SmoothedCost)
+{
+    if (!sWorld->getBoolConfig(CONFIG_VISIBILITY_DYNAMIC_ENABLED))
+        return 0;
+
+    uint32 l_CostPerLevel = std::max<uint32>(1, sWorld->getIntConfig(CONFIG_VISIBILITY_DYNAMIC_COST_PER_LEVEL));
+    uint8 l_Level = uint8(std::min<uint32>(p_SmoothedCost / l_CostPerLevel, VISIBILITY_SETTINGS_MAX_LEVEL_NUM - 1));
+
+    /// Only go down once the cost is well under the current level, avoid switching at each pass
+    if (l_Level < p_CurrentLevel && p_SmoothedCost > p_CurrentLevel * l_CostPerLevel * 3 / 4)
+        return p_CurrentLevel;
+
+    return l_Level;
+}
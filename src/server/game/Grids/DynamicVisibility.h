@@ -5,37 +5,32 @@
 
 struct VisibilitySettingData
 {
-	uint32 visibilityNotifyDelay;
-	uint32 aiNotifyDelay;
-	float requiredMoveDistanceSq;
+    uint32 visibilityNotifyDelay;                           ///< Min time between two batched visibility passes of a map
+    float requiredMoveDistanceSq[6];                        ///< Per map type (common, instance, raid, bg, arena, scenario)
 };
 
-// pussywizard: dynamic visibility settings
-// 7 player intervals: 0-499, 500-999, 1000-1499, 1500-1999, 2000-2499, 2500-2999, 3000+
-// 5 map types: common, instance, raid, bg, arena
-// feel free to add more intervals, change existing ones or move to conf file :P
-#define VISIBILITY_SETTINGS_PLAYER_INTERVAL 500
-#define VISIBILITY_SETTINGS_MAX_INTERVAL_NUM 7
-const VisibilitySettingData VisibilitySettings[VISIBILITY_SETTINGS_MAX_INTERVAL_NUM][5] =
+/// Visibility load levels, a map goes up one level each time its smoothed visibility pass cost
+/// exceeds Visibility.Dynamic.CostPerLevel more. Level 0 is the behavior without dynamic visibility.
+#define VISIBILITY_SETTINGS_MAX_LEVEL_NUM 7
+const VisibilitySettingData VisibilitySettings[VISIBILITY_SETTINGS_MAX_LEVEL_NUM] =
 {
-	{ {300, 150, 1.0f}, {300, 150, 1.0f}, {300, 150, 1.0f}, {300, 150, 1.0f}, {300, 150, 1.0f} }, // 0-499
-	{ {400, 200, 2.25f}, {400, 200, 2.25f}, {400, 200, 2.25f}, {300, 150, 1.0f}, {300, 150, 1.0f} }, // 500-999
-	{ {500, 250, 4.0f}, {500, 250, 4.0f}, {500, 250, 4.0f}, {400, 200, 2.25f}, {300, 150, 1.0f} }, // 1000-1499
-	{ {700, 350, 6.25f}, {700, 350, 6.25f}, {700, 350, 6.25f}, {600, 300, 6.25f}, {300, 200, 1.0f} }, // 1500-1999
-	{ {1000, 500, 16.0f}, {1000, 500, 16.0f}, {1000, 500, 16.0f}, {1000, 500, 16.0f}, {300, 250, 1.0f} }, // 2000-2499
-	{ {1000, 500, 16.0f}, {1000, 500, 16.0f}, {1000, 500, 16.0f}, {1000, 500, 16.0f}, {300, 350, 1.0f} }, // 2500-2999
-	{ {1200, 550, 20.0f}, {1200, 550, 25.0f}, {1200, 550, 25.0f}, {1100, 550, 16.0f}, {300, 350, 1.0f} } // 3000+
+    {   0, {  20.0f,  25.0f,  25.0f,  16.0f, 1.0f,  25.0f } },
+    { 100, {  25.0f,  25.0f,  25.0f,  20.0f, 1.0f,  25.0f } },
+    { 200, {  36.0f,  36.0f,  36.0f,  25.0f, 2.25f, 36.0f } },
+    { 300, {  49.0f,  49.0f,  49.0f,  36.0f, 4.0f,  49.0f } },
+    { 400, {  64.0f,  64.0f,  64.0f,  49.0f, 4.0f,  64.0f } },
+    { 500, { 100.0f, 100.0f, 100.0f,  64.0f, 6.25f, 100.0f } },
+    { 700, { 144.0f, 144.0f, 144.0f, 100.0f, 9.0f,  144.0f } }
 };
 
 class DynamicVisibilityMgr
 {
-public:
-	static void Update(uint32 sessionCount);
-	static uint32 GetVisibilityNotifyDelay(uint32 map_type) { return VisibilitySettings[visibilitySettingsIndex][map_type].visibilityNotifyDelay; }
-	static uint32 GetAINotifyDelay(uint32 map_type) { return VisibilitySettings[visibilitySettingsIndex][map_type].aiNotifyDelay; }
-	static float GetReqMoveDistSq(uint32 map_type) { return VisibilitySettings[visibilitySettingsIndex][map_type].requiredMoveDistanceSq; }
-protected:
-	static uint8 visibilitySettingsIndex;
+    public:
+        static uint32 GetVisibilityNotifyDelay(uint8 p_Level) { return VisibilitySettings[p_Level].visibilityNotifyDelay; }
+        static float GetReqMoveDistSq(uint8 p_Level, uint32 p_MapType) { return VisibilitySettings[p_Level].requiredMoveDistanceSq[p_MapType]; }
+
+        /// Level a map should use for a smoothed pass cost (in microseconds), with some hysteresis on the way down
+        static uint8 ComputeLevel(uint8 p_CurrentLevel, uint32 p_SmoothedCost);
 };
 
 #endif
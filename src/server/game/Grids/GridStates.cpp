@@ -10,6 +10,7 @@
 #include "GridNotifiers.h"
 #include "Grid.h"
 #include "Log.h"
+#include "WildBattlePet.h"
 
 void InvalidState::Update(Map &, NGridType &, GridInfo &, const uint32) const
 {
@@ -27,6 +28,7 @@ void ActiveState::Update(Map &m, NGridType &grid, GridInfo & info, const uint32
             TypeContainerVisitor<ObjectGridStoper, GridTypeMapContainer> visitor(worker);
             grid.VisitAllGrids(visitor);
             grid.SetGridState(GRID_STATE_IDLE);
+            sWildBattlePetMgr->OnGridIdle(&m, grid);
             sLog->outDebug(LOG_FILTER_MAPS, "Grid[%u, %u] on map %u moved to IDLE state", grid.getX(), grid.getY(), m.GetId());
         }
         else
@@ -50,6 +52,10 @@ void RemovalState::Update(Map &m, NGridType &grid, GridInfo &info, const uint32
         info.UpdateTimeTracker(t_diff);
         if (info.getTimeTracker().Passed())
         {
+            /// Spread unloads over several updates, the timer stays expired so the grid is retried next update
+            if (!m.HasGridUnloadBudget())
+                return;
+
             if (!m.UnloadGrid(grid, false))
             {
                 sLog->outDebug(LOG_FILTER_MAPS, "Grid[%u, %u] for map %u differed unloading due to players or active objects nearby", grid.getX(), grid.getY(), m.GetId());
@@ -18,6 +18,8 @@
 #include "CellImpl.h"
 #include "SpellInfo.h"
 
+#include <iterator>
+
 using namespace JadeCore;
 
 void VisibleNotifier::SendToSelf()
@@ -27,15 +29,26 @@ void VisibleNotifier::SendToSelf()
         return;
 
 #endif /* CROSS */
+    std::sort(i_neighbors.begin(), i_neighbors.end());
+
+    /// Known by the client and not found by the grid visit
+    auto l_IsLeaving = [this](uint64 p_Guid) -> bool
+    {
+        return i_player.m_clientGUIDs.find(p_Guid) != i_player.m_clientGUIDs.end() && !std::binary_search(i_neighbors.begin(), i_neighbors.end(), p_Guid);
+    };
+
+    /// Found outside of the grid visit, merged in the neighbor list after the checks
+    std::vector<uint64> l_Kept;
+
     // at this moment i_clientGUIDs have guids that not iterate at grid level checks
     // but exist one case when this possible and object not out of range: transports
     if (Transport* transport = i_player.GetTransport())
     {
         for (std::set<WorldObject*>::const_iterator itr = transport->GetPassengers().begin(); itr != transport->GetPassengers().end(); ++itr)
         {
-            if (vis_guids.find((*itr)->GetGUID()) != vis_guids.end())
+            if (l_IsLeaving((*itr)->GetGUID()))
             {
-                vis_guids.erase((*itr)->GetGUID());
+                l_Kept.push_back((*itr)->GetGUID());
 
                 switch ((*itr)->GetTypeId())
                 {
@@ -58,23 +71,37 @@ void VisibleNotifier::SendToSelf()
     {
         for (auto itr : i_player.m_Controlled)
         {
-            if (vis_guids.find(itr->GetGUID()) != vis_guids.end())
+            if (l_IsLeaving(itr->GetGUID()))
             {
-                vis_guids.erase(itr->GetGUID());
+                l_Kept.push_back(itr->GetGUID());
                 if (itr->GetTypeId() == TYPEID_UNIT)
                     i_player.UpdateVisibilityOf((Creature*)(itr), i_data, i_visibleNow);
             }
         }
     }
 
-    for (auto it = vis_guids.begin();it != vis_guids.end(); ++it)
+    if (!l_Kept.empty())
+    {
+        size_t l_Found = i_neighbors.size();
+        i_neighbors.insert(i_neighbors.end(), l_Kept.begin(), l_Kept.end());
+        std::sort(i_neighbors.begin() + l_Found, i_neighbors.end());
+        std::inplace_merge(i_neighbors.begin(), i_neighbors.begin() + l_Found, i_neighbors.end());
+    }
+
+    std::vector<uint64> l_Known(i_player.m_clientGUIDs.begin(), i_player.m_clientGUIDs.end());
+    std::sort(l_Known.begin(), l_Known.end());
+
+    std::vector<uint64> l_Leaving;
+    std::set_difference(l_Known.begin(), l_Known.end(), i_neighbors.begin(), i_neighbors.end(), std::back_inserter(l_Leaving));
+
+    for (uint64 l_Guid : l_Leaving)
     {
-        i_player.m_clientGUIDs.erase(*it);
-        i_data.AddOutOfRangeGUID(*it);
+        i_player.m_clientGUIDs.erase(l_Guid);
+        i_data.AddOutOfRangeGUID(l_Guid);
 
-        if (IS_PLAYER_GUID(*it))
+        if (IS_PLAYER_GUID(l_Guid))
         {
-            Player* player = ObjectAccessor::FindPlayer(*it);
+            Player* player = ObjectAccessor::FindPlayer(l_Guid);
             if (player && player->IsInWorld())
                 player->UpdateVisibilityOf(&i_player);
         }
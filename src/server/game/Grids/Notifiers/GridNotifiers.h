@@ -28,14 +28,16 @@ class Player;
 
 namespace JadeCore
 {
+    /// Objects found around the player make a sorted neighbor list, the objects leaving the client are
+    /// the difference between the sorted client guids and that list, computed in one sweep by SendToSelf
     struct VisibleNotifier
     {
         Player &i_player;
         UpdateData i_data;
         std::set<Unit*> i_visibleNow;
-        GuidUnorderedSet vis_guids;
+        std::vector<uint64> i_neighbors;
 
-        VisibleNotifier(Player &player) : i_player(player), i_data(player.GetMapId()), vis_guids(player.m_clientGUIDs) {}
+        VisibleNotifier(Player &player) : i_player(player), i_data(player.GetMapId()) { i_neighbors.reserve(player.m_clientGUIDs.size()); }
         template<class T> void Visit(GridRefManager<T> &m);
         void SendToSelf(void);
     };
@@ -248,6 +250,7 @@ namespace JadeCore
             :  i_mapTypeMask(mapTypeMask), i_phaseMask(searcher->GetPhaseMask()), i_object(result), i_check(check) {}
 
         void Visit(GameObjectMapType &m);
+        void Visit(Player* p_Player);
         void Visit(PlayerMapType &m);
         void Visit(CreatureMapType &m);
         void Visit(CorpseMapType &m);
@@ -269,6 +272,7 @@ namespace JadeCore
         WorldObjectListSearcher(WorldObject const* searcher, std::list<WorldObject*> &objects, Check & check, uint32 mapTypeMask = GRID_MAP_TYPE_MASK_ALL)
             : i_mapTypeMask(mapTypeMask), i_phaseMask(searcher->GetPhaseMask()), i_objects(objects), i_check(check) {}
 
+        void Visit(Player* p_Player);
         void Visit(PlayerMapType &m);
         void Visit(CreatureMapType &m);
         void Visit(CorpseMapType &m);
@@ -22,7 +22,7 @@ inline void JadeCore::VisibleNotifier::Visit(GridRefManager<T> &m)
 {
     for (typename GridRefManager<T>::iterator iter = m.begin(); iter != m.end(); ++iter)
     {
-        vis_guids.erase(iter->getSource()->GetGUID());
+        i_neighbors.push_back(iter->getSource()->GetGUID());
         i_player.UpdateVisibilityOf(iter->getSource(), i_data, i_visibleNow);
     }
 }
@@ -229,13 +229,17 @@ void JadeCore::WorldObjectLastSearcher<Check>::Visit(PlayerMapType &m)
         return;
 
     for (PlayerMapType::iterator itr=m.begin(); itr != m.end(); ++itr)
-    {
-        if (!itr->getSource()->InSamePhase(i_phaseMask))
-            continue;
+        Visit(itr->getSource());
+}
 
-        if (i_check(itr->getSource()))
-            i_object = itr->getSource();
-    }
+template<class Check>
+void JadeCore::WorldObjectLastSearcher<Check>::Visit(Player* p_Player)
+{
+    if (!p_Player->InSamePhase(i_phaseMask))
+        return;
+
+    if (i_check(p_Player))
+        i_object = p_Player;
 }
 
 template<class Check>
@@ -325,8 +329,14 @@ void JadeCore::WorldObjectListSearcher<Check>::Visit(PlayerMapType &m)
         return;
 
     for (PlayerMapType::iterator itr=m.begin(); itr != m.end(); ++itr)
-        if (i_check(itr->getSource()))
-            i_objects.push_back(itr->getSource());
+        Visit(itr->getSource());
+}
+
+template<class Check>
+void JadeCore::WorldObjectListSearcher<Check>::Visit(Player* p_Player)
+{
+    if (i_check(p_Player))
+        i_objects.push_back(p_Player);
 }
 
 template<class Check>
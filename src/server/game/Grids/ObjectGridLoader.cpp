@@ -19,6 +19,9 @@
 #include "World.h"
 #include "CellImpl.h"
 #include "CreatureAI.h"
+#include "CreatureAISelector.h"
+
+#include <thread>
 
 void ObjectGridEvacuator::Visit(CreatureMapType &m)
 {
@@ -171,7 +174,7 @@ void ObjectWorldLoader::Visit(CorpseMapType &m)
     LoadHelper(cell_guids.corpses, cellCoord, m, i_corpses, i_map);
 }
 
-void ObjectGridLoader::LoadN(void)
+void ObjectGridLoader::LoadN(bool p_GridObjects /*= true*/)
 {
     i_gameObjects = 0; i_creatures = 0; i_corpses = 0;
     i_cell.data.Part.cell_y = 0;
@@ -183,6 +186,7 @@ void ObjectGridLoader::LoadN(void)
             i_cell.data.Part.cell_y = y;
 
             //Load creatures and game objects
+            if (p_GridObjects)
             {
                 TypeContainerVisitor<ObjectGridLoader, GridTypeMapContainer> visitor(*this);
                 i_grid.VisitGrid(x, y, visitor);
@@ -200,6 +204,113 @@ void ObjectGridLoader::LoadN(void)
     sLog->outDebug(LOG_FILTER_MAPS, "%u GameObjects, %u Creatures, and %u Corpses/Bones loaded for grid %u on map %u", i_gameObjects, i_creatures, i_corpses, i_grid.GetGridId(), i_map->GetId());
 }
 
+static CreatureData const* GetSpawnData(uint32 p_Guid, Creature*)
+{
+    return sObjectMgr->GetCreatureData(p_Guid);
+}
+
+static GameObjectData const* GetSpawnData(uint32 p_Guid, GameObject*)
+{
+    return sObjectMgr->GetGOData(p_Guid);
+}
+
+/// The AI registry and the templates are read only once the world is loaded
+static void PrepareSpawnAI(Creature* p_Creature, CreatureData const* p_Data)
+{
+    p_Creature->SetSpawnAIFactory(FactorySelector::selectSpawnAIFactory(sObjectMgr->GetCreatureTemplate(p_Data->id)));
+}
+
+static void PrepareSpawnAI(GameObject*, GameObjectData const*) { }
+
+template <class T, class D>
+void PrepareHelper(CellGuidSet const& p_GuidSet, std::vector<GridLoadJob::Spawn<T, D>>& p_Spawns)
+{
+    p_Spawns.reserve(p_GuidSet.size());
+
+    for (uint32 l_Guid : p_GuidSet)
+    {
+        /// Same rejection LoadFromDB would do, without touching the map
+        D const* l_Data = GetSpawnData(l_Guid, static_cast<T*>(nullptr));
+        if (!l_Data)
+            continue;
+
+        GridLoadJob::Spawn<T, D> l_Spawn;
+        l_Spawn.Guid   = l_Guid;
+        l_Spawn.Object = new T;
+        l_Spawn.Data   = l_Data;
+
+        PrepareSpawnAI(l_Spawn.Object, l_Data);
+        p_Spawns.push_back(l_Spawn);
+    }
+}
+
+bool ObjectGridLoader::PrepareGridLoadJob(GridLoadJob& p_Job)
+{
+    if (p_Job.Claimed.exchange(true))
+        return false;
+
+    uint32 l_StartTime = getMSTime();
+
+    /// Objects are new'd here, on a MapUpdater thread, they still belong to the pools of the map instance
+    ObjectPoolMapScope l_PoolScope(p_Job.Pools);
+
+    Cell l_Cell(p_Job.BaseCell);
+    for (uint32 l_X = 0; l_X < MAX_NUMBER_OF_CELLS; ++l_X)
+    {
+        l_Cell.data.Part.cell_x = l_X;
+        for (uint32 l_Y = 0; l_Y < MAX_NUMBER_OF_CELLS; ++l_Y)
+        {
+            l_Cell.data.Part.cell_y = l_Y;
+
+            CellObjectGuids const& l_CellGuids = sObjectMgr->GetCellObjectGuids(p_Job.MapId, p_Job.SpawnMode, l_Cell.GetCellCoord().GetId());
+            if (l_CellGuids.creatures.empty() && l_CellGuids.gameobjects.empty())
+                continue;
+
+            p_Job.Cells.push_back(GridLoadJob::CellSpawns());
+
+            GridLoadJob::CellSpawns& l_Spawns = p_Job.Cells.back();
+            l_Spawns.SpawnCell = l_Cell;
+
+            PrepareHelper(l_CellGuids.creatures, l_Spawns.Creatures);
+            PrepareHelper(l_CellGuids.gameobjects, l_Spawns.GameObjects);
+
+            p_Job.ObjectCount += l_Spawns.Creatures.size() + l_Spawns.GameObjects.size();
+        }
+    }
+
+    p_Job.PrepareTime = GetMSTimeDiffToNow(l_StartTime);
+    p_Job.Prepared.store(true, std::memory_order_release);
+    return true;
+}
+
+void ObjectGridLoader::DiscardGridLoadJob(GridLoadJob& p_Job)
+{
+    /// Claimed by a MapUpdater thread, the objects are only ours once it is done
+    if (p_Job.Claimed.exchange(true))
+    {
+        while (!p_Job.Prepared.load(std::memory_order_acquire))
+            std::this_thread::yield();
+    }
+
+    for (uint32 l_I = p_Job.CellIndex; l_I < p_Job.Cells.size(); ++l_I)
+    {
+        GridLoadJob::CellSpawns& l_Spawns = p_Job.Cells[l_I];
+        uint32 l_Start = l_I == p_Job.CellIndex ? p_Job.SpawnIndex : 0;
+
+        /// Creatures are committed before gameobjects, see Map::UpdateGridLoadQueue
+        for (uint32 l_J = l_Start; l_J < l_Spawns.Creatures.size(); ++l_J)
+            delete l_Spawns.Creatures[l_J].Object;
+
+        uint32 l_GobStart = l_Start > l_Spawns.Creatures.size() ? l_Start - l_Spawns.Creatures.size() : 0;
+        for (uint32 l_J = l_GobStart; l_J < l_Spawns.GameObjects.size(); ++l_J)
+            delete l_Spawns.GameObjects[l_J].Object;
+    }
+
+    p_Job.Cells.clear();
+    p_Job.CellIndex  = 0;
+    p_Job.SpawnIndex = 0;
+}
+
 template<class T>
 void ObjectGridUnloader::Visit(GridRefManager<T> &m)
 {
@@ -14,8 +14,61 @@
 #include "GridLoader.h"
 #include "GridDefines.h"
 #include "Cell.h"
+#include "Timer.h"
+
+#include <atomic>
+#include <memory>
 
 class ObjectWorldLoader;
+struct CreatureData;
+struct GameObjectData;
+struct ObjectPoolSet;
+
+/// Grid object data prepared outside of the map thread (spawn data lookup, AI selection and object allocation)
+/// and committed into the map in bounded slices by Map::UpdateGridLoadQueue
+struct GridLoadJob;
+typedef std::shared_ptr<GridLoadJob> GridLoadJobPtr;
+
+struct GridLoadJob
+{
+    template<class T, class D> struct Spawn
+    {
+        uint32 Guid;
+        T* Object;
+        D const* Data;
+    };
+
+    struct CellSpawns
+    {
+        Cell SpawnCell;
+        std::vector<Spawn<Creature, CreatureData>>     Creatures;
+        std::vector<Spawn<GameObject, GameObjectData>> GameObjects;
+    };
+
+    GridLoadJob(NGridType* p_Grid, Cell const& p_Cell, uint32 p_MapId, uint8 p_SpawnMode, ObjectPoolSet* p_Pools)
+        : Grid(p_Grid), BaseCell(p_Cell), MapId(p_MapId), SpawnMode(p_SpawnMode), Pools(p_Pools), Claimed(false), Prepared(false),
+        CellIndex(0), SpawnIndex(0), ObjectCount(0), QueueTime(getMSTime()), PrepareTime(0), CommitTime(0)
+    {
+    }
+
+    NGridType* Grid;
+    Cell BaseCell;
+    uint32 MapId;
+    uint8 SpawnMode;
+    ObjectPoolSet* Pools;           ///< Of the map instance, alive as long as the job is pending
+    std::vector<CellSpawns> Cells;
+    std::atomic<bool> Claimed;      ///< Set by the thread running the preparation
+    std::atomic<bool> Prepared;
+
+    /// Commit cursor, only used by the owning map thread
+    uint32 CellIndex;
+    uint32 SpawnIndex;
+
+    uint32 ObjectCount;
+    uint32 QueueTime;
+    uint32 PrepareTime;
+    uint32 CommitTime;
+};
 
 class ObjectGridLoader
 {
@@ -33,10 +86,17 @@ class ObjectGridLoader
         void Visit(AreaTriggerMapType &) const {}
         void Visit(ConversationMapType &) const {}
 
-        void LoadN(void);
+        void LoadN(bool p_GridObjects = true);
 
         template<class T> static void SetObjectCell(T* obj, CellCoord const& cellCoord);
 
+        /// Thread safe part of a deferred grid load, can run on any MapUpdater thread
+        /// Returns false if another thread already prepares this job
+        static bool PrepareGridLoadJob(GridLoadJob& p_Job);
+        /// Delete objects allocated for a job which will never be committed,
+        /// a preparation which did not start yet will not run anymore
+        static void DiscardGridLoadJob(GridLoadJob& p_Job);
+
     private:
         Cell i_cell;
         NGridType &i_grid;
@@ -817,6 +817,8 @@ void WorldSession::HandleAddIgnoreOpcodeCallBack(PreparedQueryResult result)
                 if (GetPlayer()->GetSocial() && !GetPlayer()->GetSocial()->AddToSocialList(GUID_LOPART(IgnoreGuid), true))
 #endif /* CROSS */
                     ignoreResult = FRIEND_IGNORE_FULL;
+                else
+                    GetPlayer()->UpdateChannelsIgnore(IgnoreGuid, true);
             }
         }
     }
@@ -839,6 +841,7 @@ void WorldSession::HandleDelIgnoreOpcode(WorldPacket& recvData)
 
 #endif /* CROSS */
     m_Player->GetSocial()->RemoveFromSocialList(GUID_LOPART(l_Guid), true);
+    m_Player->UpdateChannelsIgnore(MAKE_NEW_GUID(GUID_LOPART(l_Guid), 0, HIGHGUID_PLAYER), false);
 
     sSocialMgr->SendFriendStatus(GetPlayer(), FRIEND_IGNORE_REMOVED, GUID_LOPART(l_Guid), false);
 }
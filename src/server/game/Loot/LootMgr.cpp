@@ -44,6 +44,8 @@ LootStore LootTemplates_Spell("spell_loot_template",                 "spell id (
 class LootTemplate::LootGroup                               // A set of loot definitions for items (refs are not allowed)
 {
     public:
+        LootGroup() : FirstCertainChance(0) { }
+
         void AddEntry(LootStoreItem& item);                 // Adds an entry to the group (at loading stage)
         bool HasQuestDrop() const;                          // True if group includes at least 1 quest drop entry
         bool HasQuestDropForPlayer(Player const* player) const;
@@ -58,11 +60,16 @@ class LootTemplate::LootGroup                               // A set of loot def
         LootStoreItemList* GetExplicitlyChancedItemList() { return &ExplicitlyChanced; }
         LootStoreItemList* GetEqualChancedItemList() { return &EqualChanced; }
         void CopyConditions(ConditionContainer conditions);
+        void Compile();                                     // Resolves the item templates and builds the distribution of the group
     private:
         LootStoreItemList ExplicitlyChanced;                // Entries with chances defined in DB
         LootStoreItemList EqualChanced;                     // Zero chances - every entry takes the same chance
+        std::vector<float> CumulativeChances;               // Running total of the explicit chances, the first one above the roll is selected
+        uint32 FirstCertainChance;                          // First explicitly chanced entry with chance >= 100, selected if the roll reaches it
 
         LootStoreItem const* Roll() const;                 // Rolls an item from the group, returns NULL if all miss their chances
+        uint32 RollExplicitlyChanced() const;               // Index of the explicitly chanced entry taking the roll, ExplicitlyChanced.size() if none
+        bool IsDuplicate(Loot const& loot, LootStoreItem const& item) const;
 };
 
 //Remove all data and free all memory
@@ -95,7 +102,8 @@ uint32 LootStore::LoadLootTable()
     Clear();
 
     //                                                  0     1            2               3         4         5             6           7
-    QueryResult result = WorldDatabase.PQuery("SELECT entry, item, ChanceOrQuestChance, lootmode, groupid, mincountOrRef, maxcount, itemBonuses FROM %s", GetName());
+    std::string l_Query = std::string("SELECT entry, item, ChanceOrQuestChance, lootmode, groupid, mincountOrRef, maxcount, itemBonuses FROM ") + GetName();
+    StreamedQueryResult result = WorldDatabase.QueryStream(l_Query.c_str());
 
     if (!result)
         return 0;
@@ -164,6 +172,9 @@ uint32 LootStore::LoadLootTable()
 
     Verify();                                           // Checks validity of the loot store
 
+    for (LootTemplateMap::const_iterator itr = m_LootTemplates.begin(); itr != m_LootTemplates.end(); ++itr)
+        itr->second->Compile();
+
     return count;
 }
 
@@ -260,7 +271,7 @@ bool LootStoreItem::Roll(bool rate, Player const* p_Player) const
 
     if (type == LOOT_ITEM_TYPE_ITEM)
     {
-        ItemTemplate const* pProto = sObjectMgr->GetItemTemplate(itemid);
+        ItemTemplate const* pProto = GetItemTemplate();
         float qualityModifier = pProto && rate ? sWorld->getRate(qualityToRate[pProto->Quality]) : 1.0f;
         return roll_chance_f(chance*qualityModifier);
     }
@@ -274,6 +285,14 @@ bool LootStoreItem::Roll(bool rate, Player const* p_Player) const
     return false;
 }
 
+ItemTemplate const* LootStoreItem::GetItemTemplate() const
+{
+    if (proto)
+        return proto;
+
+    return type == LOOT_ITEM_TYPE_ITEM ? sObjectMgr->GetItemTemplate(itemid) : NULL;
+}
+
 // Checks correctness of values
 bool LootStoreItem::IsValid(LootStore const& store, uint32 entry) const
 {
@@ -525,7 +544,7 @@ void Loot::AddItem(LootStoreItem const & item)
         // non-ffa conditionals are counted in FillNonQuestNonFFAConditionalLoot()
         if (item.conditions.empty() && item.type == LOOT_ITEM_TYPE_ITEM)
         {
-            ItemTemplate const* proto = sObjectMgr->GetItemTemplate(item.itemid);
+            ItemTemplate const* proto = item.GetItemTemplate();
             if (!proto || (proto->Flags & ITEM_FLAG_PARTY_LOOT) == 0)
                 ++UnlootedCount;
         }
@@ -1568,22 +1587,46 @@ void LootTemplate::LootGroup::AddEntry(LootStoreItem& item)
         EqualChanced.push_back(item);
 }
 
+// Resolves the item templates and builds the distribution of the group (at loading stage, after the last AddEntry)
+void LootTemplate::LootGroup::Compile()
+{
+    for (LootStoreItemList::iterator i = ExplicitlyChanced.begin(); i != ExplicitlyChanced.end(); ++i)
+        i->proto = i->type == LOOT_ITEM_TYPE_ITEM ? sObjectMgr->GetItemTemplate(i->itemid) : NULL;
+    for (LootStoreItemList::iterator i = EqualChanced.begin(); i != EqualChanced.end(); ++i)
+        i->proto = i->type == LOOT_ITEM_TYPE_ITEM ? sObjectMgr->GetItemTemplate(i->itemid) : NULL;
+
+    CumulativeChances.clear();
+    CumulativeChances.reserve(ExplicitlyChanced.size());
+    FirstCertainChance = uint32(ExplicitlyChanced.size());
+
+    float total = 0.0f;
+    for (uint32 i = 0; i < ExplicitlyChanced.size(); ++i)
+    {
+        if (ExplicitlyChanced[i].chance >= 100.0f && FirstCertainChance == ExplicitlyChanced.size())
+            FirstCertainChance = i;
+
+        total += ExplicitlyChanced[i].chance;
+        CumulativeChances.push_back(total);
+    }
+}
+
+// Same selection as subtracting the chance of each entry from the roll until it goes below 0, in O(log n)
+uint32 LootTemplate::LootGroup::RollExplicitlyChanced() const
+{
+    float roll = (float)rand_chance();
+
+    uint32 index = uint32(std::upper_bound(CumulativeChances.begin(), CumulativeChances.end(), roll) - CumulativeChances.begin());
+    return std::min(index, FirstCertainChance);
+}
+
 // Rolls an item from the group, returns NULL if all miss their chances
 LootStoreItem const* LootTemplate::LootGroup::Roll() const
 {
     if (!ExplicitlyChanced.empty())                             // First explicitly chanced entries are checked
     {
-        float Roll = (float)rand_chance();
-
-        for (uint32 i = 0; i < ExplicitlyChanced.size(); ++i)   // check each explicitly chanced entry in the template and modify its chance based on quality.
-        {
-            if (ExplicitlyChanced[i].chance >= 100.0f)
-                return &ExplicitlyChanced[i];
-
-            Roll -= ExplicitlyChanced[i].chance;
-            if (Roll < 0)
-                return &ExplicitlyChanced[i];
-        }
+        uint32 index = RollExplicitlyChanced();
+        if (index < ExplicitlyChanced.size())
+            return &ExplicitlyChanced[index];
     }
     if (!EqualChanced.empty())                              // If nothing selected yet - an item is taken from equal-chanced part
         return &EqualChanced[irand(0, EqualChanced.size()-1)];
@@ -1627,85 +1670,119 @@ void LootTemplate::LootGroup::CopyConditions(ConditionContainer /*conditions*/)
     }
 }
 
+// Non-equippable items are limited to 3 drops, equippable ones to 1
+bool LootTemplate::LootGroup::IsDuplicate(Loot const& loot, LootStoreItem const& item) const
+{
+    ItemTemplate const* proto = item.GetItemTemplate();
+    if (!proto)
+        return false;
+
+    uint8 limit = proto->InventoryType == 0 ? 3 : 1;
+    uint8 count = 0;
+    for (LootItemList::const_iterator itr = loot.Items.begin(); itr != loot.Items.end(); ++itr)
+        if (itr->itemid == item.itemid && ++count == limit)    // search through the items that have already dropped
+            return true;
+
+    return false;
+}
+
 // Rolls an item from the group (if any takes its chance) and adds the item to the loot
 void LootTemplate::LootGroup::Process(Loot& loot, uint16 lootMode) const
 {
-    // build up list of possible drops
-    LootStoreItemList EqualPossibleDrops = EqualChanced;
-    LootStoreItemList ExplicitPossibleDrops = ExplicitlyChanced;
+    if (ExplicitlyChanced.empty() && EqualChanced.empty())
+        return;
 
-    uint8 uiAttemptCount = 0;
-    const uint8 uiMaxAttempts = ExplicitlyChanced.size() + EqualChanced.size();
+    // First roll on the whole group, which is the common case
+    uint32 explicitIndex = ExplicitlyChanced.empty() ? 0 : RollExplicitlyChanced();
+    uint32 equalIndex = 0;
+
+    LootStoreItem const* item = NULL;
+    if (explicitIndex < ExplicitlyChanced.size())
+        item = &ExplicitlyChanced[explicitIndex];
+    else if (!EqualChanced.empty())
+    {
+        equalIndex = irand(0, EqualChanced.size() - 1);
+        item = &EqualChanced[equalIndex];
+    }
+    else
+        return;                                             // every explicit entry missed and there is no equal chanced one
 
-    while (!ExplicitPossibleDrops.empty() || !EqualPossibleDrops.empty())
+    bool duplicate = false;
+    if (item->lootmode & lootMode)                          // only add this item if roll succeeds and the mode matches
     {
-        if (uiAttemptCount == uiMaxAttempts)             // already tried rolling too many times, just abort
+        duplicate = IsDuplicate(loot, *item);
+        if (!duplicate)
+        {
+            loot.AddItem(*item);
             return;
+        }
+    }
 
-        LootStoreItem* item = NULL;
+    // Next rolls are done on the entries still possible: the explicit entries the rolls passed over and the duplicates are dropped.
+    // Only indexes are kept, the entries are not copied.
+    std::vector<uint32> explicitPossibleDrops;
+    std::vector<uint32> equalPossibleDrops;
 
-        // begin rolling (normally called via Roll())
-        LootStoreItemList::iterator itr;
-        uint8 itemSource = 0;
-        if (!ExplicitPossibleDrops.empty())              // First explicitly chanced entries are checked
+    if (explicitIndex < ExplicitlyChanced.size())
+    {
+        for (uint32 i = explicitIndex + (duplicate ? 1 : 0); i < ExplicitlyChanced.size(); ++i)
+            explicitPossibleDrops.push_back(i);
+    }
+
+    for (uint32 i = 0; i < EqualChanced.size(); ++i)
+        if (!duplicate || explicitIndex < ExplicitlyChanced.size() || i != equalIndex)
+            equalPossibleDrops.push_back(i);
+
+    uint32 attemptCount = 1;
+    uint32 const maxAttempts = ExplicitlyChanced.size() + EqualChanced.size();
+
+    while (!explicitPossibleDrops.empty() || !equalPossibleDrops.empty())
+    {
+        if (attemptCount == maxAttempts)                    // already tried rolling too many times, just abort
+            return;
+
+        item = NULL;
+
+        // begin rolling
+        std::vector<uint32>::iterator itr;
+        std::vector<uint32>* source = NULL;
+        if (!explicitPossibleDrops.empty())                 // First explicitly chanced entries are checked
         {
-            itemSource = 1;
-            float Roll = (float)rand_chance();
-            // check each explicitly chanced entry in the template and modify its chance based on quality
-            for (itr = ExplicitPossibleDrops.begin(); itr != ExplicitPossibleDrops.end(); itr = ExplicitPossibleDrops.erase(itr))
+            float roll = (float)rand_chance();
+            for (itr = explicitPossibleDrops.begin(); itr != explicitPossibleDrops.end(); ++itr)
             {
-                if (itr->chance >= 100.0f)
-                {
-                    item = &*itr;
+                LootStoreItem const& entry = ExplicitlyChanced[*itr];
+                if (entry.chance >= 100.0f)
                     break;
-                }
 
-                Roll -= itr->chance;
-                if (Roll < 0)
-                {
-                    item = &*itr;
+                roll -= entry.chance;
+                if (roll < 0)
                     break;
-                }
+            }
+
+            // the entries the roll passed over are not possible anymore
+            itr = explicitPossibleDrops.erase(explicitPossibleDrops.begin(), itr);
+            if (itr != explicitPossibleDrops.end())
+            {
+                item = &ExplicitlyChanced[*itr];
+                source = &explicitPossibleDrops;
             }
         }
-        if (item == NULL && !EqualPossibleDrops.empty()) // If nothing selected yet - an item is taken from equal-chanced part
+        if (item == NULL && !equalPossibleDrops.empty())    // If nothing selected yet - an item is taken from equal-chanced part
         {
-            itemSource = 2;
-            itr = EqualPossibleDrops.begin();
-            std::advance(itr, irand(0, EqualPossibleDrops.size()-1));
-            item = &*itr;
+            itr = equalPossibleDrops.begin() + irand(0, equalPossibleDrops.size() - 1);
+            item = &EqualChanced[*itr];
+            source = &equalPossibleDrops;
         }
         // finish rolling
 
-        ++uiAttemptCount;
+        ++attemptCount;
 
         if (item != NULL && item->lootmode & lootMode)   // only add this item if roll succeeds and the mode matches
         {
-            bool duplicate = false;
-            if (ItemTemplate const* _proto = sObjectMgr->GetItemTemplate(item->itemid))
-            {
-                uint8 _item_counter = 0;
-                for (LootItemList::const_iterator _item = loot.Items.begin(); _item != loot.Items.end(); ++_item)
-                    if (_item->itemid == item->itemid)                             // search through the items that have already dropped
-                    {
-                        ++_item_counter;
-                        if (_proto->InventoryType == 0 && _item_counter == 3)      // Non-equippable items are limited to 3 drops
-                            duplicate = true;
-                        else if (_proto->InventoryType != 0 && _item_counter == 1) // Equippable item are limited to 1 drop
-                            duplicate = true;
-                    }
-            }
-            if (duplicate) // if item->itemid is a duplicate, remove it
-                switch (itemSource)
-                {
-                    case 1: // item came from ExplicitPossibleDrops
-                        ExplicitPossibleDrops.erase(itr);
-                        break;
-                    case 2: // item came from EqualPossibleDrops
-                        EqualPossibleDrops.erase(itr);
-                        break;
-                }
-            else           // otherwise, add the item and exit the function
+            if (IsDuplicate(loot, *item))               // if item->itemid is a duplicate, remove it
+                source->erase(itr);
+            else                                        // otherwise, add the item and exit the function
             {
                 loot.AddItem(*item);
                 return;
@@ -1862,6 +1939,16 @@ void LootTemplate::AddEntry(LootStoreItem& item)
         Entries.push_back(item);
 }
 
+// Resolves the item templates and builds the group distributions (at loading stage, after the last AddEntry)
+void LootTemplate::Compile()
+{
+    for (LootStoreItemList::iterator i = Entries.begin(); i != Entries.end(); ++i)
+        i->proto = (i->type == LOOT_ITEM_TYPE_ITEM && i->mincountOrRef > 0) ? sObjectMgr->GetItemTemplate(i->itemid) : NULL;
+
+    for (LootGroups::iterator i = Groups.begin(); i != Groups.end(); ++i)
+        i->Compile();
+}
+
 void LootTemplate::CopyConditions(ConditionContainer conditions)
 {
     for (LootStoreItemList::iterator i = Entries.begin(); i != Entries.end(); ++i)
@@ -1883,7 +1970,7 @@ void LootTemplate::Process(Loot& loot, bool rate, uint16 lootMode, Player const*
         return;
     }
 
-    // Rolling non-grouped items
+    // Rolling non-grouped items, the former duplicate scan of these entries never skipped one and is not done anymore
     for (LootStoreItemList::const_iterator i = Entries.begin(); i != Entries.end(); ++i)
     {
         if (i->lootmode &~ lootMode)                          // Do not add if mode mismatch
@@ -1892,26 +1979,6 @@ void LootTemplate::Process(Loot& loot, bool rate, uint16 lootMode, Player const*
         if (!i->Roll(rate, lootOwner))
             continue;                                         // Bad luck for the entry
 
-        if (i->type == LOOT_ITEM_TYPE_ITEM)
-        {
-            if (ItemTemplate const* _proto = sObjectMgr->GetItemTemplate(i->itemid))
-            {
-                uint8 _item_counter = 0;
-                LootItemList::const_iterator _item = loot.Items.begin();
-                for (; _item != loot.Items.end(); ++_item)
-                    if (_item->itemid == i->itemid)                               // search through the items that have already dropped
-                    {
-                        ++_item_counter;
-                        if (_proto->InventoryType == 0 && _item_counter == 3)     // Non-equippable items are limited to 3 drops
-                            continue;
-                        else if (_proto->InventoryType != 0 && _item_counter == 1) // Equippable item are limited to 1 drop
-                            continue;
-                    }
-                if (_item != loot.Items.end())
-                    continue;
-            }
-        }
-
         if (i->mincountOrRef < 0 && i->type == LOOT_ITEM_TYPE_ITEM)                             // References processing
         {
             LootTemplate const* Referenced = LootTemplates_Reference.GetLootFor(-i->mincountOrRef);
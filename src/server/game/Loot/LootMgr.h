@@ -116,14 +116,18 @@ struct LootStoreItem
     uint32   maxcount;                                      // max drop count for the item (mincountOrRef positive) or Ref multiplicator (mincountOrRef negative)
     std::vector<uint32> itemBonuses;                        // item bonuses >= WoD
     ConditionContainer conditions;                               // additional loot condition
+    ItemTemplate const* proto;                              // template of the item, resolved by LootTemplate::Compile (NULL for currencies and references)
 
     // Constructor, converting ChanceOrQuestChance -> (chance, needs_quest)
     // displayid is filled in IsValid() which must be called after
     LootStoreItem(uint32 _itemid, uint8 _type, float _chanceOrQuestChance, uint16 _lootmode, uint8 _group, int32 _mincountOrRef, uint32 _maxcount, std::vector<uint32> _itemBonuses)
         : itemid(_itemid), type(_type), chance(fabs(_chanceOrQuestChance)), mincountOrRef(_mincountOrRef), lootmode(_lootmode),
-        group(_group), needs_quest(_chanceOrQuestChance < 0), maxcount(_maxcount), itemBonuses(_itemBonuses)
+        group(_group), needs_quest(_chanceOrQuestChance < 0), maxcount(_maxcount), itemBonuses(_itemBonuses), proto(NULL)
          {}
 
+    // Template of the item, looked up if the entry was not compiled
+    ItemTemplate const* GetItemTemplate() const;
+
     bool Roll(bool rate, Player const* Player) const;                             // Checks if the entry takes it's chance (at loot generation)
     bool IsValid(LootStore const& store, uint32 entry) const;
                                                             // Checks correctness of values
@@ -235,6 +239,8 @@ class LootTemplate
     public:
         // Adds an entry to the group (at loading stage)
         void AddEntry(LootStoreItem& item);
+        // Resolves the item templates and builds the group distributions (after the last AddEntry)
+        void Compile();
         // Rolls for every item in the template and adds the rolled items the the loot
         void Process(Loot& loot, bool rate, uint16 lootMode, Player const* p_Player, uint8 groupId = 0) const;
         void CopyConditions(ConditionContainer conditions);
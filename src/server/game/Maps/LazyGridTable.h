@@ -0,0 +1,77 @@
+////////////////////////////////////////////////////////////////////////////////
+//
+//  MILLENIUM-STUDIO
+//  Copyright 2016 Millenium-studio SARL
+//  All Rights Reserved.
+//
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef TRINITY_LAZYGRIDTABLE_H
+#define TRINITY_LAZYGRIDTABLE_H
+
+#include "Define.h"
+#include "GridDefines.h"
+
+#include <atomic>
+
+/// MAX_NUMBER_OF_GRIDS x MAX_NUMBER_OF_GRIDS table of pointers, a row is only allocated once an entry of it is set.
+/// Instances only ever load a few grids, the full table would cost 32 KB to each of them.
+/// Rows are published with release semantics so a reader on another thread never sees an uninitialized row,
+/// entries keep the semantics of a plain pointer array.
+template<class T> class LazyGridTable
+{
+    public:
+        LazyGridTable() : m_Count(0), m_RowCount(0)
+        {
+            for (uint32 l_X = 0; l_X < MAX_NUMBER_OF_GRIDS; ++l_X)
+                m_Rows[l_X].store(nullptr, std::memory_order_relaxed);
+        }
+
+        ~LazyGridTable()
+        {
+            for (uint32 l_X = 0; l_X < MAX_NUMBER_OF_GRIDS; ++l_X)
+                delete[] m_Rows[l_X].load(std::memory_order_relaxed);
+        }
+
+        T* Get(uint32 p_X, uint32 p_Y) const
+        {
+            T* const* l_Row = m_Rows[p_X].load(std::memory_order_acquire);
+            return l_Row ? l_Row[p_Y] : nullptr;
+        }
+
+        void Set(uint32 p_X, uint32 p_Y, T* p_Value)
+        {
+            T** l_Row = m_Rows[p_X].load(std::memory_order_relaxed);
+            if (!l_Row)
+            {
+                if (!p_Value)
+                    return;
+
+                l_Row = new T*[MAX_NUMBER_OF_GRIDS]();
+                m_Rows[p_X].store(l_Row, std::memory_order_release);
+                ++m_RowCount;
+            }
+
+            if (!l_Row[p_Y] && p_Value)
+                ++m_Count;
+            else if (l_Row[p_Y] && !p_Value)
+                --m_Count;
+
+            l_Row[p_Y] = p_Value;
+        }
+
+        /// Entries currently set
+        uint32 GetCount() const { return m_Count; }
+
+        size_t GetMemorySize() const { return sizeof(*this) + m_RowCount * MAX_NUMBER_OF_GRIDS * sizeof(T*); }
+
+    private:
+        LazyGridTable(LazyGridTable const&);
+        LazyGridTable& operator=(LazyGridTable const&);
+
+        std::atomic<T**> m_Rows[MAX_NUMBER_OF_GRIDS];
+        uint32 m_Count;
+        uint32 m_RowCount;
+};
+
+#endif
@@ -25,9 +25,14 @@
 #include "DynamicTree.h"
 #include "Vehicle.h"
 #include "WildBattlePet.h"
+#include "PetBattle.h"
 #include "OutdoorPvPMgr.h"
 #include "DisableMgr.h"
 #include "Logger.h"
+#include "DynamicVisibility.h"
+
+#include <ace/TSS_T.h>
+#include <chrono>
 
 u_map_magic MapMagic        = { {'M','A','P','S'} };
 u_map_magic MapVersionMagic = { {'v','1','.','8'} };
@@ -68,6 +73,8 @@ Map::~Map()
         sScriptMgr->DecreaseScheduledScriptCount(m_scriptSchedule.size());
 
     MMAP::MMapFactory::createOrGetMMapManager()->unloadMapInstance(GetId(), i_InstanceId);
+
+    ObjectPoolMgr::ReleasePools(m_ObjectPools);
 }
 
 NGridType* Map::getNGrid(uint32 x, uint32 y) const
@@ -78,7 +85,7 @@ NGridType* Map::getNGrid(uint32 x, uint32 y) const
         sLog->outError(LOG_FILTER_GENERAL, "CRASH::map::setNGrid() Invalid grid coordinates found: %d, %d!", x, y);
         return NULL;
     }
-    return i_grids[x][y];
+    return i_grids.Get(x, y);
 }
 
 bool Map::ExistMap(uint32 mapid, int gx, int gy)
@@ -162,28 +169,28 @@ void Map::LoadMap(int gx, int gy, bool reload)
 {
     if (i_InstanceId != 0)
     {
-        if (GridMaps[gx][gy])
+        if (GridMaps.Get(gx, gy))
             return;
 
         // load grid map for base map
-        if (!m_parentMap->GridMaps[gx][gy])
+        if (!m_parentMap->GridMaps.Get(gx, gy))
             m_parentMap->EnsureGridCreated(GridCoord(63-gx, 63-gy));
 
         ((MapInstanced*)(m_parentMap))->AddGridMapReference(GridCoord(gx, gy));
-        GridMaps[gx][gy] = m_parentMap->GridMaps[gx][gy];
+        GridMaps.Set(gx, gy, m_parentMap->GridMaps.Get(gx, gy));
         return;
     }
 
-    if (GridMaps[gx][gy] && !reload)
+    if (GridMaps.Get(gx, gy) && !reload)
         return;
 
     //map already load, delete it before reloading (Is it necessary? Do we really need the ability the reload maps during runtime?)
-    if (GridMaps[gx][gy])
+    if (GridMaps.Get(gx, gy))
     {
         sLog->outInfo(LOG_FILTER_MAPS, "Unloading previously loaded map %u before reloading.", GetId());
 
-        delete (GridMaps[gx][gy]);
-        GridMaps[gx][gy]=NULL;
+        delete GridMaps.Get(gx, gy);
+        GridMaps.Set(gx, gy, NULL);
     }
 
     // map file name
@@ -193,8 +200,9 @@ void Map::LoadMap(int gx, int gy, bool reload)
     snprintf(tmp, len, (char *)(sWorld->GetDataPath()+"maps/%04u_%02u_%02u.map").c_str(), GetId(), gx, gy);
     sLog->outInfo(LOG_FILTER_MAPS, "Loading map %s", tmp);
     // loading data
-    GridMaps[gx][gy] = new GridMap();
-    if (!GridMaps[gx][gy]->loadData(tmp))
+    GridMap* l_GridMap = new GridMap();
+    GridMaps.Set(gx, gy, l_GridMap);
+    if (!l_GridMap->loadData(tmp))
     {
         sLog->outError(LOG_FILTER_MAPS, "Error loading map file: \n %s\n", tmp);
     }
@@ -234,18 +242,10 @@ _creatureToMoveLock(false), _gameObjectsToMoveLock(false), i_mapEntry(sMapStore.
 i_spawnMode(SpawnMode), i_InstanceId(InstanceId), m_unloadTimer(0), m_VisibleDistance(DEFAULT_VISIBILITY_DISTANCE),
 m_VisibilityNotifyPeriod(DEFAULT_VISIBILITY_NOTIFY_PERIOD),
 m_activeNonPlayersIter(m_activeNonPlayers.end()), _transportsGameObjectUpdateIter(_transportsGameObject.end()), _transportsUpdateIter(_transports.end()),
-i_gridExpiry(expiry), i_scriptLock(false)
+i_gridExpiry(expiry), i_scriptLock(false), m_GridUnloadsThisUpdate(0), m_VisibilityTimer(0)
 {
     m_parentMap = (_parent ? _parent : this);
-    for (unsigned int idx=0; idx < MAX_NUMBER_OF_GRIDS; ++idx)
-    {
-        for (unsigned int j=0; j < MAX_NUMBER_OF_GRIDS; ++j)
-        {
-            //z code
-            GridMaps[idx][j] =NULL;
-            setNGrid(NULL, idx, j);
-        }
-    }
+    m_ObjectPools = ObjectPoolMgr::CreatePools(id);
 
     //lets initialize visibility distance for map
     Map::InitVisibilityDistance();
@@ -412,7 +412,7 @@ void Map::EnsureGridCreated(const GridCoord &p)
             int gx = (MAX_NUMBER_OF_GRIDS - 1) - p.x_coord;
             int gy = (MAX_NUMBER_OF_GRIDS - 1) - p.y_coord;
 
-            if (!GridMaps[gx][gy])
+            if (!GridMaps.Get(gx, gy))
                 LoadMapAndVMap(gx, gy);
         }
     }
@@ -421,7 +421,8 @@ void Map::EnsureGridCreated(const GridCoord &p)
 //Load NGrid and make it active
 void Map::EnsureGridLoadedForActiveObject(const Cell &cell, WorldObject* object)
 {
-    EnsureGridLoaded(cell);
+    /// Players walking or teleporting into a grid don't need its spawns in the same update
+    EnsureGridLoaded(cell, object->GetTypeId() == TYPEID_PLAYER && CanDeferGridLoading());
     NGridType *grid = getNGrid(cell.GridX(), cell.GridY());
     ASSERT(grid != NULL);
 
@@ -431,11 +432,14 @@ void Map::EnsureGridLoadedForActiveObject(const Cell &cell, WorldObject* object)
         sLog->outDebug(LOG_FILTER_MAPS, "Active object " UI64FMTD " triggers loading of grid [%u, %u] on map %u", object->GetGUID(), cell.GridX(), cell.GridY(), GetId());
         ResetGridExpiry(*grid, 0.1f);
         grid->SetGridState(GRID_STATE_ACTIVE);
+
+        sWildBattlePetMgr->OnGridActivated(this, cell.GridX(), cell.GridY());
     }
 }
 
 //Create NGrid and load the object data in it
-bool Map::EnsureGridLoaded(const Cell &cell)
+//Creatures and gameobjects of a deferred load are added later by UpdateGridLoadQueue
+bool Map::EnsureGridLoaded(const Cell &cell, bool p_Deferred /*= false*/)
 {
     EnsureGridCreated(GridCoord(cell.GridX(), cell.GridY()));
     NGridType *grid = getNGrid(cell.GridX(), cell.GridY());
@@ -447,8 +451,22 @@ bool Map::EnsureGridLoaded(const Cell &cell)
 
         setGridObjectDataLoaded(true, cell.GridX(), cell.GridY());
 
+        uint32 l_StartTime = getMSTime();
+
         ObjectGridLoader loader(*grid, this, cell);
-        loader.LoadN();
+        loader.LoadN(!p_Deferred);
+
+        if (p_Deferred)
+            QueueGridLoad(*grid, cell);
+        else
+        {
+            uint32 l_LoadTime = GetMSTimeDiffToNow(l_StartTime);
+
+            ++m_GridLoadStats.SyncLoads;
+            m_GridLoadStats.LastLoadTime   = l_LoadTime;
+            m_GridLoadStats.MaxLoadTime    = std::max(m_GridLoadStats.MaxLoadTime, l_LoadTime);
+            m_GridLoadStats.TotalLoadTime += l_LoadTime;
+        }
 
         // Add resurrectable corpses to world object list in grid
         sObjectAccessor->AddCorpsesToGrid(GridCoord(cell.GridX(), cell.GridY()), grid->GetGridType(cell.CellX(), cell.CellY()), this);
@@ -456,9 +474,278 @@ bool Map::EnsureGridLoaded(const Cell &cell)
         return true;
     }
 
+    /// Explicit load request (LoadGrid, visit with grid creation) on a grid still being loaded in slices
+    if (!p_Deferred && !cell.NoCreate() && (!m_GridLoadQueue.empty() || !m_GridLoadBatch.empty()))
+        FlushGridLoadJob(*grid);
+
+    return false;
+}
+
+/// Runs the thread safe part of a deferred grid load on a MapUpdater thread
+/// The map can prepare the job itself if it needs the grid before this request runs
+class GridLoadPrepareRequest : public MapUpdaterTask
+{
+    public:
+        GridLoadPrepareRequest(MapUpdater* p_Updater, GridLoadJobPtr const& p_Job)
+            : MapUpdaterTask(p_Updater), m_Job(p_Job)
+        {
+        }
+
+        void call() override
+        {
+            ObjectGridLoader::PrepareGridLoadJob(*m_Job);
+            m_Job.reset();
+            UpdateFinished();
+        }
+
+    private:
+        GridLoadJobPtr m_Job;
+};
+
+bool Map::CanDeferGridLoading() const
+{
+    /// Instances, battlegrounds and garrisons rely on their spawns being there when the first player enters
+    return sWorld->getBoolConfig(CONFIG_GRID_LOADING_DEFERRED) && !Instanceable();
+}
+
+void Map::QueueGridLoad(NGridType& p_Grid, Cell const& p_Cell)
+{
+    GridLoadJobPtr l_Job = std::make_shared<GridLoadJob>(&p_Grid, p_Cell, GetId(), GetSpawnMode(), m_ObjectPools);
+    m_GridLoadQueue.push_back(l_Job);
+
+    ++m_GridLoadStats.DeferredLoads;
+    ++m_GridLoadStats.PendingGrids;
+
+    MapUpdater* l_Updater = sMapMgr->GetMapUpdater();
+    if (l_Updater->activated())
+        l_Updater->schedule_specific(new GridLoadPrepareRequest(l_Updater, l_Job));
+    else
+        ObjectGridLoader::PrepareGridLoadJob(*l_Job);
+}
+
+template<class T, class D>
+void Map::CommitGridLoadObject(T* p_Object, uint32 p_Guid, D const* p_Data, Cell const& p_Cell)
+{
+    if (!p_Object->LoadFromDB(p_Guid, this, p_Data))
+    {
+        delete p_Object;
+        return;
+    }
+
+    AddToGrid(p_Object, p_Cell);
+    p_Object->AddToWorld();
+
+    if (p_Object->isActiveObject())
+        AddToActive(p_Object);
+
+    /// Unlike a synchronous load, players can already be in range of the new object
+    p_Object->UpdateObjectVisibility(false);
+
+    ++m_GridLoadStats.CommittedObjects;
+}
+
+bool Map::CommitGridLoadJob(GridLoadJob& p_Job, uint32& p_Committed, uint32 p_MaxObjects, uint32 p_StartTime, uint32 p_TimeBudget)
+{
+    uint32 l_SliceStartTime = getMSTime();
+
+    while (p_Job.CellIndex < p_Job.Cells.size())
+    {
+        GridLoadJob::CellSpawns& l_Spawns = p_Job.Cells[p_Job.CellIndex];
+
+        /// Creatures first, then gameobjects, as ObjectGridLoader::LoadN does
+        if (p_Job.SpawnIndex >= l_Spawns.Creatures.size() + l_Spawns.GameObjects.size())
+        {
+            ++p_Job.CellIndex;
+            p_Job.SpawnIndex = 0;
+            continue;
+        }
+
+        if (p_MaxObjects && p_Committed >= p_MaxObjects)
+            break;
+
+        if (p_TimeBudget && GetMSTimeDiffToNow(p_StartTime) >= p_TimeBudget)
+            break;
+
+        if (p_Job.SpawnIndex < l_Spawns.Creatures.size())
+        {
+            auto& l_Spawn = l_Spawns.Creatures[p_Job.SpawnIndex];
+            CommitGridLoadObject(l_Spawn.Object, l_Spawn.Guid, l_Spawn.Data, l_Spawns.SpawnCell);
+        }
+        else
+        {
+            auto& l_Spawn = l_Spawns.GameObjects[p_Job.SpawnIndex - l_Spawns.Creatures.size()];
+            CommitGridLoadObject(l_Spawn.Object, l_Spawn.Guid, l_Spawn.Data, l_Spawns.SpawnCell);
+        }
+
+        ++p_Job.SpawnIndex;
+        ++p_Committed;
+    }
+
+    uint32 l_SliceTime = GetMSTimeDiffToNow(l_SliceStartTime);
+    p_Job.CommitTime += l_SliceTime;
+    m_GridLoadStats.MaxCommitTime = std::max(m_GridLoadStats.MaxCommitTime, l_SliceTime);
+
+    if (p_Job.CellIndex < p_Job.Cells.size())
+        return false;
+
+    uint32 l_LoadTime = p_Job.PrepareTime + p_Job.CommitTime;
+    m_GridLoadStats.LastLoadTime    = l_LoadTime;
+    m_GridLoadStats.MaxLoadTime     = std::max(m_GridLoadStats.MaxLoadTime, l_LoadTime);
+    m_GridLoadStats.TotalLoadTime  += l_LoadTime;
+    m_GridLoadStats.MaxPrepareTime  = std::max(m_GridLoadStats.MaxPrepareTime, p_Job.PrepareTime);
+
+    sLog->outDebug(LOG_FILTER_MAPS, "Deferred load of grid[%u, %u] on map %u done: %u objects, prepared in %u ms, committed in %u ms, %u ms after being queued",
+        p_Job.Grid->getX(), p_Job.Grid->getY(), GetId(), p_Job.ObjectCount, p_Job.PrepareTime, p_Job.CommitTime, GetMSTimeDiffToNow(p_Job.QueueTime));
+
+    Balance();
+    return true;
+}
+
+void Map::UpdateGridLoadQueue()
+{
+    if (m_GridLoadQueue.empty())
+        return;
+
+    uint32 l_MaxObjects  = sWorld->getIntConfig(CONFIG_GRID_LOADING_OBJECTS_PER_UPDATE);
+    uint32 l_TimeBudget  = sWorld->getIntConfig(CONFIG_GRID_LOADING_TIME_BUDGET);
+    uint32 l_StartTime   = getMSTime();
+    uint32 l_Committed   = 0;
+
+    /// Committed objects can queue, flush or cancel grid loads themselves, the jobs of this batch
+    /// stay reachable from FlushGridLoadJob / CancelGridLoadJob until they are committed
+    m_GridLoadBatch.splice(m_GridLoadBatch.end(), m_GridLoadQueue);
+
+    m_GridLoadStats.PendingObjects = 0;
+
+    while (!m_GridLoadBatch.empty())
+    {
+        GridLoadJobPtr l_Job = m_GridLoadBatch.front();
+        m_GridLoadBatch.pop_front();
+
+        /// Still in the hands of a MapUpdater thread, scheduled during this update
+        if (!l_Job->Prepared.load(std::memory_order_acquire))
+        {
+            m_GridLoadQueue.push_back(l_Job);
+            continue;
+        }
+
+        if (CommitGridLoadJob(*l_Job, l_Committed, l_MaxObjects, l_StartTime, l_TimeBudget))
+            continue;
+
+        uint32 l_Done = l_Job->SpawnIndex;
+        for (uint32 l_I = 0; l_I < l_Job->CellIndex; ++l_I)
+            l_Done += l_Job->Cells[l_I].Creatures.size() + l_Job->Cells[l_I].GameObjects.size();
+
+        m_GridLoadStats.PendingObjects += l_Job->ObjectCount - l_Done;
+        m_GridLoadQueue.push_back(l_Job);
+    }
+
+    m_GridLoadStats.PendingGrids = m_GridLoadQueue.size();
+}
+
+void Map::WaitGridLoadJob(GridLoadJob& p_Job)
+{
+    /// The request may still sit in the MapUpdater queue behind this very map, don't wait for it
+    if (ObjectGridLoader::PrepareGridLoadJob(p_Job))
+        return;
+
+    while (!p_Job.Prepared.load(std::memory_order_acquire))
+        std::this_thread::yield();
+}
+
+GridLoadJobPtr Map::TakeGridLoadJob(NGridType const& p_Grid)
+{
+    std::list<GridLoadJobPtr>* l_Lists[] = { &m_GridLoadQueue, &m_GridLoadBatch };
+    for (std::list<GridLoadJobPtr>* l_List : l_Lists)
+    {
+        for (std::list<GridLoadJobPtr>::iterator l_Itr = l_List->begin(); l_Itr != l_List->end(); ++l_Itr)
+        {
+            if ((*l_Itr)->Grid != &p_Grid)
+                continue;
+
+            GridLoadJobPtr l_Job = *l_Itr;
+            l_List->erase(l_Itr);
+            return l_Job;
+        }
+    }
+
+    return GridLoadJobPtr();
+}
+
+void Map::FlushGridLoadJob(NGridType const& p_Grid)
+{
+    /// Taken first, committing objects can request grid loads again
+    GridLoadJobPtr l_Job = TakeGridLoadJob(p_Grid);
+    if (!l_Job)
+        return;
+
+    WaitGridLoadJob(*l_Job);
+
+    uint32 l_Committed = 0;
+    CommitGridLoadJob(*l_Job, l_Committed, 0, getMSTime(), 0);
+
+    m_GridLoadStats.PendingGrids = m_GridLoadQueue.size() + m_GridLoadBatch.size();
+}
+
+void Map::CancelGridLoadJob(NGridType const& p_Grid)
+{
+    GridLoadJobPtr l_Job = TakeGridLoadJob(p_Grid);
+    if (!l_Job)
+        return;
+
+    ObjectGridLoader::DiscardGridLoadJob(*l_Job);
+
+    m_GridLoadStats.PendingGrids = m_GridLoadQueue.size() + m_GridLoadBatch.size();
+}
+
+bool Map::HasGridUnloadBudget()
+{
+    uint32 l_MaxUnloads = sWorld->getIntConfig(CONFIG_GRID_UNLOAD_MAX_PER_UPDATE);
+    if (!l_MaxUnloads || m_GridUnloadsThisUpdate < l_MaxUnloads)
+        return true;
+
+    ++m_GridLoadStats.DeferredUnloads;
     return false;
 }
 
+/// Counts the creatures and gameobjects of a grid, for BuildInstanceMemoryReport
+class InstanceObjectCounter
+{
+    public:
+        InstanceObjectCounter() : Creatures(0), GameObjects(0) { }
+
+        void Visit(CreatureMapType& p_Creatures) { Creatures += p_Creatures.getSize(); }
+        void Visit(GameObjectMapType& p_GameObjects) { GameObjects += p_GameObjects.getSize(); }
+        template<class T> void Visit(GridRefManager<T>&) { }
+
+        uint32 Creatures;
+        uint32 GameObjects;
+};
+
+void Map::BuildInstanceMemoryReport(InstanceMemoryReport& p_Report) const
+{
+    InstanceObjectCounter l_Counter;
+    TypeContainerVisitor<InstanceObjectCounter, GridTypeMapContainer> l_Visitor(l_Counter);
+
+    for (uint32 l_X = 0; l_X < MAX_NUMBER_OF_GRIDS; ++l_X)
+    {
+        for (uint32 l_Y = 0; l_Y < MAX_NUMBER_OF_GRIDS; ++l_Y)
+        {
+            if (NGridType* l_Grid = getNGrid(l_X, l_Y))
+                l_Grid->VisitAllGrids(l_Visitor);
+        }
+    }
+
+    p_Report.Players        = m_mapRefManager.getSize();
+    p_Report.LoadedGrids    = i_grids.GetCount();
+    p_Report.Creatures      = l_Counter.Creatures;
+    p_Report.GameObjects    = l_Counter.GameObjects;
+    p_Report.MapBytes       = sizeof(Map);
+    p_Report.GridTableBytes = i_grids.GetMemorySize() + GridMaps.GetMemorySize();
+    p_Report.GridBytes      = p_Report.LoadedGrids * sizeof(NGridType);
+    p_Report.ObjectBytes    = p_Report.Creatures * sizeof(Creature) + p_Report.GameObjects * sizeof(GameObject);
+}
+
 void Map::LoadGrid(float x, float y)
 {
     EnsureGridLoaded(Cell(x, y));
@@ -476,6 +763,7 @@ bool Map::AddPlayerToMap(Player* player, bool p_Switched /*= false*/)
     Cell cell(cellCoord);
     EnsureGridLoadedForActiveObject(cell, player);
     AddToGrid(player, cell);
+    m_PlayerSpatialHash.Insert(player, player->GetPositionX(), player->GetPositionY());
 
     // Check if we are adding to correct map
     ASSERT (player->GetMap() == this);
@@ -584,6 +872,47 @@ bool Map::IsGridLoaded(const GridCoord &p) const
     return (getNGrid(p.x_coord, p.y_coord) && isGridObjectDataLoaded(p.x_coord, p.y_coord));
 }
 
+/// Cells visited by the Map::Update running on this thread. A thread updates one map at a time, so
+/// one bitset per thread replaces the one of each map, and only the marked cells are cleared again.
+struct MarkedCells
+{
+    std::bitset<TOTAL_NUMBER_OF_CELLS_PER_MAP*TOTAL_NUMBER_OF_CELLS_PER_MAP> Bits;
+    std::vector<uint32> Marked;
+};
+
+/// thread_local only holds POD types on every compiler we support, ACE_TSS frees the bitset of a thread when it exits
+typedef ACE_TSS<MarkedCells> MarkedCellsTSS;
+static MarkedCellsTSS g_MarkedCells;
+
+static MarkedCells& GetMarkedCells()
+{
+    /// Created on the first use of each thread
+    return *static_cast<MarkedCells*>(g_MarkedCells);
+}
+
+void Map::resetMarkedCells()
+{
+    MarkedCells& l_Cells = GetMarkedCells();
+
+    for (uint32 l_CellId : l_Cells.Marked)
+        l_Cells.Bits.reset(l_CellId);
+
+    l_Cells.Marked.clear();
+}
+
+bool Map::isCellMarked(uint32 pCellId)
+{
+    return GetMarkedCells().Bits.test(pCellId);
+}
+
+void Map::markCell(uint32 pCellId)
+{
+    MarkedCells& l_Cells = GetMarkedCells();
+
+    l_Cells.Bits.set(pCellId);
+    l_Cells.Marked.push_back(pCellId);
+}
+
 void Map::VisitNearbyCellsOf(WorldObject* obj, TypeContainerVisitor<JadeCore::ObjectUpdater, GridTypeMapContainer> &gridVisitor, TypeContainerVisitor<JadeCore::ObjectUpdater, WorldTypeMapContainer> &worldVisitor)
 {
     // Check for valid position
@@ -621,6 +950,11 @@ void Map::Update(const uint32 t_diff)
 
     uint32 l_Time = getMSTime();
 
+    /// Objects spawned during the update go to the pools of this map
+    ObjectPoolMapScope l_PoolScope(m_ObjectPools);
+
+    UpdateGridLoadQueue();
+
     _dynamicTree.update(t_diff);
     /// update worldsessions for existing players
     for (m_mapRefIter = m_mapRefManager.begin(); m_mapRefIter != m_mapRefManager.end(); ++m_mapRefIter)
@@ -645,6 +979,11 @@ void Map::Update(const uint32 t_diff)
             session->Update(t_diff, updater);
         }
     }
+
+    /// Pet battles of the players of this map, their moves were handled in place by the world thread before the map update
+    if (!m_PetBattles.empty())
+        sPetBattleSystem->UpdateMapBattles(m_PetBattles, t_diff);
+
     /// update active cells around players and active objects
     resetMarkedCells();
 
@@ -679,6 +1018,9 @@ void Map::Update(const uint32 t_diff)
         // update players at tick
         player->Update(t_diff);
 
+        /// Criteria updates of the player are batched per tick, on its map thread
+        player->ProcessAchievementCriteriaEvents();
+
         VisitNearbyCellsOf(player, grid_object_update, world_object_update);
     }
 
@@ -727,6 +1069,8 @@ void Map::Update(const uint32 t_diff)
     MoveAllCreaturesInMoveList();
     MoveAllGameObjectsInMoveList();
 
+    ProcessVisibilityUpdates(t_diff);
+
     sScriptMgr->OnMapUpdate(this, t_diff);
 
 #ifdef CROSS
@@ -734,6 +1078,91 @@ void Map::Update(const uint32 t_diff)
 #endif
 }
 
+void Map::ScheduleVisibilityUpdate(Unit* p_Unit)
+{
+    ++m_VisibilityStats.Requests;
+
+    if (p_Unit->IsVisibilityUpdatePending())
+    {
+        ++m_VisibilityStats.Merged;
+        return;
+    }
+
+    p_Unit->SetVisibilityUpdateSlot(uint32(m_VisibilityMovers.size()));
+    m_VisibilityMovers.push_back(p_Unit);
+}
+
+void Map::CancelVisibilityUpdate(Unit* p_Unit)
+{
+    /// Keep the slot, the list can be iterated by ProcessVisibilityUpdates
+    m_VisibilityMovers[p_Unit->GetVisibilityUpdateSlot()] = nullptr;
+    p_Unit->SetVisibilityUpdateSlot(Unit::NoVisibilityUpdateSlot);
+}
+
+void Map::ProcessVisibilityUpdates(uint32 p_Diff)
+{
+    m_VisibilityTimer += p_Diff;
+
+    if (m_VisibilityMovers.empty() || m_VisibilityTimer < DynamicVisibilityMgr::GetVisibilityNotifyDelay(m_VisibilityStats.Level))
+        return;
+
+    m_VisibilityTimer = 0;
+
+    auto l_StartTime = std::chrono::steady_clock::now();
+
+    /// Process movers cell by cell, neighbours share most of the visited cells
+    std::sort(m_VisibilityMovers.begin(), m_VisibilityMovers.end(), [](Unit const* p_Left, Unit const* p_Right) -> bool
+    {
+        if (!p_Left || !p_Right)
+            return p_Left != nullptr && p_Right == nullptr;
+
+        CellCoord l_Left  = JadeCore::ComputeCellCoord(p_Left->GetPositionX(), p_Left->GetPositionY());
+        CellCoord l_Right = JadeCore::ComputeCellCoord(p_Right->GetPositionX(), p_Right->GetPositionY());
+        return l_Left.GetId() < l_Right.GetId();
+    });
+
+    for (size_t l_I = 0; l_I < m_VisibilityMovers.size() && m_VisibilityMovers[l_I]; ++l_I)
+        m_VisibilityMovers[l_I]->SetVisibilityUpdateSlot(uint32(l_I));
+
+    float l_MinDistanceSq = DynamicVisibilityMgr::GetReqMoveDistSq(m_VisibilityStats.Level, GetEntry()->instanceType);
+
+    /// Units scheduled during the pass are kept for the next one
+    size_t l_Count = m_VisibilityMovers.size();
+    uint32 l_Movers = 0;
+    for (size_t l_I = 0; l_I < l_Count; ++l_I)
+    {
+        Unit* l_Unit = m_VisibilityMovers[l_I];
+        if (!l_Unit)
+            continue;
+
+        m_VisibilityMovers[l_I] = nullptr;
+        l_Unit->SetVisibilityUpdateSlot(Unit::NoVisibilityUpdateSlot);
+        ++l_Movers;
+
+        if (l_Unit->UpdateVisibilityAfterMove(l_MinDistanceSq))
+            ++m_VisibilityStats.Processed;
+        else
+            ++m_VisibilityStats.SkippedByDistance;
+    }
+
+    m_VisibilityMovers.erase(m_VisibilityMovers.begin(), m_VisibilityMovers.begin() + l_Count);
+
+    for (size_t l_I = 0; l_I < m_VisibilityMovers.size(); ++l_I)
+    {
+        if (m_VisibilityMovers[l_I])
+            m_VisibilityMovers[l_I]->SetVisibilityUpdateSlot(uint32(l_I));
+    }
+
+    uint32 l_PassTime = uint32(std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - l_StartTime).count());
+
+    ++m_VisibilityStats.Passes;
+    m_VisibilityStats.LastMovers        = l_Movers;
+    m_VisibilityStats.LastPassTime      = l_PassTime;
+    m_VisibilityStats.MaxPassTime       = std::max(m_VisibilityStats.MaxPassTime, l_PassTime);
+    m_VisibilityStats.SmoothedPassTime  = (m_VisibilityStats.SmoothedPassTime * 7 + l_PassTime) / 8;
+    m_VisibilityStats.Level             = DynamicVisibilityMgr::ComputeLevel(m_VisibilityStats.Level, m_VisibilityStats.SmoothedPassTime);
+}
+
 void Map::RemovePlayerFromMap(Player* player, bool remove)
 {
     player->RemoveFromWorld();
@@ -741,6 +1170,7 @@ void Map::RemovePlayerFromMap(Player* player, bool remove)
     sOutdoorPvPMgr->HandlePlayerLeaveMap(player, GetId());
 
     player->UpdateObjectVisibility(true);
+    m_PlayerSpatialHash.Remove(player);
     if (player->IsInGrid())
         player->RemoveFromGrid();
     else
@@ -849,6 +1279,7 @@ void Map::PlayerRelocation(Player* player, float x, float y, float z, float orie
 
     player->Relocate(x, y, z, orientation);
     player->m_movementInfo.pos.Relocate(x, y, z, orientation);
+    m_PlayerSpatialHash.Relocate(player, x, y);
 
     if (player->IsVehicle())
         player->GetVehicleKit()->RelocatePassengers();
@@ -868,6 +1299,21 @@ void Map::PlayerRelocation(Player* player, float x, float y, float z, float orie
     player->UpdateObjectVisibility(false);
 }
 
+void Map::GetPlayerListInRange(WorldObject const* p_Center, float p_Range, std::list<Player*>& p_Players, bool p_RequireAlive /*= true*/, bool p_Self /*= false*/) const
+{
+    /// Same filters than a PlayerListSearcher with AnyPlayerInObjectRangeCheck
+    JadeCore::AnyPlayerInObjectRangeCheck l_Check(p_Center, p_Range, p_RequireAlive, p_Self);
+    uint32 l_PhaseMask = p_Center->GetPhaseMask();
+
+    auto l_Worker = [&l_Check, &p_Players, l_PhaseMask](Player* p_Player) -> void
+    {
+        if (p_Player->InSamePhase(l_PhaseMask) && l_Check(p_Player))
+            p_Players.push_back(p_Player);
+    };
+
+    m_PlayerSpatialHash.Visit(p_Center->GetPositionX(), p_Center->GetPositionY(), p_Range, l_Worker);
+}
+
 void Map::CreatureRelocation(Creature* creature, float x, float y, float z, float ang, bool respawnRelocationOnFail)
 {
     ASSERT(CheckGridIntegrity(creature, false));
@@ -899,6 +1345,7 @@ void Map::CreatureRelocation(Creature* creature, float x, float y, float z, floa
         if (creature->IsVehicle())
             creature->GetVehicleKit()->RelocatePassengers();
         creature->UpdateObjectVisibility(false);
+        creature->UpdateVignettePositions();
         RemoveCreatureFromMoveList(creature);
     }
 
@@ -1018,6 +1465,7 @@ void Map::MoveAllCreaturesInMoveList()
             c->Relocate(c->_newPosition);
             //c->SendMovementFlagUpdate(); possible creature crash fix.
             c->UpdateObjectVisibility(false);
+            c->UpdateVignettePositions();
         }
         else
         {
@@ -1282,6 +1730,8 @@ bool Map::UnloadGrid(NGridType& ngrid, bool unloadAll)
 
         sLog->outDebug(LOG_FILTER_MAPS, "Unloading grid[%u, %u] for map %u", x, y, GetId());
 
+        CancelGridLoadJob(ngrid);
+
         if (!unloadAll)
         {
             // Finish creature moves, remove and delete all creatures with delayed remove before moving to respawn grids
@@ -1317,6 +1767,12 @@ bool Map::UnloadGrid(NGridType& ngrid, bool unloadAll)
 
         delete &ngrid;
         setNGrid(NULL, x, y);
+
+        if (!unloadAll)
+        {
+            ++m_GridUnloadsThisUpdate;
+            ++m_GridLoadStats.Unloads;
+        }
     }
     int gx = (MAX_NUMBER_OF_GRIDS - 1) - x;
     int gy = (MAX_NUMBER_OF_GRIDS - 1) - y;
@@ -1326,10 +1782,10 @@ bool Map::UnloadGrid(NGridType& ngrid, bool unloadAll)
     {
         if (i_InstanceId == 0)
         {
-            if (GridMaps[gx][gy])
+            if (GridMaps.Get(gx, gy))
             {
-                GridMaps[gx][gy]->unloadData();
-                delete GridMaps[gx][gy];
+                GridMaps.Get(gx, gy)->unloadData();
+                delete GridMaps.Get(gx, gy);
             }
 
             VMAP::VMapFactory::createOrGetVMapManager()->unloadMap(GetId(), gx, gy);
@@ -1338,7 +1794,7 @@ bool Map::UnloadGrid(NGridType& ngrid, bool unloadAll)
         else
             ((MapInstanced*)m_parentMap)->RemoveGridMapReference(GridCoord(gx, gy));
 
-        GridMaps[gx][gy] = NULL;
+        GridMaps.Set(gx, gy, NULL);
     }
     sLog->outDebug(LOG_FILTER_MAPS, "Unloading grid[%u, %u] for map %u finished", x, y, GetId());
     return true;
@@ -1367,6 +1823,19 @@ void Map::UnloadAll()
     _creaturesToMove.clear();
     _gameObjectsToMove.clear();
 
+    /// Objects of pending deferred loads are not in any grid yet, delete them first
+    std::list<GridLoadJobPtr>* l_Lists[] = { &m_GridLoadQueue, &m_GridLoadBatch };
+    for (std::list<GridLoadJobPtr>* l_List : l_Lists)
+    {
+        for (GridLoadJobPtr const& l_Job : *l_List)
+            ObjectGridLoader::DiscardGridLoadJob(*l_Job);
+
+        l_List->clear();
+    }
+
+    m_GridLoadStats.PendingGrids   = 0;
+    m_GridLoadStats.PendingObjects = 0;
+
     for (GridRefManager<NGridType>::iterator i = GridRefManager<NGridType>::begin(); i != GridRefManager<NGridType>::end();)
     {
         NGridType &grid(*i->getSource());
@@ -2019,7 +2488,7 @@ inline GridMap* Map::GetGrid(float x, float y)
     // ensure GridMap is loaded
     EnsureGridCreated(GridCoord((MAX_NUMBER_OF_GRIDS - 1) - gx, (MAX_NUMBER_OF_GRIDS - 1) - gy));
 
-    return GridMaps[gx][gy];
+    return GridMaps.Get(gx, gy);
 }
 
 float Map::GetWaterOrGroundLevel(float x, float y, float z, float* ground /*= NULL*/, bool /*swim = false*/) const
@@ -2312,6 +2781,25 @@ uint32 Map::GetZoneIdByAreaFlag(uint16 areaflag, uint32 map_id)
         return 0;
 }
 
+void Map::GetGridZones(uint32 p_GridX, uint32 p_GridY, std::vector<uint32>& p_Zones)
+{
+    for (uint32 l_CellX = 0; l_CellX < MAX_NUMBER_OF_CELLS; ++l_CellX)
+    {
+        for (uint32 l_CellY = 0; l_CellY < MAX_NUMBER_OF_CELLS; ++l_CellY)
+        {
+            /// Inverse of JadeCore::ComputeCellCoord
+            float l_X = (float(p_GridX * MAX_NUMBER_OF_CELLS + l_CellX) - CENTER_GRID_CELL_ID) * SIZE_OF_GRID_CELL + CENTER_GRID_CELL_OFFSET;
+            float l_Y = (float(p_GridY * MAX_NUMBER_OF_CELLS + l_CellY) - CENTER_GRID_CELL_ID) * SIZE_OF_GRID_CELL + CENTER_GRID_CELL_OFFSET;
+
+            GridMap* l_GridMap = GetGrid(l_X, l_Y);
+            uint32 l_Zone = GetZoneIdByAreaFlag(l_GridMap ? l_GridMap->getArea(l_X, l_Y) : GetAreaFlagByMapId(i_mapEntry->MapID), GetId());
+
+            if (l_Zone && std::find(p_Zones.begin(), p_Zones.end(), l_Zone) == p_Zones.end())
+                p_Zones.push_back(l_Zone);
+        }
+    }
+}
+
 void Map::GetZoneAndAreaIdByAreaFlag(uint32& zoneid, uint32& areaid, uint16 areaflag, uint32 map_id)
 {
     AreaTableEntry const* entry = GetAreaEntryByAreaFlagAndMap(areaflag, map_id);
@@ -2495,13 +2983,15 @@ inline void Map::setNGrid(NGridType *grid, uint32 x, uint32 y)
         sLog->outError(LOG_FILTER_MAPS, "map::setNGrid() Invalid grid coordinates found: %d, %d!", x, y);
         ASSERT(false);
     }
-    i_grids[x][y] = grid;
+    i_grids.Set(x, y, grid);
 }
 
 void Map::DelayedUpdate(const uint32 t_diff)
 {
     RemoveAllObjectsInRemoveList();
 
+    m_GridUnloadsThisUpdate = 0;
+
     // Don't unload grids if it's battleground, since we may have manually added GOs, creatures, those doesn't load from DB at grid re-load !
     // This isn't really bother us, since as soon as we have instanced BG-s, the whole map unloads as the BG gets ended
     if (!IsBattlegroundOrArena())
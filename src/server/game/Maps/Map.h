@@ -21,6 +21,8 @@
 #include "DynamicTree.h"
 #include "GameObjectModel.h"
 #include "Common.h"
+#include "PlayerSpatialHash.h"
+#include "LazyGridTable.h"
 
 #include <bitset>
 
@@ -41,6 +43,8 @@ class Battleground;
 class MapInstanced;
 class InstanceMap;
 class Transport;
+struct GridLoadJob;
+struct ObjectPoolSet;
 namespace JadeCore { struct ObjectUpdater; }
 
 struct ScriptAction
@@ -112,6 +116,68 @@ struct map_liquidHeader
     float  liquidLevel;
 };
 
+/// Grid loading / unloading counters of a map, see .debug stats gridload
+struct GridLoadStats
+{
+    GridLoadStats()
+        : SyncLoads(0), DeferredLoads(0), CommittedObjects(0), LastLoadTime(0), MaxLoadTime(0), TotalLoadTime(0),
+        MaxPrepareTime(0), MaxCommitTime(0), Unloads(0), DeferredUnloads(0), PendingGrids(0), PendingObjects(0)
+    {
+    }
+
+    uint32 SyncLoads;           ///< Grids loaded at once on the map thread
+    uint32 DeferredLoads;       ///< Grids loaded through a GridLoadJob
+    uint32 CommittedObjects;    ///< Objects added to the map by GridLoadJob commits
+    uint32 LastLoadTime;        ///< In ms, prepare + commit time for deferred loads
+    uint32 MaxLoadTime;
+    uint64 TotalLoadTime;
+    uint32 MaxPrepareTime;      ///< Longest off-thread preparation
+    uint32 MaxCommitTime;       ///< Longest commit slice in a single update
+    uint32 Unloads;
+    uint32 DeferredUnloads;     ///< Grid unloads postponed by GridUnload.MaxPerUpdate
+    uint32 PendingGrids;
+    uint32 PendingObjects;
+};
+
+/// Memory owned by a map instance, see .debug stats instancememory
+struct InstanceMemoryReport
+{
+    InstanceMemoryReport()
+        : Players(0), LoadedGrids(0), Creatures(0), GameObjects(0), MapBytes(0), GridTableBytes(0), GridBytes(0), ObjectBytes(0)
+    {
+    }
+
+    uint32 Players;
+    uint32 LoadedGrids;
+    uint32 Creatures;
+    uint32 GameObjects;
+    size_t MapBytes;
+    size_t GridTableBytes;      ///< NGrid and GridMap tables, only the rows in use are allocated
+    size_t GridBytes;
+    size_t ObjectBytes;         ///< sizeof() of the creatures and gameobjects, without their own allocations
+};
+
+/// Batched visibility pass counters of a map, see .debug stats visibility
+struct VisibilityStats
+{
+    VisibilityStats()
+        : Requests(0), Merged(0), Passes(0), Processed(0), SkippedByDistance(0), LastMovers(0),
+        LastPassTime(0), MaxPassTime(0), SmoothedPassTime(0), Level(0)
+    {
+    }
+
+    uint64 Requests;            ///< Unit::UpdateObjectVisibility(false) calls
+    uint64 Merged;              ///< Requests for a unit already waiting for the pass
+    uint32 Passes;
+    uint64 Processed;           ///< Units whose visibility was recomputed
+    uint64 SkippedByDistance;   ///< Units which didn't move enough since their last update
+    uint32 LastMovers;
+    uint32 LastPassTime;        ///< In microseconds
+    uint32 MaxPassTime;
+    uint32 SmoothedPassTime;    ///< Drives the DynamicVisibilityMgr level of the map
+    uint8 Level;
+};
+
 enum ZLiquidStatus
 {
     LIQUID_MAP_NO_WATER     = 0x00000000,
@@ -286,12 +352,24 @@ class Map : public GridRefManager<NGridType>
 
         template<class T, class CONTAINER> void Visit(const Cell& cell, TypeContainerVisitor<T, CONTAINER> &visitor);
 
+        /// Player only range queries, don't walk the cells and their non player containers
+        PlayerSpatialHash& GetPlayerSpatialHash() { return m_PlayerSpatialHash; }
+        template<class Worker> void VisitPlayersInRange(float p_X, float p_Y, float p_Range, Worker& p_Worker) const { m_PlayerSpatialHash.Visit(p_X, p_Y, p_Range, p_Worker); }
+        void GetPlayerListInRange(WorldObject const* p_Center, float p_Range, std::list<Player*>& p_Players, bool p_RequireAlive = true, bool p_Self = false) const;
+
         bool IsRemovalGrid(float x, float y) const
         {
             GridCoord p = JadeCore::ComputeGridCoord(x, y);
             return !getNGrid(p.x_coord, p.y_coord) || getNGrid(p.x_coord, p.y_coord)->GetGridState() == GRID_STATE_REMOVAL;
         }
 
+        bool IsGridActive(float x, float y) const
+        {
+            GridCoord p = JadeCore::ComputeGridCoord(x, y);
+            NGridType* l_Grid = getNGrid(p.x_coord, p.y_coord);
+            return l_Grid && l_Grid->GetGridState() == GRID_STATE_ACTIVE;
+        }
+
         bool IsGridLoaded(float x, float y) const
         {
             return IsGridLoaded(JadeCore::ComputeGridCoord(x, y));
@@ -303,6 +381,22 @@ class Map : public GridRefManager<NGridType>
         bool UnloadGrid(NGridType& ngrid, bool pForce);
         virtual void UnloadAll();
 
+        /// Deferred grid loading, see GridLoadJob
+        void UpdateGridLoadQueue();
+        bool HasGridUnloadBudget();
+        GridLoadStats const& GetGridLoadStats() const { return m_GridLoadStats; }
+
+        /// Pools of the creatures, gameobjects, spells... allocated by this instance, see ObjectPoolMgr
+        ObjectPoolSet* GetObjectPools() const { return m_ObjectPools; }
+
+        /// Visits the loaded grids, from the map thread only
+        void BuildInstanceMemoryReport(InstanceMemoryReport& p_Report) const;
+
+        /// Visibility of moving units is updated once per map update in a single pass
+        void ScheduleVisibilityUpdate(Unit* p_Unit);
+        void CancelVisibilityUpdate(Unit* p_Unit);
+        VisibilityStats const& GetVisibilityStats() const { return m_VisibilityStats; }
+
         void ResetGridExpiry(NGridType &grid, float factor = 1) const
         {
             grid.ResetTimeTracker(time_t(float(i_gridExpiry)*factor));
@@ -343,6 +437,8 @@ class Map : public GridRefManager<NGridType>
 
         static uint32 GetAreaIdByAreaFlag(uint16 areaflag, uint32 map_id);
         static uint32 GetZoneIdByAreaFlag(uint16 areaflag, uint32 map_id);
+        /// Zones of the terrain of a grid, read at the center of each of its cells
+        void GetGridZones(uint32 p_GridX, uint32 p_GridY, std::vector<uint32>& p_Zones);
         static void GetZoneAndAreaIdByAreaFlag(uint32& zoneid, uint32& areaid, uint16 areaflag, uint32 map_id);
         virtual void SetObjectVisibility(float p_Visibility);
 
@@ -418,9 +514,10 @@ class Map : public GridRefManager<NGridType>
         void UpdateObjectVisibility(WorldObject* obj, Cell cell, CellCoord cellpair);
         void UpdateObjectsVisibilityFor(Player* player, Cell cell, CellCoord cellpair);
 
-        void resetMarkedCells() { marked_cells.reset(); }
-        bool isCellMarked(uint32 pCellId) { return marked_cells.test(pCellId); }
-        void markCell(uint32 pCellId) { marked_cells.set(pCellId); }
+        /// Marked cells are per thread, see Map.cpp
+        void resetMarkedCells();
+        bool isCellMarked(uint32 pCellId);
+        void markCell(uint32 pCellId);
 
         bool HavePlayers() const { return !m_mapRefManager.isEmpty(); }
         uint32 GetPlayersCountExceptGMs() const;
@@ -436,6 +533,9 @@ class Map : public GridRefManager<NGridType>
 
         void SendToPlayers(WorldPacket const* data) const;
 
+        /// Pet battle to simulate with the next update of the map, called by the world thread between two map updates
+        void AddPetBattle(uint64 p_BattleID, uint32 p_Token) { m_PetBattles.push_back(std::make_pair(p_BattleID, p_Token)); }
+
         typedef MapRefManager PlayerList;
         PlayerList const& GetPlayers() const { return m_mapRefManager; }
 
@@ -556,9 +656,18 @@ class Map : public GridRefManager<NGridType>
 
         bool IsGridLoaded(const GridCoord &) const;
         void EnsureGridCreated(const GridCoord &);
-        bool EnsureGridLoaded(Cell const&);
+        bool EnsureGridLoaded(Cell const&, bool p_Deferred = false);
         void EnsureGridLoadedForActiveObject(Cell const&, WorldObject* object);
 
+        bool CanDeferGridLoading() const;
+        void QueueGridLoad(NGridType& p_Grid, Cell const& p_Cell);
+        bool CommitGridLoadJob(GridLoadJob& p_Job, uint32& p_Committed, uint32 p_MaxObjects, uint32 p_StartTime, uint32 p_TimeBudget);
+        template<class T, class D> void CommitGridLoadObject(T* p_Object, uint32 p_Guid, D const* p_Data, Cell const& p_Cell);
+        void WaitGridLoadJob(GridLoadJob& p_Job);
+        void FlushGridLoadJob(NGridType const& p_Grid);
+        void CancelGridLoadJob(NGridType const& p_Grid);
+        std::shared_ptr<GridLoadJob> TakeGridLoadJob(NGridType const& p_Grid);
+
         void buildNGridLinkage(NGridType* pNGridType) { pNGridType->link(this); }
 
         NGridType* getNGrid(uint32 x, uint32 y) const;
@@ -627,14 +736,14 @@ class Map : public GridRefManager<NGridType>
         //InstanceMaps and BattlegroundMaps...
         Map* m_parentMap;
 
-        NGridType* i_grids[MAX_NUMBER_OF_GRIDS][MAX_NUMBER_OF_GRIDS];
-        GridMap* GridMaps[MAX_NUMBER_OF_GRIDS][MAX_NUMBER_OF_GRIDS];
-        std::bitset<TOTAL_NUMBER_OF_CELLS_PER_MAP*TOTAL_NUMBER_OF_CELLS_PER_MAP> marked_cells;
+        LazyGridTable<NGridType> i_grids;
+        LazyGridTable<GridMap> GridMaps;
 
         bool i_scriptLock;
         std::set<WorldObject*> i_objectsToRemove;
         std::map<WorldObject*, bool> i_objectsToSwitch;
         std::set<WorldObject*> i_worldObjects;
+        std::vector<std::pair<uint64, uint32>> m_PetBattles;    ///< Battle ID, handoff token
 
         typedef std::multimap<time_t, ScriptAction> ScriptScheduleMap;
         ScriptScheduleMap m_scriptSchedule;
@@ -671,6 +780,20 @@ class Map : public GridRefManager<NGridType>
 
         std::unordered_map<uint32 /*dbGUID*/, time_t> _creatureRespawnTimes;
         std::unordered_map<uint32 /*dbGUID*/, time_t> _goRespawnTimes;
+
+        std::list<std::shared_ptr<GridLoadJob>> m_GridLoadQueue;
+        std::list<std::shared_ptr<GridLoadJob>> m_GridLoadBatch;   ///< Taken from the queue by UpdateGridLoadQueue, not committed yet
+        GridLoadStats m_GridLoadStats;
+        uint32 m_GridUnloadsThisUpdate;
+        ObjectPoolSet* m_ObjectPools;
+
+        PlayerSpatialHash m_PlayerSpatialHash;
+
+        void ProcessVisibilityUpdates(uint32 p_Diff);
+
+        std::vector<Unit*> m_VisibilityMovers;
+        uint32 m_VisibilityTimer;
+        VisibilityStats m_VisibilityStats;
 };
 
 enum InstanceResetMethod
@@ -24,6 +24,7 @@
 #include "WorldPacket.h"
 #include "Group.h"
 #include "Common.h"
+#include "ObjectPool.h"
 
 extern GridState* si_GridStates[];                          // debugging code, should be deleted some day
 
@@ -267,22 +268,6 @@ void MapManager::Update(uint32 diff)
 
     m_MapsDelay.clear();
 
-    /// - Start Achievement criteria update processing thread
-    sAchievementMgr->PrepareCriteriaUpdateTaskThread();
-
-    for (auto l_PlayerTask : sAchievementMgr->GetPlayersCriteriaTask())
-    {
-        if (m_updater.activated())
-            m_updater.schedule_specific(new AchievementCriteriaUpdateRequest(&m_updater, l_PlayerTask.second));
-        else
-        {
-            /// Process all task in synchrone way
-            auto l_Task = new AchievementCriteriaUpdateRequest(nullptr, l_PlayerTask.second);
-            l_Task->call();
-            delete l_Task;
-        }
-    }
-
     /// - Start map updater threads
     MapMapType::iterator iter = i_maps.begin();
     for (; iter != i_maps.end(); ++iter)
@@ -296,8 +281,6 @@ void MapManager::Update(uint32 diff)
     if (m_updater.activated())
         m_updater.wait();
 
-    sAchievementMgr->ClearPlayersCriteriaTask();
-
     for (iter = i_maps.begin(); iter != i_maps.end(); ++iter)
         iter->second->DelayedUpdate(uint32(i_timer.GetCurrent()));
 
@@ -336,6 +319,9 @@ void MapManager::Update(uint32 diff)
         m_CriticalOperationLock.release();
     }
 
+    /// - No map is updated anymore, objects freed during this tick can be reused
+    ObjectPoolMgr::Reclaim();
+
     i_timer.SetCurrent(0);
 }
 
@@ -0,0 +1,334 @@
+////////////////////////////////////////////////////////////////////////////////
+//
+//  MILLENIUM-STUDIO
+//  Copyright 2016 Millenium-studio SARL
+//  All Rights Reserved.
+//
+////////////////////////////////////////////////////////////////////////////////
+
+#include "ObjectPool.h"
+#include "Common.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <new>
+
+bool ObjectPoolMgr::s_Enabled = true;
+uint32 ObjectPoolMgr::s_MaxFreeBlocks = 512;
+uint64 ObjectPoolMgr::s_MaxFreeBytes = 64 * 1024 * 1024;
+
+namespace
+{
+    /// The global pools are never destroyed: objects can still be released by static destructors at shutdown
+    std::mutex* s_PoolsLock = new std::mutex();
+    std::vector<ObjectPoolSet*>* s_Pools = new std::vector<ObjectPoolSet*>();
+    ObjectPoolSet* s_GlobalPools = ObjectPoolMgr::CreatePools(ObjectPoolMgr::GlobalPoolId);
+
+    thread_local ObjectPoolSet* t_CurrentPools = nullptr;
+
+    ObjectPoolBlock* AllocateBlock(size_t p_Size)
+    {
+        void* l_Memory = malloc(sizeof(ObjectPoolBlock) + p_Size);
+        if (!l_Memory)
+            throw std::bad_alloc();
+
+        return static_cast<ObjectPoolBlock*>(l_Memory);
+    }
+}
+
+ObjectPool::SizeClass& ObjectPool::GetSizeClass(size_t p_Size)
+{
+    /// Only a few concrete classes share a pool, a linear search is enough
+    for (SizeClass& l_SizeClass : m_SizeClasses)
+    {
+        if (l_SizeClass.Size == p_Size)
+            return l_SizeClass;
+    }
+
+    m_SizeClasses.push_back(SizeClass());
+    m_SizeClasses.back().Size = p_Size;
+    return m_SizeClasses.back();
+}
+
+void* ObjectPool::Allocate(size_t p_Size)
+{
+    ObjectPoolBlock* l_Block = nullptr;
+
+    {
+        std::lock_guard<std::mutex> l_Guard(m_Lock);
+
+        SizeClass& l_SizeClass = GetSizeClass(p_Size);
+        if (!l_SizeClass.Free.empty())
+        {
+            l_Block = l_SizeClass.Free.back();
+            l_SizeClass.Free.pop_back();
+
+            --m_Stats.Free;
+            m_Stats.FreeBytes -= p_Size;
+            ++m_Stats.Reused;
+        }
+
+        ++m_Stats.Allocations;
+        ++m_Stats.Live;
+        m_Stats.LiveBytes += p_Size;
+    }
+
+    if (!l_Block)
+        l_Block = AllocateBlock(p_Size);
+
+    l_Block->Pool = this;
+    l_Block->Size = p_Size;
+    return l_Block + 1;
+}
+
+void ObjectPool::Deallocate(ObjectPoolBlock* p_Block)
+{
+    std::lock_guard<std::mutex> l_Guard(m_Lock);
+
+    GetSizeClass(p_Block->Size).Pending.push_back(p_Block);
+
+    ++m_Stats.Deallocations;
+    ++m_Stats.Pending;
+    --m_Stats.Live;
+    m_Stats.LiveBytes -= p_Block->Size;
+}
+
+void ObjectPool::Reclaim(uint32 p_MaxFreeBlocks)
+{
+    std::vector<ObjectPoolBlock*> l_Released;
+
+    {
+        std::lock_guard<std::mutex> l_Guard(m_Lock);
+
+        for (SizeClass& l_SizeClass : m_SizeClasses)
+        {
+            for (ObjectPoolBlock* l_Block : l_SizeClass.Pending)
+            {
+                if (l_SizeClass.Free.size() < p_MaxFreeBlocks)
+                {
+                    l_SizeClass.Free.push_back(l_Block);
+                    ++m_Stats.Free;
+                    m_Stats.FreeBytes += l_SizeClass.Size;
+                }
+                else
+                    l_Released.push_back(l_Block);
+            }
+
+            m_Stats.Pending -= l_SizeClass.Pending.size();
+            l_SizeClass.Pending.clear();
+
+            /// Limit lowered at runtime
+            while (l_SizeClass.Free.size() > p_MaxFreeBlocks)
+            {
+                l_Released.push_back(l_SizeClass.Free.back());
+                l_SizeClass.Free.pop_back();
+                --m_Stats.Free;
+                m_Stats.FreeBytes -= l_SizeClass.Size;
+            }
+        }
+    }
+
+    for (ObjectPoolBlock* l_Block : l_Released)
+        free(l_Block);
+}
+
+void ObjectPool::Trim(uint64 p_MaxFreeBytes)
+{
+    std::vector<ObjectPoolBlock*> l_Released;
+
+    {
+        std::lock_guard<std::mutex> l_Guard(m_Lock);
+
+        /// One block of each size in turn, the sizes keep the same share of the pool
+        bool l_Trimmed = true;
+        while (m_Stats.FreeBytes > p_MaxFreeBytes && l_Trimmed)
+        {
+            l_Trimmed = false;
+
+            for (SizeClass& l_SizeClass : m_SizeClasses)
+            {
+                if (l_SizeClass.Free.empty() || m_Stats.FreeBytes <= p_MaxFreeBytes)
+                    continue;
+
+                l_Released.push_back(l_SizeClass.Free.back());
+                l_SizeClass.Free.pop_back();
+                --m_Stats.Free;
+                m_Stats.FreeBytes -= l_SizeClass.Size;
+                l_Trimmed = true;
+            }
+        }
+    }
+
+    for (ObjectPoolBlock* l_Block : l_Released)
+        free(l_Block);
+}
+
+ObjectPoolStats ObjectPool::GetStats() const
+{
+    std::lock_guard<std::mutex> l_Guard(m_Lock);
+    return m_Stats;
+}
+
+ObjectPoolSet* ObjectPoolMgr::CreatePools(uint32 p_MapId)
+{
+    ObjectPoolSet* l_Pools = new ObjectPoolSet(p_MapId);
+
+    std::lock_guard<std::mutex> l_Guard(*s_PoolsLock);
+    s_Pools->push_back(l_Pools);
+    return l_Pools;
+}
+
+void ObjectPoolMgr::ReleasePools(ObjectPoolSet* p_Pools)
+{
+    /// Objects of the map can outlive it (pets following their owner), the set stays until they are freed
+    std::lock_guard<std::mutex> l_Guard(*s_PoolsLock);
+    p_Pools->Released = true;
+}
+
+ObjectPoolSet* ObjectPoolMgr::SetCurrentPools(ObjectPoolSet* p_Pools)
+{
+    ObjectPoolSet* l_PreviousPools = t_CurrentPools;
+    t_CurrentPools = p_Pools;
+    return l_PreviousPools;
+}
+
+void* ObjectPoolMgr::Allocate(ObjectPoolType p_Type, size_t p_Size)
+{
+    /// Keep the object aligned like a malloc result
+    p_Size = (p_Size + 15) & ~size_t(15);
+
+    if (!s_Enabled)
+    {
+        ObjectPoolBlock* l_Block = AllocateBlock(p_Size);
+        l_Block->Pool = nullptr;
+        l_Block->Size = p_Size;
+        return l_Block + 1;
+    }
+
+    ObjectPoolSet* l_Pools = t_CurrentPools ? t_CurrentPools : s_GlobalPools;
+    return l_Pools->Pools[p_Type].Allocate(p_Size);
+}
+
+void ObjectPoolMgr::Deallocate(void* p_Ptr)
+{
+    if (!p_Ptr)
+        return;
+
+    ObjectPoolBlock* l_Block = static_cast<ObjectPoolBlock*>(p_Ptr) - 1;
+
+    /// Allocated while pooling was disabled
+    if (!l_Block->Pool)
+    {
+        free(l_Block);
+        return;
+    }
+
+    l_Block->Pool->Deallocate(l_Block);
+}
+
+void ObjectPoolMgr::Reclaim()
+{
+    std::vector<ObjectPoolSet*> l_Pools;
+    std::vector<ObjectPoolSet*> l_Released;
+
+    {
+        std::lock_guard<std::mutex> l_Guard(*s_PoolsLock);
+        l_Pools = *s_Pools;
+    }
+
+    /// A disabled pooling still drains the free lists
+    uint32 l_MaxFreeBlocks = s_Enabled ? s_MaxFreeBlocks : 0;
+
+    uint64 l_FreeBytes = 0;
+    for (ObjectPoolSet* l_MapPools : l_Pools)
+    {
+        bool l_Empty = true;
+        for (uint8 l_Type = 0; l_Type < MAX_OBJECT_POOL_TYPE; ++l_Type)
+        {
+            ObjectPool& l_Pool = l_MapPools->Pools[l_Type];
+            l_Pool.Reclaim(l_MaxFreeBlocks);
+
+            ObjectPoolStats l_Stats = l_Pool.GetStats();
+            l_FreeBytes += l_Stats.FreeBytes;
+            l_Empty     &= !l_Stats.Live;
+        }
+
+        /// No map thread allocates from a released set anymore, without live objects nobody references it
+        if (l_Empty && l_MapPools->Released)
+            l_Released.push_back(l_MapPools);
+    }
+
+    if (!l_Released.empty())
+    {
+        {
+            std::lock_guard<std::mutex> l_Guard(*s_PoolsLock);
+            for (ObjectPoolSet* l_MapPools : l_Released)
+                s_Pools->erase(std::find(s_Pools->begin(), s_Pools->end(), l_MapPools));
+        }
+
+        for (ObjectPoolSet* l_MapPools : l_Released)
+        {
+            for (uint8 l_Type = 0; l_Type < MAX_OBJECT_POOL_TYPE; ++l_Type)
+            {
+                l_FreeBytes -= l_MapPools->Pools[l_Type].GetStats().FreeBytes;
+                l_MapPools->Pools[l_Type].Trim(0);
+            }
+
+            l_Pools.erase(std::find(l_Pools.begin(), l_Pools.end(), l_MapPools));
+            delete l_MapPools;
+        }
+    }
+
+    if (l_FreeBytes <= s_MaxFreeBytes)
+        return;
+
+    /// Pools without live objects first (maps unloaded), they are not going to reuse their blocks soon
+    for (ObjectPoolSet* l_MapPools : l_Pools)
+    {
+        for (uint8 l_Type = 0; l_Type < MAX_OBJECT_POOL_TYPE && l_FreeBytes > s_MaxFreeBytes; ++l_Type)
+        {
+            ObjectPoolStats l_Stats = l_MapPools->Pools[l_Type].GetStats();
+            if (l_Stats.Live || !l_Stats.FreeBytes)
+                continue;
+
+            l_MapPools->Pools[l_Type].Trim(0);
+            l_FreeBytes -= l_Stats.FreeBytes;
+        }
+    }
+
+    if (l_FreeBytes <= s_MaxFreeBytes)
+        return;
+
+    /// Then every pool keeps the same share of its free blocks
+    double l_Share = double(s_MaxFreeBytes) / double(l_FreeBytes);
+    for (ObjectPoolSet* l_MapPools : l_Pools)
+    {
+        for (uint8 l_Type = 0; l_Type < MAX_OBJECT_POOL_TYPE; ++l_Type)
+            l_MapPools->Pools[l_Type].Trim(uint64(l_MapPools->Pools[l_Type].GetStats().FreeBytes * l_Share));
+    }
+}
+
+void ObjectPoolMgr::VisitStats(std::function<void(uint32, ObjectPoolType, ObjectPoolStats const&)> const& p_Visitor)
+{
+    /// Under the lock, Reclaim could delete a released set in the meantime
+    std::lock_guard<std::mutex> l_Guard(*s_PoolsLock);
+
+    for (ObjectPoolSet* l_MapPools : *s_Pools)
+    {
+        for (uint8 l_Type = 0; l_Type < MAX_OBJECT_POOL_TYPE; ++l_Type)
+            p_Visitor(l_MapPools->MapId, ObjectPoolType(l_Type), l_MapPools->Pools[l_Type].GetStats());
+    }
+}
+
+char const* ObjectPoolMgr::GetTypeName(ObjectPoolType p_Type)
+{
+    switch (p_Type)
+    {
+        case OBJECT_POOL_CREATURE:      return "Creature";
+        case OBJECT_POOL_GAMEOBJECT:    return "GameObject";
+        case OBJECT_POOL_SPELL:         return "Spell";
+        case OBJECT_POOL_AREATRIGGER:   return "AreaTrigger";
+        case OBJECT_POOL_DYNAMICOBJECT: return "DynamicObject";
+        default:                        return "Unknown";
+    }
+}
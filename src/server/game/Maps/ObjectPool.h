@@ -0,0 +1,157 @@
+////////////////////////////////////////////////////////////////////////////////
+//
+//  MILLENIUM-STUDIO
+//  Copyright 2016 Millenium-studio SARL
+//  All Rights Reserved.
+//
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef TRINITY_OBJECTPOOL_H
+#define TRINITY_OBJECTPOOL_H
+
+#include "Define.h"
+
+#include <mutex>
+#include <vector>
+#include <functional>
+
+/// Entity families with their own pools, subclasses (TempSummon, Pet, Transport...) share the pool of their base class
+enum ObjectPoolType
+{
+    OBJECT_POOL_CREATURE,
+    OBJECT_POOL_GAMEOBJECT,
+    OBJECT_POOL_SPELL,
+    OBJECT_POOL_AREATRIGGER,
+    OBJECT_POOL_DYNAMICOBJECT,
+    MAX_OBJECT_POOL_TYPE
+};
+
+struct ObjectPoolStats
+{
+    ObjectPoolStats()
+        : Allocations(0), Reused(0), Deallocations(0), Live(0), LiveBytes(0), Pending(0), Free(0), FreeBytes(0)
+    {
+    }
+
+    void Add(ObjectPoolStats const& p_Other)
+    {
+        Allocations   += p_Other.Allocations;
+        Reused        += p_Other.Reused;
+        Deallocations += p_Other.Deallocations;
+        Live          += p_Other.Live;
+        LiveBytes     += p_Other.LiveBytes;
+        Pending       += p_Other.Pending;
+        Free          += p_Other.Free;
+        FreeBytes     += p_Other.FreeBytes;
+    }
+
+    uint64 Allocations;
+    uint64 Reused;          ///< Allocations served from the free lists
+    uint64 Deallocations;
+    uint32 Live;
+    uint64 LiveBytes;
+    uint32 Pending;         ///< Freed blocks waiting for the next ObjectPoolMgr::Reclaim
+    uint32 Free;
+    uint64 FreeBytes;
+};
+
+/// Header in front of every pooled object, keeps the object 16 bytes aligned
+struct ObjectPoolBlock
+{
+    class ObjectPool* Pool;
+    uint64 Size;
+};
+
+/// Free lists of one entity family for one map instance, one list per object size
+class ObjectPool
+{
+    public:
+        void* Allocate(size_t p_Size);
+        void Deallocate(ObjectPoolBlock* p_Block);
+
+        /// Make blocks freed since the last call reusable, release what exceeds p_MaxFreeBlocks per size
+        void Reclaim(uint32 p_MaxFreeBlocks);
+        /// Release free blocks until at most p_MaxFreeBytes are kept
+        void Trim(uint64 p_MaxFreeBytes);
+
+        ObjectPoolStats GetStats() const;
+
+    private:
+        struct SizeClass
+        {
+            size_t Size;
+            std::vector<ObjectPoolBlock*> Free;
+            std::vector<ObjectPoolBlock*> Pending;
+        };
+
+        SizeClass& GetSizeClass(size_t p_Size);
+
+        mutable std::mutex m_Lock;
+        std::vector<SizeClass> m_SizeClasses;
+        ObjectPoolStats m_Stats;
+};
+
+/// Pools of every entity family for one map instance, owned by ObjectPoolMgr
+struct ObjectPoolSet
+{
+    ObjectPoolSet(uint32 p_MapId) : MapId(p_MapId), Released(false) { }
+
+    uint32 MapId;
+    bool Released;          ///< The map is gone, deleted by Reclaim once its last object is freed
+    ObjectPool Pools[MAX_OBJECT_POOL_TYPE];
+};
+
+/// Per map instance typed pools for entities with a high allocation churn.
+///
+/// Objects allocated while a map is updated go to the pools of that map instance, other allocations
+/// (world thread, scripts loading) go to the global pools. Instances of the same map don't share
+/// any lock. Freed blocks are only reused after the next Reclaim, done by MapManager once every
+/// map update of the tick has returned, so dangling pointers kept during a tick never see a new
+/// object of the same type.
+class ObjectPoolMgr
+{
+    public:
+        static uint32 const GlobalPoolId = 0xFFFFFFFF;
+
+        static void* Allocate(ObjectPoolType p_Type, size_t p_Size);
+        static void Deallocate(void* p_Ptr);
+
+        /// Pools of a new map instance, handed back with ReleasePools when the map is destroyed
+        static ObjectPoolSet* CreatePools(uint32 p_MapId);
+        static void ReleasePools(ObjectPoolSet* p_Pools);
+
+        /// Route allocations of the calling thread to p_Pools (nullptr for the global pools), returns the previous pools
+        static ObjectPoolSet* SetCurrentPools(ObjectPoolSet* p_Pools);
+
+        /// Safe point, must be called while no map is updated
+        static void Reclaim();
+
+        static void SetEnabled(bool p_Enabled) { s_Enabled = p_Enabled; }
+        static void SetMaxFreeBlocks(uint32 p_MaxFreeBlocks) { s_MaxFreeBlocks = p_MaxFreeBlocks; }
+        static void SetMaxFreeBytes(uint64 p_MaxFreeBytes) { s_MaxFreeBytes = p_MaxFreeBytes; }
+
+        static void VisitStats(std::function<void(uint32, ObjectPoolType, ObjectPoolStats const&)> const& p_Visitor);
+        static char const* GetTypeName(ObjectPoolType p_Type);
+
+    private:
+        static bool s_Enabled;
+        static uint32 s_MaxFreeBlocks;
+        static uint64 s_MaxFreeBytes;       ///< Over all the pools, MaxFreeBlocks alone grows with the number of maps
+};
+
+/// Allocations of the current thread go to the pools of a map instance for the scope lifetime
+class ObjectPoolMapScope
+{
+    public:
+        explicit ObjectPoolMapScope(ObjectPoolSet* p_Pools) : m_PreviousPools(ObjectPoolMgr::SetCurrentPools(p_Pools)) { }
+        ~ObjectPoolMapScope() { ObjectPoolMgr::SetCurrentPools(m_PreviousPools); }
+
+    private:
+        ObjectPoolSet* m_PreviousPools;
+};
+
+#define OBJECT_POOL_ALLOCATED(p_Type)                                                          \
+    static void* operator new(size_t p_Size) { return ObjectPoolMgr::Allocate(p_Type, p_Size); } \
+    static void operator delete(void* p_Ptr) { ObjectPoolMgr::Deallocate(p_Ptr); }
+
+#endif
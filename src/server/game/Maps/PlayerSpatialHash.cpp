@@ -0,0 +1,96 @@
+////////////////////////////////////////////////////////////////////////////////
+//
+//  MILLENIUM-STUDIO
+//  Copyright 2016 Millenium-studio SARL
+//  All Rights Reserved.
+//
+////////////////////////////////////////////////////////////////////////////////
+
+#include "PlayerSpatialHash.h"
+
+void PlayerSpatialHash::AddToBucket(Player* p_Player, uint64 p_Key, float p_X, float p_Y)
+{
+    Bucket& l_Bucket = m_Buckets[p_Key];
+
+    Location& l_Location = m_Locations[p_Player];
+    l_Location.Key   = p_Key;
+    l_Location.Index = uint32(l_Bucket.Players.size());
+
+    l_Bucket.Players.push_back(p_Player);
+    l_Bucket.X.push_back(p_X);
+    l_Bucket.Y.push_back(p_Y);
+}
+
+void PlayerSpatialHash::RemoveFromBucket(Location const& p_Location)
+{
+    auto l_Itr = m_Buckets.find(p_Location.Key);
+    if (l_Itr == m_Buckets.end())
+        return;
+
+    Bucket& l_Bucket = l_Itr->second;
+    uint32 l_Last = uint32(l_Bucket.Players.size() - 1);
+
+    /// Swap with the last entry to keep the arrays packed
+    if (p_Location.Index != l_Last)
+    {
+        l_Bucket.Players[p_Location.Index] = l_Bucket.Players[l_Last];
+        l_Bucket.X[p_Location.Index]       = l_Bucket.X[l_Last];
+        l_Bucket.Y[p_Location.Index]       = l_Bucket.Y[l_Last];
+
+        m_Locations[l_Bucket.Players[p_Location.Index]].Index = p_Location.Index;
+    }
+
+    l_Bucket.Players.pop_back();
+    l_Bucket.X.pop_back();
+    l_Bucket.Y.pop_back();
+
+    if (l_Bucket.Players.empty())
+        m_Buckets.erase(l_Itr);
+}
+
+void PlayerSpatialHash::Insert(Player* p_Player, float p_X, float p_Y)
+{
+    if (m_Locations.find(p_Player) != m_Locations.end())
+    {
+        Relocate(p_Player, p_X, p_Y);
+        return;
+    }
+
+    AddToBucket(p_Player, MakeKey(p_X, p_Y), p_X, p_Y);
+}
+
+void PlayerSpatialHash::Relocate(Player* p_Player, float p_X, float p_Y)
+{
+    auto l_Itr = m_Locations.find(p_Player);
+    if (l_Itr == m_Locations.end())
+    {
+        AddToBucket(p_Player, MakeKey(p_X, p_Y), p_X, p_Y);
+        return;
+    }
+
+    uint64 l_Key = MakeKey(p_X, p_Y);
+    Location l_Location = l_Itr->second;
+
+    if (l_Location.Key == l_Key)
+    {
+        Bucket& l_Bucket = m_Buckets[l_Key];
+        l_Bucket.X[l_Location.Index] = p_X;
+        l_Bucket.Y[l_Location.Index] = p_Y;
+        return;
+    }
+
+    RemoveFromBucket(l_Location);
+    AddToBucket(p_Player, l_Key, p_X, p_Y);
+}
+
+void PlayerSpatialHash::Remove(Player* p_Player)
+{
+    auto l_Itr = m_Locations.find(p_Player);
+    if (l_Itr == m_Locations.end())
+        return;
+
+    Location l_Location = l_Itr->second;
+    m_Locations.erase(l_Itr);
+
+    RemoveFromBucket(l_Location);
+}
@@ -0,0 +1,107 @@
+////////////////////////////////////////////////////////////////////////////////
+//
+//  MILLENIUM-STUDIO
+//  Copyright 2016 Millenium-studio SARL
+//  All Rights Reserved.
+//
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef TRINITY_PLAYERSPATIALHASH_H
+#define TRINITY_PLAYERSPATIALHASH_H
+
+#include "Define.h"
+
+#include <vector>
+#include <unordered_map>
+#include <cmath>
+
+class Player;
+
+/// Size (in yards) of a bucket side
+#define PLAYER_SPATIAL_HASH_BUCKET_SIZE 32.0f
+/// Added to query ranges so players whose bounding radius reaches the range are returned
+#define PLAYER_SPATIAL_HASH_MARGIN      10.0f
+
+/// Players of a map bucketed by position, independent of the cell grid.
+///
+/// Each bucket keeps players and their positions in separate arrays so a range query only
+/// reads floats until a candidate is found. Buckets are updated by Map::AddPlayerToMap,
+/// Map::PlayerRelocation and Map::RemovePlayerFromMap, the hash is only used by the map thread.
+class PlayerSpatialHash
+{
+    public:
+        void Insert(Player* p_Player, float p_X, float p_Y);
+        void Relocate(Player* p_Player, float p_X, float p_Y);
+        void Remove(Player* p_Player);
+
+        uint32 GetSize() const { return uint32(m_Locations.size()); }
+        uint32 GetBucketCount() const { return uint32(m_Buckets.size()); }
+
+        /// Call p_Worker(Player*) for every player in the square [x - range, x + range] x [y - range, y + range],
+        /// the exact (3D, phase, alive...) check is up to the worker
+        template<class Worker> void Visit(float p_X, float p_Y, float p_Range, Worker& p_Worker) const
+        {
+            float l_Range = p_Range + PLAYER_SPATIAL_HASH_MARGIN;
+
+            int32 l_MinX = GetBucketCoord(p_X - l_Range);
+            int32 l_MaxX = GetBucketCoord(p_X + l_Range);
+            int32 l_MinY = GetBucketCoord(p_Y - l_Range);
+            int32 l_MaxY = GetBucketCoord(p_Y + l_Range);
+
+            /// Huge ranges, walk the populated buckets instead of the empty ones
+            if (uint64(l_MaxX - l_MinX + 1) * uint64(l_MaxY - l_MinY + 1) > m_Buckets.size())
+            {
+                for (auto const& l_Itr : m_Buckets)
+                    VisitBucket(l_Itr.second, p_X, p_Y, l_Range, p_Worker);
+                return;
+            }
+
+            for (int32 l_BucketX = l_MinX; l_BucketX <= l_MaxX; ++l_BucketX)
+            {
+                for (int32 l_BucketY = l_MinY; l_BucketY <= l_MaxY; ++l_BucketY)
+                {
+                    auto l_Itr = m_Buckets.find(MakeKey(l_BucketX, l_BucketY));
+                    if (l_Itr != m_Buckets.end())
+                        VisitBucket(l_Itr->second, p_X, p_Y, l_Range, p_Worker);
+                }
+            }
+        }
+
+    private:
+        struct Bucket
+        {
+            std::vector<Player*> Players;
+            std::vector<float> X;
+            std::vector<float> Y;
+        };
+
+        struct Location
+        {
+            uint64 Key;
+            uint32 Index;
+        };
+
+        static int32 GetBucketCoord(float p_Coord) { return int32(std::floor(p_Coord / PLAYER_SPATIAL_HASH_BUCKET_SIZE)); }
+        static uint64 MakeKey(int32 p_X, int32 p_Y) { return (uint64(uint32(p_X)) << 32) | uint32(p_Y); }
+        static uint64 MakeKey(float p_X, float p_Y) { return MakeKey(GetBucketCoord(p_X), GetBucketCoord(p_Y)); }
+
+        template<class Worker> static void VisitBucket(Bucket const& p_Bucket, float p_X, float p_Y, float p_Range, Worker& p_Worker)
+        {
+            size_t l_Count = p_Bucket.Players.size();
+            for (size_t l_I = 0; l_I < l_Count; ++l_I)
+            {
+                if (std::fabs(p_Bucket.X[l_I] - p_X) > p_Range || std::fabs(p_Bucket.Y[l_I] - p_Y) > p_Range)
+                    continue;
+
+                p_Worker(p_Bucket.Players[l_I]);
+            }
+        }
+
+        void AddToBucket(Player* p_Player, uint64 p_Key, float p_X, float p_Y);
+        void RemoveFromBucket(Location const& p_Location);
+
+        std::unordered_map<uint64, Bucket> m_Buckets;
+        std::unordered_map<Player const*, Location> m_Locations;
+};
+
+#endif
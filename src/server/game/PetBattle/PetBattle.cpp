@@ -983,6 +983,10 @@ PetBattle::PetBattle()
     WinnerTeamId = -1;
     CatchedPetId = PETBATTLE_NULL_ID;
 
+    MapUpdatePending     = false;
+    MapUpdateRequestTime = 0;
+    MapUpdateToken       = 0;
+
     m_UpdateTimer.SetInterval(PETBATTLE_UPDATE_INTERVAL);
 }
 /// Destructor
@@ -1515,6 +1519,30 @@ void PetBattle::Finish(uint32 p_WinnerTeamID, bool p_Aborted)
 
 //////////////////////////////////////////////////////////////////////////
 
+/// Map of the players of the battle still in world, if they are all on the same one
+/// A battle with players on two maps would be touched by two map threads, it stays on the world thread
+Map* PetBattle::GetUpdateMap() const
+{
+    Map* l_UpdateMap = nullptr;
+
+    for (size_t l_CurrentTeamID = 0; l_CurrentTeamID < MAX_PETBATTLE_TEAM; ++l_CurrentTeamID)
+    {
+        if (!Teams[l_CurrentTeamID]->PlayerGuid)
+            continue;
+
+        Player* l_Player = HashMapHolder<Player>::Find(Teams[l_CurrentTeamID]->PlayerGuid);
+        if (!l_Player || !l_Player->IsInWorld())
+            continue;
+
+        if (l_UpdateMap && l_UpdateMap != l_Player->GetMap())
+            return nullptr;
+
+        l_UpdateMap = l_Player->GetMap();
+    }
+
+    return l_UpdateMap;
+}
+
 /// Update the pet battle
 void PetBattle::Update(uint32 p_TimeDiff)
 {
@@ -1920,6 +1948,8 @@ int32 PetBattle::GetForfeitHealthPenalityPct()
 PetBattleSystem::PetBattleSystem()
 {
     m_MaxPetBattleID = 1;
+    MapBattleUpdates = 0;
+    WorldBattleUpdates = 0;
     m_DeleteUpdateTimer.SetInterval(PETBATTLE_DELETE_INTERVAL);
     m_LFBAvgWaitTime = 0;
     m_LFBNumWaitTimeAvg = 0;
@@ -1929,8 +1959,8 @@ PetBattleSystem::PetBattleSystem()
 PetBattleSystem::~PetBattleSystem()
 {
     /// Clean all battles
-    for (std::map<uint64, PetBattle*>::iterator l_Iterator = m_PetBattles.begin(); l_Iterator != m_PetBattles.end(); l_Iterator++)
-        delete l_Iterator->second;
+    for (PetBattle* l_Battle : m_PetBattles)
+        delete l_Battle;
 
     /// Clear all requests
     for (std::map<uint64, PetBattleRequest*>::iterator l_Iterator = m_Requests.begin(); l_Iterator != m_Requests.end(); l_Iterator++)
@@ -1940,14 +1970,34 @@ PetBattleSystem::~PetBattleSystem()
 //////////////////////////////////////////////////////////////////////////
 
 /// Create a new battle with an unique auto incremented ID
+/// The low PETBATTLE_SLOT_BITS of the ID are the slot of the battle, the high ones tell apart the battles reusing a slot
 PetBattle* PetBattleSystem::CreateBattle()
 {
-    uint64 l_BattleID = ++m_MaxPetBattleID;
+    PetBattle* l_Battle = new PetBattle();
+
+    std::lock_guard<std::mutex> l_Guard(m_PetBattlesMutex);
+
+    uint32 l_Slot;
+    if (!m_FreeBattleSlots.empty())
+    {
+        l_Slot = m_FreeBattleSlots.back();
+        m_FreeBattleSlots.pop_back();
+    }
+    else
+    {
+        l_Slot = uint32(m_PetBattles.size());
+        m_PetBattles.push_back(nullptr);
+    }
+
+    ASSERT(l_Slot < PETBATTLE_MAX_SLOTS);
 
-    m_PetBattles[l_BattleID] = new PetBattle();
-    m_PetBattles[l_BattleID]->ID = l_BattleID;
+    /// 64 bits IDs, the high part never wraps back on a battle still holding its slot
+    ++m_MaxPetBattleID;
 
-    return m_PetBattles[l_BattleID];
+    l_Battle->ID = (m_MaxPetBattleID << PETBATTLE_SLOT_BITS) | uint64(l_Slot);
+    m_PetBattles[l_Slot] = l_Battle;
+
+    return l_Battle;
 }
 /// Create a new pet battle request (actually we use requested guid (player guid) as request id)
 PetBattleRequest* PetBattleSystem::CreateRequest(uint64 p_RequesterGuid)
@@ -1963,12 +2013,18 @@ PetBattleRequest* PetBattleSystem::CreateRequest(uint64 p_RequesterGuid)
 /// Get a battle by his unique id
 PetBattle* PetBattleSystem::GetBattle(uint64 p_BattleID)
 {
-    std::map<uint64, PetBattle*>::iterator l_Iterator = m_PetBattles.find(p_BattleID);
+    uint32 l_Slot = uint32(p_BattleID) & (PETBATTLE_MAX_SLOTS - 1);
 
-    if (l_Iterator == m_PetBattles.end())
-        return 0;
+    std::lock_guard<std::mutex> l_Guard(m_PetBattlesMutex);
 
-    return l_Iterator->second;
+    if (l_Slot >= m_PetBattles.size())
+        return nullptr;
+
+    PetBattle* l_Battle = m_PetBattles[l_Slot];
+    if (!l_Battle || l_Battle->ID != p_BattleID)
+        return nullptr;
+
+    return l_Battle;
 }
 /// Get a request by his requested guid (player guid)
 PetBattleRequest* PetBattleSystem::GetRequest(uint64 p_RequesterGuid)
@@ -1986,15 +2042,27 @@ PetBattleRequest* PetBattleSystem::GetRequest(uint64 p_RequesterGuid)
 /// Remove an battle and delete it
 void PetBattleSystem::RemoveBattle(uint64 p_BattleID)
 {
-    PetBattle* l_Battle = GetBattle(p_BattleID);
+    uint32 l_Slot = uint32(p_BattleID) & (PETBATTLE_MAX_SLOTS - 1);
+    PetBattle* l_Battle = nullptr;
 
-    if (l_Battle)
     {
-        delete l_Battle;
+        std::lock_guard<std::mutex> l_Guard(m_PetBattlesMutex);
+
+        if (l_Slot >= m_PetBattles.size() || !m_PetBattles[l_Slot] || m_PetBattles[l_Slot]->ID != p_BattleID)
+            return;
 
-        m_PetBattles[p_BattleID] = 0;
-        m_PetBattles.erase(p_BattleID);
+        l_Battle = m_PetBattles[l_Slot];
+        m_PetBattles[l_Slot] = nullptr;
+        m_FreeBattleSlots.push_back(l_Slot);
     }
+
+    delete l_Battle;
+}
+
+uint32 PetBattleSystem::GetBattleCount() const
+{
+    std::lock_guard<std::mutex> l_Guard(m_PetBattlesMutex);
+    return uint32(m_PetBattles.size() - m_FreeBattleSlots.size());
 }
 /// Remove an request and delete it
 void PetBattleSystem::RemoveRequest(uint64 p_RequesterGuid)
@@ -2135,19 +2203,43 @@ void PetBattleSystem::Update(uint32 p_TimeDiff)
         }
     }
 
-    for (std::map<uint64, PetBattle*>::iterator l_Iterator = m_PetBattles.begin(); l_Iterator != m_PetBattles.end(); l_Iterator++)
+    /// Called between two map updates, no map thread creates or removes a battle meanwhile
+    for (PetBattle* l_Battle : m_PetBattles)
     {
-        PetBattle* l_Battle = l_Iterator->second;
-
         if (!l_Battle)
             continue;
 
         if (l_Battle->BattleStatus == PETBATTLE_STATUS_RUNNING)
+        {
+            /// Simulated by the thread updating the map of its players, player side effects of the rounds
+            /// (rewards, achievements, wild pet respawn...) stay on the thread owning the player.
+            /// A battle handed to a map which did not update it since (map unloaded) is handed again, with a new
+            /// token so a stale entry left on the previous map is skipped.
+            if (Map* l_Map = l_Battle->GetUpdateMap())
+            {
+                if (l_Battle->MapUpdatePending && GetMSTimeDiffToNow(l_Battle->MapUpdateRequestTime) < PETBATTLE_MAP_UPDATE_TIMEOUT)
+                    continue;
+
+                l_Battle->MapUpdatePending     = true;
+                l_Battle->MapUpdateRequestTime = getMSTime();
+                l_Map->AddPetBattle(l_Battle->ID, ++l_Battle->MapUpdateToken);
+                continue;
+            }
+
+            /// Players on two maps or none in world, invalidate any pending handoff
+            if (l_Battle->MapUpdatePending)
+            {
+                l_Battle->MapUpdatePending = false;
+                ++l_Battle->MapUpdateToken;
+            }
+
             l_Battle->Update(p_TimeDiff);
+            ++WorldBattleUpdates;
+        }
         else if (l_Battle->BattleStatus == PETBATTLE_STATUS_FINISHED)
         {
             l_Battle->BattleStatus = PETBATTLE_STATUS_PENDING_DELETE;
-            m_PetBbattlesDeleteQueue.push(std::pair<uint64, PetBattle*>(l_Iterator->first, l_Iterator->second));
+            m_PetBbattlesDeleteQueue.push(std::pair<uint64, PetBattle*>(l_Battle->ID, l_Battle));
         }
     }
 
@@ -2493,6 +2585,25 @@ void PetBattleSystem::Update(uint32 p_TimeDiff)
 
 //////////////////////////////////////////////////////////////////////////
 
+/// Update the battles handed to a map, from the thread updating it
+void PetBattleSystem::UpdateMapBattles(std::vector<std::pair<uint64, uint32>>& p_Battles, uint32 p_TimeDiff)
+{
+    /// Tokens are only bumped by the world thread, between two map updates
+    for (std::pair<uint64, uint32> const& l_Entry : p_Battles)
+    {
+        /// Removed battles are only deleted by the world thread, between two map updates
+        PetBattle* l_Battle = GetBattle(l_Entry.first);
+        if (!l_Battle || l_Battle->MapUpdateToken != l_Entry.second)
+            continue;
+
+        l_Battle->MapUpdatePending = false;
+        l_Battle->Update(p_TimeDiff);
+        ++MapBattleUpdates;
+    }
+
+    p_Battles.clear();
+}
+
 /// Forfeit an battle
 void PetBattleSystem::ForfeitBattle(uint64 p_BattleID, uint64 p_ForfeiterGuid)
 {
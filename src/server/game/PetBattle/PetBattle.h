@@ -28,6 +28,9 @@ class Field;
 #define PETBATTLE_DELETE_INTERVAL (1 * 30 * IN_MILLISECONDS)
 #define PETBATTLE_LFB_INTERVAL 500
 #define PETBATTLE_LFB_PROPOSAL_TIMEOUT (1 * MINUTE)
+#define PETBATTLE_SLOT_BITS 16                                                  ///< Low bits of a battle ID, its index in PetBattleSystem
+#define PETBATTLE_MAX_SLOTS (1 << PETBATTLE_SLOT_BITS)
+#define PETBATTLE_MAP_UPDATE_TIMEOUT (5 * IN_MILLISECONDS)                      ///< A battle handed to a map not updated for so long goes to another one
 
 #define PETBATTLE_TEAM_1 0
 #define PETBATTLE_TEAM_2 1
@@ -716,8 +719,11 @@ class PetBattle
         /// Get forfeit health penalty pct
         int32 GetForfeitHealthPenalityPct();
 
+        /// Map of the players of the battle still in world, if they are all on the same one
+        Map* GetUpdateMap() const;
+
     public:
-        uint32 ID;                                                              ///< Battle global unique ID
+        uint64 ID;                                                              ///< Battle global unique ID
         PetBattleType BattleType;                                               ///< Battle type (PETBATTLE_TYPE_PVE / PETBATTLE_TYPE_PVP_DUEL / PETBATTLE_TYPE_PVP_MATCHMAKING)
         PvePetBattleType PveBattleType;                                         ///< PVE battle type (PVE_PETBATTLE_WILD / PVE_PETBATTLE_TRAINER)
         uint32 Turn;                                                            ///< Battle current turn id
@@ -745,6 +751,10 @@ class PetBattle
         std::map<uint8, bool> FightedPets;
         int8 CatchedPetId;
 
+        bool MapUpdatePending;                                                  ///< Handed to its map by PetBattleSystem::Update, not updated yet
+        uint32 MapUpdateRequestTime;
+        uint32 MapUpdateToken;                                                  ///< Bumped on every handoff, only the map holding the current one updates the battle
+
     private:
         IntervalTimer m_UpdateTimer;
 
@@ -873,7 +883,10 @@ class PetBattleSystem
         void LeaveQueue(Player* p_Player);
 
         /// Update the whole pet battle system (request and battles)
+        /// Running battles are handed to the map of their players and simulated by its update, see UpdateMapBattles
         void Update(uint32 p_TimeDiff);
+        /// Update the battles handed to a map, from the thread updating it
+        void UpdateMapBattles(std::vector<std::pair<uint64, uint32>>& p_Battles, uint32 p_TimeDiff);
 
         /// Forfeit an battle
         void ForfeitBattle(uint64 p_BattleID, uint64 p_ForfeiterGuid);
@@ -881,9 +894,16 @@ class PetBattleSystem
         /// Can player enter in a pet battle
         eBattlePetRequests CanPlayerEnterInPetBattle(Player* p_Player, PetBattleRequest* p_Request);
 
+        uint32 GetBattleCount() const;
+
+        std::atomic<uint64>                 MapBattleUpdates;       ///< Battle updates done by the map threads
+        std::atomic<uint64>                 WorldBattleUpdates;     ///< Battle updates done by the world thread, for battles without player in world
+
     private:
-        uint32                              m_MaxPetBattleID;       ///< Global battle unique id
-        std::map<uint64, PetBattle*>        m_PetBattles;           ///< All running battles
+        uint64                              m_MaxPetBattleID;       ///< Global battle unique id, high bits of the battle IDs
+        std::vector<PetBattle*>             m_PetBattles;           ///< All running battles, indexed by the slot part of their ID
+        std::vector<uint32>                 m_FreeBattleSlots;
+        mutable std::mutex                  m_PetBattlesMutex;      ///< Battles are looked up from the map threads (player and map updates)
         std::map<uint64, PetBattleRequest*> m_Requests;             ///< All pending battles request
 
         IntervalTimer                               m_DeleteUpdateTimer;        ///< Deletion queue update timer
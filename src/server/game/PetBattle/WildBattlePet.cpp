@@ -68,13 +68,14 @@ void WildBattlePetZonePools::Populate()
 
         std::vector<Creature*> l_AvailableForReplacement;
 
-        for (std::list<uint64>::iterator l_It = l_Template->ToBeReplaced.begin(); l_It != l_Template->ToBeReplaced.end(); l_It++)
+        for (std::vector<uint64>::iterator l_It = l_Template->ToBeReplaced.begin(); l_It != l_Template->ToBeReplaced.end(); l_It++)
         {
             if (l_Template->ReplacedRelation.find((*l_It)) == l_Template->ReplacedRelation.end())
             {
                 Unit * l_Unit = sObjectAccessor->FindUnit((*l_It));
 
-                if (l_Unit && l_Unit->ToCreature())
+                /// No pet in grids without player around, they are populated when they become active again
+                if (l_Unit && l_Unit->ToCreature() && l_Unit->FindMap() && l_Unit->GetMap()->IsGridActive(l_Unit->GetPositionX(), l_Unit->GetPositionY()))
                     l_AvailableForReplacement.push_back(l_Unit->ToCreature());
             }
         }
@@ -94,9 +95,9 @@ void WildBattlePetZonePools::Depopulate()
     {
         WildBattlePetPoolTemplate* l_Template = &m_Templates[l_I];
 
-        std::map<uint64, uint64> l_Creatures = l_Template->ReplacedRelation;
+        std::unordered_map<uint64, uint64> l_Creatures = l_Template->ReplacedRelation;
 
-        for (std::map<uint64, uint64>::iterator l_It = l_Creatures.begin(); l_It != l_Creatures.end(); l_It++)
+        for (std::unordered_map<uint64, uint64>::iterator l_It = l_Creatures.begin(); l_It != l_Creatures.end(); l_It++)
         {
             Unit * l_Unit = sObjectAccessor->FindUnit((*l_It).first);
 
@@ -106,12 +107,42 @@ void WildBattlePetZonePools::Depopulate()
     }
 }
 
+void WildBattlePetZonePools::DepopulateGrid(Map* p_Map, uint32 p_GridX, uint32 p_GridY)
+{
+    std::vector<uint64> l_ReplacedInGrid;
+
+    for (size_t l_I = 0; l_I < m_Templates.size(); l_I++)
+    {
+        WildBattlePetPoolTemplate* l_Template = &m_Templates[l_I];
+
+        l_ReplacedInGrid.clear();
+        for (std::unordered_map<uint64, uint64>::const_iterator l_It = l_Template->ReplacedRelation.begin(); l_It != l_Template->ReplacedRelation.end(); ++l_It)
+        {
+            Creature* l_Replacement = p_Map->GetCreature(l_It->second);
+            if (!l_Replacement)
+                continue;
+
+            GridCoord l_Grid = JadeCore::ComputeGridCoord(l_Replacement->GetPositionX(), l_Replacement->GetPositionY());
+            if (l_Grid.x_coord == p_GridX && l_Grid.y_coord == p_GridY)
+                l_ReplacedInGrid.push_back(l_It->first);
+        }
+
+        for (uint64 l_Guid : l_ReplacedInGrid)
+        {
+            if (Creature* l_Creature = p_Map->GetCreature(l_Guid))
+                UnreplaceCreature(l_Creature, l_Template);
+        }
+    }
+}
+
 //////////////////////////////////////////////////////////////////////////
 
-void WildBattlePetZonePools::OnAddToMap(Creature* p_Creature)
+bool WildBattlePetZonePools::OnAddToMap(Creature* p_Creature)
 {
     if (!p_Creature)
-        return;
+        return false;
+
+    bool l_Added = false;
 
     for (size_t l_I = 0; l_I < m_Templates.size(); l_I++)
     {
@@ -121,8 +152,11 @@ void WildBattlePetZonePools::OnAddToMap(Creature* p_Creature)
             && l_Template->ReplacedBattlePetInstances.find(p_Creature->GetGUID()) == l_Template->ReplacedBattlePetInstances.end())
         {
             l_Template->ToBeReplaced.push_back(p_Creature->GetGUID());
+            l_Added = true;
         }
     }
+
+    return l_Added;
 }
 void WildBattlePetZonePools::OnRemoveToMap(Creature* p_Creature)
 {
@@ -134,7 +168,7 @@ void WildBattlePetZonePools::OnRemoveToMap(Creature* p_Creature)
         WildBattlePetPoolTemplate* l_Template = &m_Templates[l_I];
 
         if (l_Template->Replace == p_Creature->GetEntry())
-            l_Template->ToBeReplaced.remove(p_Creature->GetGUID());
+            l_Template->ToBeReplaced.erase(std::remove(l_Template->ToBeReplaced.begin(), l_Template->ToBeReplaced.end(), p_Creature->GetGUID()), l_Template->ToBeReplaced.end());
     }
 }
 
@@ -240,13 +274,17 @@ void WildBattlePetZonePools::ReplaceCreature(Creature* p_Creature, WildBattlePet
     l_ReplacementCreature->SetUInt32Value(UNIT_FIELD_WILD_BATTLE_PET_LEVEL, l_BattlePetInstance->Level);
     l_ReplacementCreature->SetRespawnRadius(3.5f);
     l_ReplacementCreature->SetDefaultMovementType(RANDOM_MOTION_TYPE);
+    l_ReplacementCreature->m_IsUnobservedWildBattlePet = true;
 
     if (!p_Creature->GetMap()->AddToMap(l_ReplacementCreature))
     {
+        p_Template->ReplacedBattlePetInstances.erase(l_ReplacementCreature->GetGUID());
         delete l_ReplacementCreature;
         return;
     }
 
+    ++WildBattlePetMgr::s_Spawned;
+
     // Despawn replaced creature
     p_Creature->ForcedDespawn();
     p_Creature->SetRespawnTime(MONTH);
@@ -270,7 +308,7 @@ void WildBattlePetZonePools::UnreplaceCreature(Creature* p_Creature, WildBattleP
     if (p_Template->ReplacedBattlePetInstances.find(l_ReplacementCreature->GetGUID()) != p_Template->ReplacedBattlePetInstances.end())
         p_Template->ReplacedBattlePetInstances.erase(p_Template->ReplacedBattlePetInstances.find(l_ReplacementCreature->GetGUID()));
 
-    p_Template->Replaced.remove(l_ReplacementCreature->GetGUID());
+    p_Template->Replaced.erase(std::remove(p_Template->Replaced.begin(), p_Template->Replaced.end(), l_ReplacementCreature->GetGUID()), p_Template->Replaced.end());
 
     l_ReplacementCreature->RemoveFromWorld();
     l_ReplacementCreature->AddObjectToRemoveList();
@@ -284,6 +322,10 @@ void WildBattlePetZonePools::UnreplaceCreature(Creature* p_Creature, WildBattleP
 //////////////////////////////////////////////////////////////////////////
 //////////////////////////////////////////////////////////////////////////
 
+std::atomic<uint64> WildBattlePetMgr::s_Spawned(0);
+std::atomic<uint64> WildBattlePetMgr::s_Observed(0);
+std::atomic<uint64> WildBattlePetMgr::s_ZonePopulations(0);
+
 WildBattlePetMgr::WildBattlePetMgr()
 {
     m_UpdateTime.SetInterval(WILDBATTLEPETMGR_UPDATE_INTERVAL);
@@ -293,7 +335,10 @@ WildBattlePetMgr::WildBattlePetMgr()
 
 void WildBattlePetMgr::Load()
 {
-    m_PoolsByMap.clear();
+    m_ZonePools.clear();
+    m_ZoneIndexes.clear();
+    m_ZonesByMap.clear();
+    m_PendingZones.reset();
 
     QueryResult l_Result = WorldDatabase.Query("SELECT Zone, Species, `Replace`, `Max`, RespawnTime, MinLevel, MaxLevel, Breed0, Breed1, Breed2, Breed3, Breed4, Breed5, Breed6, Breed7, Breed8, Breed9 FROM wild_battlepet_zone_pool");
     if (!l_Result)
@@ -326,10 +371,23 @@ void WildBattlePetMgr::Load()
             continue;
         }
 
+        std::unordered_map<uint32, uint32>::iterator l_Index = m_ZoneIndexes.find(l_ZoneID);
+        if (l_Index == m_ZoneIndexes.end())
+        {
+            l_Index = m_ZoneIndexes.insert(std::make_pair(l_ZoneID, uint32(m_ZonePools.size()))).first;
+            m_ZonesByMap[l_MapID].push_back(l_Index->second);
+
+            m_ZonePools.push_back(WildBattlePetZonePools());
+            m_ZonePools.back().MapID  = l_MapID;
+            m_ZonePools.back().ZoneID = l_ZoneID;
+        }
+
+        WildBattlePetZonePools& l_Pools = m_ZonePools[l_Index->second];
+
         bool l_Error = false;
-        for (size_t l_I = 0; l_I < m_PoolsByMap[l_MapID][l_ZoneID].m_Templates.size(); l_I++)
+        for (size_t l_I = 0; l_I < l_Pools.m_Templates.size(); l_I++)
         {
-            if (m_PoolsByMap[l_MapID][l_ZoneID].m_Templates[l_I].Replace == l_Fields[2].GetUInt32())
+            if (l_Pools.m_Templates[l_I].Replace == l_Fields[2].GetUInt32())
             {
                 l_Error = true;
                 sLog->outError(LOG_FILTER_SERVER_LOADING, "WildBattlePetMgr::Load() zone %u already contains a replacement for creature entry %u", l_ZoneID, l_Fields[2].GetUInt32());
@@ -341,75 +399,122 @@ void WildBattlePetMgr::Load()
         if (l_Error)
             continue;
 
-        m_PoolsByMap[l_MapID][l_ZoneID].LoadPoolTemplate(l_Fields);
-        m_PoolsByMap[l_MapID][l_ZoneID].MapID   = l_MapID;
-        m_PoolsByMap[l_MapID][l_ZoneID].ZoneID  = l_ZoneID;
+        l_Pools.LoadPoolTemplate(l_Fields);
 
         ++l_Count;
     }
     while (l_Result->NextRow());
 
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, ">> Loaded %u species definitions.", l_Count);
+    m_PendingZones.reset(new std::atomic<bool>[m_ZonePools.size()]);
+    for (uint32 l_I = 0; l_I < m_ZonePools.size(); ++l_I)
+        m_PendingZones[l_I] = false;
+
+    sLog->outInfo(LOG_FILTER_SERVER_LOADING, ">> Loaded %u species definitions in %u zones.", l_Count, uint32(m_ZonePools.size()));
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+WildBattlePetZonePools* WildBattlePetMgr::GetZonePools(uint32 p_MapID, uint32 p_ZoneID)
+{
+    std::unordered_map<uint32, uint32>::const_iterator l_Index = m_ZoneIndexes.find(p_ZoneID);
+    if (l_Index == m_ZoneIndexes.end())
+        return nullptr;
+
+    WildBattlePetZonePools* l_Pools = &m_ZonePools[l_Index->second];
+    return l_Pools->MapID == p_MapID ? l_Pools : nullptr;
+}
+
+void WildBattlePetMgr::SetPending(WildBattlePetZonePools const* p_Pools)
+{
+    m_PendingZones[p_Pools - m_ZonePools.data()].store(true, std::memory_order_relaxed);
+}
+
+uint32 WildBattlePetMgr::GetPendingZoneCount() const
+{
+    uint32 l_Count = 0;
+    for (uint32 l_I = 0; l_I < m_ZonePools.size(); ++l_I)
+    {
+        if (m_PendingZones[l_I].load(std::memory_order_relaxed))
+            ++l_Count;
+    }
+
+    return l_Count;
 }
 
 //////////////////////////////////////////////////////////////////////////
 
 void WildBattlePetMgr::PopulateAll()
 {
-    for (std::map<uint32, std::map<uint32, WildBattlePetZonePools> >::iterator l_It = m_PoolsByMap.begin(); l_It != m_PoolsByMap.end(); l_It++)
-        for (std::map<uint32, WildBattlePetZonePools>::iterator l_It2 = l_It->second.begin(); l_It2 != l_It->second.end(); l_It2++)
-            (*l_It2).second.Populate();
+    for (size_t l_I = 0; l_I < m_ZonePools.size(); l_I++)
+        m_ZonePools[l_I].Populate();
 }
 void WildBattlePetMgr::PopulateMap(uint32 p_MapID)
 {
-    if (m_PoolsByMap.find(p_MapID) == m_PoolsByMap.end())
+    std::unordered_map<uint32, std::vector<uint32>>::const_iterator l_Zones = m_ZonesByMap.find(p_MapID);
+    if (l_Zones == m_ZonesByMap.end())
         return;
 
-    for (std::map<uint32, WildBattlePetZonePools>::iterator l_It = m_PoolsByMap[p_MapID].begin(); l_It != m_PoolsByMap[p_MapID].end(); l_It++)
-        (*l_It).second.Populate();
+    for (uint32 l_Index : l_Zones->second)
+        m_ZonePools[l_Index].Populate();
 }
 void WildBattlePetMgr::DepopulateMap(uint32 p_MapID)
 {
-    if (m_PoolsByMap.find(p_MapID) == m_PoolsByMap.end())
+    std::unordered_map<uint32, std::vector<uint32>>::const_iterator l_Zones = m_ZonesByMap.find(p_MapID);
+    if (l_Zones == m_ZonesByMap.end())
         return;
 
-    for (std::map<uint32, WildBattlePetZonePools>::iterator l_It = m_PoolsByMap[p_MapID].begin(); l_It != m_PoolsByMap[p_MapID].end(); l_It++)
-        (*l_It).second.Depopulate();
+    for (uint32 l_Index : l_Zones->second)
+        m_ZonePools[l_Index].Depopulate();
 }
 
 //////////////////////////////////////////////////////////////////////////
 
-void WildBattlePetMgr::OnAddToMap(Creature* p_Creature)
+void WildBattlePetMgr::OnGridActivated(Map* p_Map, uint32 p_GridX, uint32 p_GridY)
 {
-    if (!p_Creature)
+    std::unordered_map<uint32, std::vector<uint32>>::const_iterator l_Zones = m_ZonesByMap.find(p_Map->GetId());
+    if (l_Zones == m_ZonesByMap.end())
         return;
 
-    uint32 l_ZoneID = p_Creature->GetZoneId();
-    uint32 l_MapID  = p_Creature->GetMapId();
+    std::vector<uint32> l_GridZones;
+    p_Map->GetGridZones(p_GridX, p_GridY, l_GridZones);
 
-    if (m_PoolsByMap.find(l_MapID) == m_PoolsByMap.end())
+    /// Creatures of a grid loaded earlier are already known by the pools, only a populate of the zones under the grid is needed
+    for (uint32 l_Index : l_Zones->second)
+    {
+        if (std::find(l_GridZones.begin(), l_GridZones.end(), m_ZonePools[l_Index].ZoneID) != l_GridZones.end())
+            SetPending(&m_ZonePools[l_Index]);
+    }
+}
+void WildBattlePetMgr::OnGridIdle(Map* p_Map, NGridType& p_Grid)
+{
+    std::unordered_map<uint32, std::vector<uint32>>::const_iterator l_Zones = m_ZonesByMap.find(p_Map->GetId());
+    if (l_Zones == m_ZonesByMap.end())
         return;
 
-    if (m_PoolsByMap[l_MapID].find(l_ZoneID) == m_PoolsByMap[l_MapID].end())
+    for (uint32 l_Index : l_Zones->second)
+        m_ZonePools[l_Index].DepopulateGrid(p_Map, p_Grid.getX(), p_Grid.getY());
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+void WildBattlePetMgr::OnAddToMap(Creature* p_Creature)
+{
+    if (!p_Creature)
         return;
 
-    m_PoolsByMap[l_MapID][l_ZoneID].OnAddToMap(p_Creature);
+    if (WildBattlePetZonePools* l_Pools = GetZonePools(p_Creature->GetMapId(), p_Creature->GetZoneId()))
+    {
+        if (l_Pools->OnAddToMap(p_Creature))
+            SetPending(l_Pools);
+    }
 }
 void WildBattlePetMgr::OnRemoveToMap(Creature* p_Creature)
 {
     if (!p_Creature)
         return;
 
-    uint32 l_ZoneID = p_Creature->GetZoneId();
-    uint32 l_MapID  = p_Creature->GetMapId();
-
-    if (m_PoolsByMap.find(l_MapID) == m_PoolsByMap.end())
-        return;
-
-    if (m_PoolsByMap[l_MapID].find(l_ZoneID) == m_PoolsByMap[l_MapID].end())
-        return;
-
-    m_PoolsByMap[l_MapID][l_ZoneID].OnRemoveToMap(p_Creature);
+    if (WildBattlePetZonePools* l_Pools = GetZonePools(p_Creature->GetMapId(), p_Creature->GetZoneId()))
+        l_Pools->OnRemoveToMap(p_Creature);
 }
 
 //////////////////////////////////////////////////////////////////////////
@@ -419,17 +524,10 @@ bool WildBattlePetMgr::IsWildPet(Creature* p_Creature)
     if (!p_Creature)
         return false;
 
-    uint32 l_ZoneID = p_Creature->GetZoneId();
-    uint32 l_MapID  = p_Creature->GetMapId();
-
-    if (m_PoolsByMap.find(l_MapID) == m_PoolsByMap.end())
-        return false;
-
-    if (m_PoolsByMap[l_MapID].find(l_ZoneID) == m_PoolsByMap[l_MapID].end())
+    WildBattlePetZonePools* l_Pools = GetZonePools(p_Creature->GetMapId(), p_Creature->GetZoneId());
+    if (!l_Pools)
         return false;
 
-    WildBattlePetZonePools* l_Pools = &m_PoolsByMap[l_MapID][l_ZoneID];
-
     for (size_t l_I = 0; l_I < l_Pools->m_Templates.size(); l_I++)
     {
         if (l_Pools->m_Templates[l_I].ReplacedBattlePetInstances.find(p_Creature->GetGUID()) != l_Pools->m_Templates[l_I].ReplacedBattlePetInstances.end())
@@ -443,10 +541,7 @@ std::shared_ptr<BattlePetInstance> WildBattlePetMgr::GetWildBattlePet(Creature*
     if (!IsWildPet(p_Creature) || !p_Creature)
         return NULL;
 
-    uint32 l_ZoneID = p_Creature->GetZoneId();
-    uint32 l_MapID  = p_Creature->GetMapId();
-
-    WildBattlePetZonePools* l_Pools = &m_PoolsByMap[l_MapID][l_ZoneID];
+    WildBattlePetZonePools* l_Pools = GetZonePools(p_Creature->GetMapId(), p_Creature->GetZoneId());
 
     for (size_t l_I = 0; l_I < l_Pools->m_Templates.size(); l_I++)
     {
@@ -473,17 +568,13 @@ void WildBattlePetMgr::LeaveBattle(Creature* p_Creature, bool /*p_Defeated*/)
     if (!IsWildPet(p_Creature))
         return;
 
-    uint32 l_ZoneID = p_Creature->GetZoneId();
-    uint32 l_MapID  = p_Creature->GetMapId();
-
-    WildBattlePetZonePools* l_Pools = &m_PoolsByMap[l_MapID][l_ZoneID];
-
+    WildBattlePetZonePools* l_Pools = GetZonePools(p_Creature->GetMapId(), p_Creature->GetZoneId());
 
     for (size_t l_I = 0; l_I < l_Pools->m_Templates.size(); l_I++)
     {
         WildBattlePetPoolTemplate* l_Template = &l_Pools->m_Templates[l_I];
 
-        for (std::map<uint64, uint64>::iterator l_It = l_Template->ReplacedRelation.begin(); l_It != l_Template->ReplacedRelation.end(); ++l_It)
+        for (std::unordered_map<uint64, uint64>::iterator l_It = l_Template->ReplacedRelation.begin(); l_It != l_Template->ReplacedRelation.end(); ++l_It)
         {
             if (l_It->second == p_Creature->GetGUID())
             {
@@ -494,6 +585,9 @@ void WildBattlePetMgr::LeaveBattle(Creature* p_Creature, bool /*p_Defeated*/)
 
                 l_Pools->UnreplaceCreature(l_Unit->ToCreature(), l_Template);
 
+                /// The freed slot is filled by the next update
+                SetPending(l_Pools);
+
                 return;
             }
         }
@@ -506,10 +600,18 @@ void WildBattlePetMgr::Update(uint32 p_TimeDiff)
 {
     m_UpdateTime.Update(p_TimeDiff);
 
-    if (m_UpdateTime.Passed())
+    if (!m_UpdateTime.Passed())
+        return;
+
+    m_UpdateTime.Reset();
+
+    /// Only the zones with a grid activated or a slot freed since the last update
+    for (uint32 l_I = 0; l_I < m_ZonePools.size(); ++l_I)
     {
-        m_UpdateTime.Reset();
+        if (!m_PendingZones[l_I].exchange(false, std::memory_order_relaxed))
+            continue;
 
-        PopulateAll();
+        m_ZonePools[l_I].Populate();
+        ++s_ZonePopulations;
     }
 }
@@ -13,11 +13,16 @@
 #include "Common.h"
 #include "Timer.h"
 #include "PetBattle.h"
+#include "GridDefines.h"
+
+#include <atomic>
+#include <unordered_map>
 
 #define WILDBATTLEPETMGR_UPDATE_INTERVAL 6000
 #define WILDBATTLEPET_RESPAWN_WHEN_NOT_DEFEATED 10
 
 class Creature;
+class Map;
 
 struct WildBattlePetPoolTemplate
 {
@@ -30,12 +35,12 @@ struct WildBattlePetPoolTemplate
     uint32 MaxLevel;
     uint32 Breeds[10];
 
-    std::list<uint64>            ToBeReplaced;
-    std::list<uint64>            Replaced;
+    std::vector<uint64>          ToBeReplaced;
+    std::vector<uint64>          Replaced;
 
-    /// @TODO: replace this
-    std::map<uint64, uint64>                                ReplacedRelation;
-    std::map<uint64, std::shared_ptr<BattlePetInstance>>    ReplacedBattlePetInstances;
+    ///                 replaced creature -> replacement
+    std::unordered_map<uint64, uint64>                                ReplacedRelation;
+    std::unordered_map<uint64, std::shared_ptr<BattlePetInstance>>    ReplacedBattlePetInstances;
 };
 
 class WildBattlePetZonePools
@@ -45,8 +50,11 @@ class WildBattlePetZonePools
 
         void Populate();
         void Depopulate();
+        /// Give back the creatures replaced in a grid going idle
+        void DepopulateGrid(Map* p_Map, uint32 p_GridX, uint32 p_GridY);
 
-        void OnAddToMap(Creature* p_Creature);
+        /// Returns true if the creature can be replaced by a pet of the zone
+        bool OnAddToMap(Creature* p_Creature);
         void OnRemoveToMap(Creature* p_Creature);
 
         void EnterInBattle(Creature* p_Creature);
@@ -73,6 +81,10 @@ class WildBattlePetMgr
         void PopulateMap(uint32 p_MapID);
         void DepopulateMap(uint32 p_MapID);
 
+        /// Zones are only populated around active grids: on activation, and when a slot is freed
+        void OnGridActivated(Map* p_Map, uint32 p_GridX, uint32 p_GridY);
+        void OnGridIdle(Map* p_Map, NGridType& p_Grid);
+
         void OnAddToMap(Creature* p_Creature);
         void OnRemoveToMap(Creature* p_Creature);
 
@@ -84,10 +96,22 @@ class WildBattlePetMgr
 
         void Update(uint32 p_TimeDiff);
 
+        uint32 GetZoneCount() const { return uint32(m_ZonePools.size()); }
+        uint32 GetPendingZoneCount() const;
+
+        static std::atomic<uint64> s_Spawned;           ///< Pets spawned since startup, for .debug stats wildpets
+        static std::atomic<uint64> s_Observed;          ///< Spawned pets seen by at least one player
+        static std::atomic<uint64> s_ZonePopulations;   ///< Zone pools populated by Update
+
     private:
-        ///        map              zone          pools
-        std::map<uint32, std::map<uint32, WildBattlePetZonePools>>  m_PoolsByMap;
-        IntervalTimer                                               m_UpdateTime;
+        WildBattlePetZonePools* GetZonePools(uint32 p_MapID, uint32 p_ZoneID);
+        void SetPending(WildBattlePetZonePools const* p_Pools);
+
+        std::vector<WildBattlePetZonePools>                     m_ZonePools;
+        std::unordered_map<uint32, uint32>                      m_ZoneIndexes;      ///< Zone -> index in m_ZonePools
+        std::unordered_map<uint32, std::vector<uint32>>         m_ZonesByMap;       ///< Map -> indexes in m_ZonePools
+        std::unique_ptr<std::atomic<bool>[]>                    m_PendingZones;     ///< Per index in m_ZonePools, set from the map threads
+        IntervalTimer                                           m_UpdateTime;
 };
 
 #define sWildBattlePetMgr ACE_Singleton<WildBattlePetMgr, ACE_Null_Mutex>::instance()
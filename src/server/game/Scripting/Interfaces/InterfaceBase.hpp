@@ -11,6 +11,7 @@
 #define SCRIPTING_INTERFACES_INTERFACEBASE_HPP_INCLUDED
 
 #include "Common.h"
+#include "ScriptHooks.h"
 #include <ace/Atomic_Op.h>
 
 #include "Player.h"
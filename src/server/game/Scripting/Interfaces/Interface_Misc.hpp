@@ -23,18 +23,19 @@ class ServerScript : public ScriptObjectImpl<false>
         /// Called when reactive socket I/O is started (WorldSocketMgr).
         virtual void OnNetworkStart()
         {
-
+            ScriptHookNotOverridden();
         }
         /// Called when reactive I/O is stopped.
         virtual void OnNetworkStop()
         {
-
+            ScriptHookNotOverridden();
         }
 
         /// Called when a remote socket establishes a connection to the server. Do not store the socket object.
         /// @p_Socket : Opened socket
         virtual void OnSocketOpen(WorldSocket * p_Socket)
         {
+            ScriptHookNotOverridden();
             UNUSED(p_Socket);
         }
         /// Called when a socket is closed. Do not store the socket object, and do not rely on the connection being open; it is not.
@@ -42,25 +43,28 @@ class ServerScript : public ScriptObjectImpl<false>
         /// @p_WasNew : Was new ?
         virtual void OnSocketClose(WorldSocket * p_Socket, bool p_WasNew)
         {
+            ScriptHookNotOverridden();
             UNUSED(p_Socket);
             UNUSED(p_WasNew);
         }
 
-        /// Called when a packet is sent to a client. The packet object is a copy of the original packet, so reading and modifying it is safe.
+        /// Called when a packet is sent to a client. The packet is the original one, copy it to read it.
         /// @p_Socket : Socket who send the packet
         /// @p_Packet : Sent packet
-        virtual void OnPacketSend(WorldSocket * p_Socket, WorldPacket & p_Packet)
+        virtual void OnPacketSend(WorldSocket * p_Socket, WorldPacket const& p_Packet)
         {
+            ScriptHookNotOverridden();
             UNUSED(p_Socket);
             UNUSED(p_Packet);
         }
 
-        /// Called when a (valid) packet is received by a client. The packet object is a copy of the original packet, so reading and modifying it is safe.
+        /// Called when a (valid) packet is received by a client. The packet is the original one, copy it to read it.
         /// @p_Socket  : Socket who received the packet
         /// @p_Packet  : Received packet
         /// @p_Session : Session who received the packet /!\ CAN BE NULLPTR
-        virtual void OnPacketReceive(WorldSocket* p_Socket, WorldPacket& p_Packet, WorldSession* p_Session)
+        virtual void OnPacketReceive(WorldSocket* p_Socket, WorldPacket const& p_Packet, WorldSession* p_Session)
         {
+            ScriptHookNotOverridden();
             UNUSED(p_Socket);
             UNUSED(p_Packet);
             UNUSED(p_Session);
@@ -70,8 +74,9 @@ class ServerScript : public ScriptObjectImpl<false>
         /// This allows you to actually handle unknown packets (for whatever purpose).
         /// @p_Socket : Socket who received the packet
         /// @p_Packet : Received packet
-        virtual void OnUnknownPacketReceive(WorldSocket * p_Socket, WorldPacket & p_Packet)
+        virtual void OnUnknownPacketReceive(WorldSocket * p_Socket, WorldPacket const& p_Packet)
         {
+            ScriptHookNotOverridden();
             UNUSED(p_Socket);
             UNUSED(p_Packet);
         }
@@ -127,6 +132,7 @@ class WorldScript : public ScriptObjectImpl<false>
         /// @p_Diff : Time since last update
         virtual void OnUpdate(uint32 p_Diff)
         {
+            ScriptHookNotOverridden();
             UNUSED(p_Diff);
         }
 
@@ -194,6 +194,7 @@ class PlayerScript : public ScriptObjectImpl<false>
         /// @p_After : If it's after modification
         virtual void OnModifyPower(Player* p_Player, Powers p_Power, int32 p_OldValue, int32& p_NewValue, bool p_Regen, bool p_After)
         {
+            ScriptHookNotOverridden();
             UNUSED(p_Player);
             UNUSED(p_Power);
             UNUSED(p_OldValue);
@@ -226,6 +227,7 @@ class PlayerScript : public ScriptObjectImpl<false>
         /// @p_Value  : New value
         virtual void OnModifyHealth(Player* p_Player, int32 p_Value)
         {
+            ScriptHookNotOverridden();
             UNUSED(p_Player);
             UNUSED(p_Value);
         }
@@ -253,6 +255,7 @@ class PlayerScript : public ScriptObjectImpl<false>
         /// @p_Amount : Modified money amount
         virtual void OnMoneyChanged(Player* p_Player, int64& p_Amount)
         {
+            ScriptHookNotOverridden();
             UNUSED(p_Player);
             UNUSED(p_Amount);
         }
@@ -424,6 +427,7 @@ class PlayerScript : public ScriptObjectImpl<false>
         /// @p_SkipCheck : Skipped checks
         virtual void OnSpellCast(Player* p_Player, Spell* p_Spell, bool p_SkipCheck)
         {
+            ScriptHookNotOverridden();
             UNUSED(p_Player);
             UNUSED(p_Spell);
             UNUSED(p_SkipCheck);
@@ -471,6 +475,7 @@ class PlayerScript : public ScriptObjectImpl<false>
         /// @p_Diff : diff time
         virtual void OnUpdate(Player* p_Player, uint32 p_Diff)
         {
+            ScriptHookNotOverridden();
             UNUSED(p_Player);
             UNUSED(p_Diff);
         }
@@ -516,6 +521,7 @@ class PlayerScript : public ScriptObjectImpl<false>
         /// @p_Player : Player instance
         virtual void OnUpdateMovement(Player* p_Player)
         {
+            ScriptHookNotOverridden();
             UNUSED(p_Player);
         }
 
@@ -634,6 +640,7 @@ class PlayerScript : public ScriptObjectImpl<false>
         /// @p_AddValue : amount of power to regenerate
         virtual void OnRegenPower(Player* p_Player, Powers const p_Power, float& l_AddValue, bool& p_PreventDefault)
         {
+            ScriptHookNotOverridden();
             UNUSED(p_Player);
             UNUSED(p_Power);
             UNUSED(l_AddValue);
@@ -653,6 +660,7 @@ class PlayerScript : public ScriptObjectImpl<false>
         /// @p_SchoolMask      : school mask of the damage
         virtual void OnTakeDamage(Player* p_Player, DamageEffectType p_DamageEffectType, uint32 p_Damage, SpellSchoolMask p_SchoolMask, CleanDamage const* p_CleanDamage)
         {
+            ScriptHookNotOverridden();
             UNUSED(p_Player);
             UNUSED(p_DamageEffectType);
             UNUSED(p_Damage);
@@ -665,6 +673,7 @@ class PlayerScript : public ScriptObjectImpl<false>
         /// @p_DamageInfo  : Damage Infos
         virtual void OnBlock(Player* p_Player, Unit* p_Attacker)
         {
+            ScriptHookNotOverridden();
             UNUSED(p_Player);
             UNUSED(p_Attacker);
         }
@@ -0,0 +1,135 @@
+////////////////////////////////////////////////////////////////////////////////
+//
+//  MILLENIUM-STUDIO
+//  Copyright 2016 Millenium-studio SARL
+//  All Rights Reserved.
+//
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef SCRIPT_HOOKS_H
+#define SCRIPT_HOOKS_H
+
+#include "Common.h"
+
+#include <atomic>
+#include <memory>
+#include <vector>
+
+/// Set by the default implementation of a hook called through a ScriptHookList
+extern thread_local bool g_ScriptHookDefaultCalled;
+
+/// Invocation counters of the calling thread, one per hook list, see ScriptHookListBase::AddCalls
+extern thread_local std::atomic<uint64>* g_ScriptHookCallCounters;
+
+/// To call from the default (empty) implementation of a hook dispatched through a ScriptHookList:
+/// the script does not override the hook and is unsubscribed from it after this call.
+/// An override calling the default implementation is unsubscribed too.
+inline void ScriptHookNotOverridden()
+{
+    g_ScriptHookDefaultCalled = true;
+}
+
+/// Name, subscribers and invocations of a hook, for the stats
+class ScriptHookListBase
+{
+    public:
+        explicit ScriptHookListBase(char const* p_Name);
+
+        char const* GetName() const { return m_Name; }
+        uint32 GetScriptCount() const { return m_ScriptCount; }
+        uint32 GetSubscriberCount() const { return m_SubscriberCount.load(std::memory_order_relaxed); }
+
+        /// Sum of the invocation counters of all the threads
+        uint64 GetCallCount() const;
+
+        /// Every hook list, in declaration order
+        static std::vector<ScriptHookListBase*>& GetAll();
+
+    protected:
+        /// Only the calling thread writes its counters, a plain load and store instead of a locked add
+        void AddCalls(uint32 p_Calls)
+        {
+            std::atomic<uint64>* l_Counters = g_ScriptHookCallCounters ? g_ScriptHookCallCounters : RegisterThreadCallCounters();
+            l_Counters[m_Index].store(l_Counters[m_Index].load(std::memory_order_relaxed) + p_Calls, std::memory_order_relaxed);
+        }
+
+        char const* m_Name;
+        uint32 m_Index;                 ///< In GetAll() and in the counters of each thread
+        uint32 m_ScriptCount;
+        std::atomic<uint32> m_SubscriberCount;
+
+    private:
+        static std::atomic<uint64>* RegisterThreadCallCounters();
+};
+
+/// Scripts of type TScript subscribed to one hook.
+///
+/// Every script of the type is subscribed when the list is built, a script is unsubscribed the first time
+/// the default implementation of the hook runs for it (ScriptHookNotOverridden). Dispatch is a walk over a
+/// flat array and does nothing at all once no script is left, the array itself is never modified after
+/// Build so the hook can be dispatched from any thread.
+template<class TScript> class ScriptHookList : public ScriptHookListBase
+{
+    public:
+        explicit ScriptHookList(char const* p_Name) : ScriptHookListBase(p_Name) { }
+
+        bool HasSubscribers() const { return m_SubscriberCount.load(std::memory_order_relaxed) != 0; }
+
+        /// Subscribe the scripts of the registry, at startup only
+        template<class TScriptMap> void Build(TScriptMap const& p_Scripts)
+        {
+            m_Scripts.clear();
+            for (auto const& l_Pair : p_Scripts)
+                m_Scripts.push_back(l_Pair.second);
+
+            m_Active.reset(new std::atomic<bool>[m_Scripts.size()]);
+            for (uint32 l_I = 0; l_I < m_Scripts.size(); ++l_I)
+                m_Active[l_I] = true;
+
+            m_ScriptCount = uint32(m_Scripts.size());
+            m_SubscriberCount = m_ScriptCount;
+        }
+
+        void Clear()
+        {
+            m_SubscriberCount = 0;
+            m_ScriptCount = 0;
+            m_Scripts.clear();
+            m_Active.reset();
+        }
+
+        /// Call p_Hook(TScript*) for each subscribed script
+        template<class Hook> void Dispatch(Hook p_Hook)
+        {
+            if (!HasSubscribers())
+                return;
+
+            uint32 l_Calls = 0;
+
+            for (uint32 l_I = 0; l_I < m_Scripts.size(); ++l_I)
+            {
+                if (!m_Active[l_I].load(std::memory_order_relaxed))
+                    continue;
+
+                g_ScriptHookDefaultCalled = false;
+                p_Hook(m_Scripts[l_I]);
+                ++l_Calls;
+
+                bool l_NotOverridden = g_ScriptHookDefaultCalled;
+
+                /// A hook dispatched by this one must not be taken for the default implementation of this one
+                g_ScriptHookDefaultCalled = false;
+
+                if (l_NotOverridden && m_Active[l_I].exchange(false))
+                    --m_SubscriberCount;
+            }
+
+            AddCalls(l_Calls);
+        }
+
+    private:
+        std::vector<TScript*> m_Scripts;
+        std::unique_ptr<std::atomic<bool>[]> m_Active;
+};
+
+#endif
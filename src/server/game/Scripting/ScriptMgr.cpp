@@ -25,6 +25,8 @@
 #include "BattlepayMgr.h"
 #endif /* not CROSS */
 
+#include <mutex>
+
 void DoScriptText(int32 p_ItemTextEntry, WorldObject* p_Source, Unit* p_Target)
 {
     if (!p_Source)
@@ -233,6 +235,89 @@ template<class TScript> class ScriptRegistry
     FOR_SCRIPTS(T, itr, end) \
     itr->second
 
+//////////////////////////////////////////////////////////////////////////
+/// Hooks called often enough for the iteration over every script of the type to matter, see ScriptHooks.h
+//////////////////////////////////////////////////////////////////////////
+
+thread_local bool g_ScriptHookDefaultCalled = false;
+thread_local std::atomic<uint64>* g_ScriptHookCallCounters = nullptr;
+
+namespace
+{
+    /// Counters of every thread which dispatched a hook, never freed so they outlive their thread
+    std::mutex& GetCallCountersLock()
+    {
+        static std::mutex s_Lock;
+        return s_Lock;
+    }
+
+    std::vector<std::atomic<uint64>*>& GetCallCounters()
+    {
+        static std::vector<std::atomic<uint64>*> s_Counters;
+        return s_Counters;
+    }
+}
+
+ScriptHookListBase::ScriptHookListBase(char const* p_Name) : m_Name(p_Name), m_Index(uint32(GetAll().size())), m_ScriptCount(0), m_SubscriberCount(0)
+{
+    GetAll().push_back(this);
+}
+
+std::vector<ScriptHookListBase*>& ScriptHookListBase::GetAll()
+{
+    static std::vector<ScriptHookListBase*> s_HookLists;
+    return s_HookLists;
+}
+
+std::atomic<uint64>* ScriptHookListBase::RegisterThreadCallCounters()
+{
+    /// Every hook list is a static object, the count is known before the first dispatch
+    uint32 l_HookCount = uint32(GetAll().size());
+
+    std::atomic<uint64>* l_Counters = new std::atomic<uint64>[l_HookCount];
+    for (uint32 l_I = 0; l_I < l_HookCount; ++l_I)
+        l_Counters[l_I] = 0;
+
+    std::lock_guard<std::mutex> l_Guard(GetCallCountersLock());
+    GetCallCounters().push_back(l_Counters);
+    g_ScriptHookCallCounters = l_Counters;
+    return l_Counters;
+}
+
+uint64 ScriptHookListBase::GetCallCount() const
+{
+    std::lock_guard<std::mutex> l_Guard(GetCallCountersLock());
+
+    uint64 l_Calls = 0;
+    for (std::atomic<uint64> const* l_Counters : GetCallCounters())
+        l_Calls += l_Counters[m_Index].load(std::memory_order_relaxed);
+
+    return l_Calls;
+}
+
+namespace ScriptHooks
+{
+    ScriptHookList<ServerScript> OnNetworkStart("ServerScript::OnNetworkStart");
+    ScriptHookList<ServerScript> OnNetworkStop("ServerScript::OnNetworkStop");
+    ScriptHookList<ServerScript> OnSocketOpen("ServerScript::OnSocketOpen");
+    ScriptHookList<ServerScript> OnSocketClose("ServerScript::OnSocketClose");
+    ScriptHookList<ServerScript> OnPacketReceive("ServerScript::OnPacketReceive");
+    ScriptHookList<ServerScript> OnPacketSend("ServerScript::OnPacketSend");
+    ScriptHookList<ServerScript> OnUnknownPacketReceive("ServerScript::OnUnknownPacketReceive");
+
+    ScriptHookList<WorldScript> OnWorldUpdate("WorldScript::OnUpdate");
+
+    ScriptHookList<PlayerScript> OnPlayerUpdate("PlayerScript::OnUpdate");
+    ScriptHookList<PlayerScript> OnModifyPower("PlayerScript::OnModifyPower");
+    ScriptHookList<PlayerScript> OnModifyHealth("PlayerScript::OnModifyHealth");
+    ScriptHookList<PlayerScript> OnMoneyChanged("PlayerScript::OnMoneyChanged");
+    ScriptHookList<PlayerScript> OnSpellCast("PlayerScript::OnSpellCast");
+    ScriptHookList<PlayerScript> OnUpdateMovement("PlayerScript::OnUpdateMovement");
+    ScriptHookList<PlayerScript> OnRegenPower("PlayerScript::OnRegenPower");
+    ScriptHookList<PlayerScript> OnTakeDamage("PlayerScript::OnTakeDamage");
+    ScriptHookList<PlayerScript> OnBlock("PlayerScript::OnBlock");
+}
+
 /// Utility macros for finding specific scripts.
 #define GET_SCRIPT_NO_RET(T, I, V) \
     T* V = ScriptRegistry<T>::GetScriptById(I);
@@ -274,13 +359,57 @@ void ScriptMgr::Initialize()
 
     FillSpellSummary();
     AddScripts();
+    BuildScriptHooks();
 
     sLog->outInfo(LOG_FILTER_SERVER_LOADING, ">> Loaded %u C++ scripts in %u ms", GetScriptCount(), GetMSTimeDiffToNow(l_OldMSTime));
 }
 
+/// Subscribe the scripts to the hooks dispatched through a ScriptHookList, once all of them are added
+void ScriptMgr::BuildScriptHooks()
+{
+    ScriptHooks::OnNetworkStart.Build(SCR_REG_LST(ServerScript));
+    ScriptHooks::OnNetworkStop.Build(SCR_REG_LST(ServerScript));
+    ScriptHooks::OnSocketOpen.Build(SCR_REG_LST(ServerScript));
+    ScriptHooks::OnSocketClose.Build(SCR_REG_LST(ServerScript));
+    ScriptHooks::OnPacketReceive.Build(SCR_REG_LST(ServerScript));
+    ScriptHooks::OnPacketSend.Build(SCR_REG_LST(ServerScript));
+    ScriptHooks::OnUnknownPacketReceive.Build(SCR_REG_LST(ServerScript));
+
+    ScriptHooks::OnWorldUpdate.Build(SCR_REG_LST(WorldScript));
+
+    ScriptHooks::OnPlayerUpdate.Build(SCR_REG_LST(PlayerScript));
+    ScriptHooks::OnModifyPower.Build(SCR_REG_LST(PlayerScript));
+    ScriptHooks::OnModifyHealth.Build(SCR_REG_LST(PlayerScript));
+    ScriptHooks::OnMoneyChanged.Build(SCR_REG_LST(PlayerScript));
+    ScriptHooks::OnSpellCast.Build(SCR_REG_LST(PlayerScript));
+    ScriptHooks::OnUpdateMovement.Build(SCR_REG_LST(PlayerScript));
+    ScriptHooks::OnRegenPower.Build(SCR_REG_LST(PlayerScript));
+    ScriptHooks::OnTakeDamage.Build(SCR_REG_LST(PlayerScript));
+    ScriptHooks::OnBlock.Build(SCR_REG_LST(PlayerScript));
+}
+
 /// Unload all script
 void ScriptMgr::Unload()
 {
+    /// The hooks must not call the deleted scripts
+    ScriptHooks::OnNetworkStart.Clear();
+    ScriptHooks::OnNetworkStop.Clear();
+    ScriptHooks::OnSocketOpen.Clear();
+    ScriptHooks::OnSocketClose.Clear();
+    ScriptHooks::OnPacketReceive.Clear();
+    ScriptHooks::OnPacketSend.Clear();
+    ScriptHooks::OnUnknownPacketReceive.Clear();
+    ScriptHooks::OnWorldUpdate.Clear();
+    ScriptHooks::OnPlayerUpdate.Clear();
+    ScriptHooks::OnModifyPower.Clear();
+    ScriptHooks::OnModifyHealth.Clear();
+    ScriptHooks::OnMoneyChanged.Clear();
+    ScriptHooks::OnSpellCast.Clear();
+    ScriptHooks::OnUpdateMovement.Clear();
+    ScriptHooks::OnRegenPower.Clear();
+    ScriptHooks::OnTakeDamage.Clear();
+    ScriptHooks::OnBlock.Clear();
+
     /// Clear scripts for every script type.
     ScriptRegistry<SpellScriptLoader>::Clear();
     ScriptRegistry<ServerScript>::Clear();
@@ -1376,13 +1505,13 @@ InstanceScript* ScriptMgr::CreateInstanceData(InstanceMap* p_Map)
 /// Called when reactive socket I/O is started (WorldSocketMgr).
 void ScriptMgr::OnNetworkStart()
 {
-    FOREACH_SCRIPT(ServerScript)->OnNetworkStart();
+    ScriptHooks::OnNetworkStart.Dispatch([](ServerScript* p_Script) { p_Script->OnNetworkStart(); });
 }
 
 /// Called when reactive I/O is stopped.
 void ScriptMgr::OnNetworkStop()
 {
-    FOREACH_SCRIPT(ServerScript)->OnNetworkStop();
+    ScriptHooks::OnNetworkStop.Dispatch([](ServerScript* p_Script) { p_Script->OnNetworkStop(); });
 }
 
 /// Called when a remote socket establishes a connection to the server. Do not store the socket object.
@@ -1391,7 +1520,7 @@ void ScriptMgr::OnSocketOpen(WorldSocket* p_Socket)
 {
     ASSERT(p_Socket);
 
-    FOREACH_SCRIPT(ServerScript)->OnSocketOpen(p_Socket);
+    ScriptHooks::OnSocketOpen.Dispatch([&](ServerScript* p_Script) { p_Script->OnSocketOpen(p_Socket); });
 }
 
 /// Called when a socket is closed. Do not store the socket object, and do not rely on the connection being open; it is not.
@@ -1401,39 +1530,38 @@ void ScriptMgr::OnSocketClose(WorldSocket* p_Socket, bool p_WasNew)
 {
     ASSERT(p_Socket);
 
-    FOREACH_SCRIPT(ServerScript)->OnSocketClose(p_Socket, p_WasNew);
+    ScriptHooks::OnSocketClose.Dispatch([&](ServerScript* p_Script) { p_Script->OnSocketClose(p_Socket, p_WasNew); });
 }
 
-/// Called when a packet is sent to a client. The packet object is a copy of the original packet, so reading and modifying it is safe.
-/// @p_Socket : Socket who send the packet
-/// @p_Packet : Sent packet
-void ScriptMgr::OnPacketReceive(WorldSocket* p_Socket, WorldPacket p_Packet, WorldSession* p_Session)
+/// Called when a (valid) packet is received by a client. The packet is not copied, scripts copy it to read it.
+/// @p_Socket : Socket who received the packet
+/// @p_Packet : Received packet
+void ScriptMgr::OnPacketReceive(WorldSocket* p_Socket, WorldPacket const& p_Packet, WorldSession* p_Session)
 {
     ASSERT(p_Socket);
 
-    FOREACH_SCRIPT(ServerScript)->OnPacketReceive(p_Socket, p_Packet, p_Session);
+    ScriptHooks::OnPacketReceive.Dispatch([&](ServerScript* p_Script) { p_Script->OnPacketReceive(p_Socket, p_Packet, p_Session); });
 }
 
-/// Called when a (valid) packet is received by a client. The packet object is a copy of the original packet, so reading and modifying it is safe.
-/// @p_Socket : Socket who received the packet
-/// @p_Packet : Received packet
-void ScriptMgr::OnPacketSend(WorldSocket* p_Socket, WorldPacket p_Packet)
+/// Called when a packet is sent to a client. The packet is not copied, scripts copy it to read it.
+/// @p_Socket : Socket who send the packet
+/// @p_Packet : Sent packet
+void ScriptMgr::OnPacketSend(WorldSocket* p_Socket, WorldPacket const& p_Packet)
 {
     ASSERT(p_Socket);
 
-    FOREACH_SCRIPT(ServerScript)->OnPacketSend(p_Socket, p_Packet);
+    ScriptHooks::OnPacketSend.Dispatch([&](ServerScript* p_Script) { p_Script->OnPacketSend(p_Socket, p_Packet); });
 }
 
 /// Called when an invalid (unknown opcode) packet is received by a client. The packet is a reference to the original packet; not a copy.
 /// This allows you to actually handle unknown packets (for whatever purpose).
 /// @p_Socket : Socket who received the packet
 /// @p_Packet : Received packet
-void ScriptMgr::OnUnknownPacketReceive(WorldSocket* p_Socket, WorldPacket p_Packet)
+void ScriptMgr::OnUnknownPacketReceive(WorldSocket* p_Socket, WorldPacket const& p_Packet)
 {
     ASSERT(p_Socket);
 
-    FOREACH_SCRIPT(ServerScript)->OnUnknownPacketReceive(p_Socket, p_Packet);
-
+    ScriptHooks::OnUnknownPacketReceive.Dispatch([&](ServerScript* p_Script) { p_Script->OnUnknownPacketReceive(p_Socket, p_Packet); });
 }
 
 //////////////////////////////////////////////////////////////////////////
@@ -1478,7 +1606,7 @@ void ScriptMgr::OnShutdownCancel()
 /// @p_Diff : Time since last update
 void ScriptMgr::OnWorldUpdate(uint32 p_Diff)
 {
-    FOREACH_SCRIPT(WorldScript)->OnUpdate(p_Diff);
+    ScriptHooks::OnWorldUpdate.Dispatch([&](WorldScript* p_Script) { p_Script->OnUpdate(p_Diff); });
 }
 
 /// Called when the world is started.
@@ -1746,7 +1874,7 @@ void ScriptMgr::OnPlayerKilledByCreature(Creature* p_Killer, Player* p_Killed)
 /// @p_After : If it's after modification
 void ScriptMgr::OnModifyPower(Player* p_Player, Powers p_Power, int32 p_OldValue, int32& p_NewValue, bool p_Regen, bool p_After)
 {
-    FOREACH_SCRIPT(PlayerScript)->OnModifyPower(p_Player, p_Power, p_OldValue, p_NewValue, p_Regen, p_After);
+    ScriptHooks::OnModifyPower.Dispatch([&](PlayerScript* p_Script) { p_Script->OnModifyPower(p_Player, p_Power, p_OldValue, p_NewValue, p_Regen, p_After); });
 }
 
 /// Called when the player switch from indoors to outdoors or from outdoors to indoors
@@ -1770,7 +1898,7 @@ void ScriptMgr::OnModifySpec(Player* p_Player, int32 p_NewSpec)
 /// @p_Value  : New value
 void ScriptMgr::OnModifyHealth(Player* p_Player, int32 p_Value)
 {
-    FOREACH_SCRIPT(PlayerScript)->OnModifyHealth(p_Player, p_Value);
+    ScriptHooks::OnModifyHealth.Dispatch([&](PlayerScript* p_Script) { p_Script->OnModifyHealth(p_Player, p_Value); });
 }
 
 /// Called when a player's level changes (right before the level is applied)
@@ -1794,7 +1922,7 @@ void ScriptMgr::OnPlayerTalentsReset(Player* p_Player, bool p_NoCost)
 /// @p_Amount : Modified money amount
 void ScriptMgr::OnPlayerMoneyChanged(Player* p_Player, int64 & p_Amount)
 {
-    FOREACH_SCRIPT(PlayerScript)->OnMoneyChanged(p_Player, p_Amount);
+    ScriptHooks::OnMoneyChanged.Dispatch([&](PlayerScript* p_Script) { p_Script->OnMoneyChanged(p_Player, p_Amount); });
 }
 
 /// Called when a player gains XP (before anything is given)
@@ -1931,7 +2059,7 @@ void ScriptMgr::OnPlayerTextEmote(Player* p_Player, uint32 p_TextEmote, uint32 p
 /// @p_SkipCheck : Skipped checks
 void ScriptMgr::OnPlayerSpellCast(Player* p_Player, Spell* p_Spell, bool p_SkipCheck)
 {
-    FOREACH_SCRIPT(PlayerScript)->OnSpellCast(p_Player, p_Spell, p_SkipCheck);
+    ScriptHooks::OnSpellCast.Dispatch([&](PlayerScript* p_Script) { p_Script->OnSpellCast(p_Player, p_Spell, p_SkipCheck); });
 }
 
 /// When the player learn a spell
@@ -1975,7 +2103,7 @@ void ScriptMgr::OnPlayerDelete(uint64 p_GUID)
 /// @p_Diff : diff time
 void ScriptMgr::OnPlayerUpdate(Player* p_Player, uint32 p_Diff)
 {
-    FOREACH_SCRIPT(PlayerScript)->OnUpdate(p_Player, p_Diff);
+    ScriptHooks::OnPlayerUpdate.Dispatch([&](PlayerScript* p_Script) { p_Script->OnUpdate(p_Player, p_Diff); });
 }
 
 /// Called when a player is bound to an instance
@@ -2002,7 +2130,7 @@ void ScriptMgr::OnPlayerUpdateZone(Player* p_Player, uint32 p_NewZoneID, uint32
 /// @p_Player : Player instance
 void ScriptMgr::OnPlayerUpdateMovement(Player* p_Player)
 {
-    FOREACH_SCRIPT(PlayerScript)->OnUpdateMovement(p_Player);
+    ScriptHooks::OnUpdateMovement.Dispatch([&](PlayerScript* p_Script) { p_Script->OnUpdateMovement(p_Player); });
 }
 
 /// Called when a spline step is done
@@ -2153,7 +2281,7 @@ void ScriptMgr::OnFinishMovement(Player* p_Player, uint32 p_SpellID, uint64 cons
 /// @p_PreventDefault : avoid default regeneration
 void ScriptMgr::OnPlayerRegenPower(Player* p_Player, Powers const p_Power, float& p_AddValue, bool& p_PreventDefault)
 {
-    FOREACH_SCRIPT(PlayerScript)->OnRegenPower(p_Player, p_Power, p_AddValue, p_PreventDefault);
+    ScriptHooks::OnRegenPower.Dispatch([&](PlayerScript* p_Script) { p_Script->OnRegenPower(p_Player, p_Power, p_AddValue, p_PreventDefault); });
 }
 
 /// Called when a player take damage
@@ -2162,7 +2290,7 @@ void ScriptMgr::OnPlayerRegenPower(Player* p_Player, Powers const p_Power, float
 /// @p_Damage          : Amount of damage taken
 void ScriptMgr::OnPlayerTakeDamage(Player* p_Player, DamageEffectType p_DamageEffectType, uint32 p_Damage, SpellSchoolMask p_SchoolMask, CleanDamage const* p_CleanDamage)
 {
-    FOREACH_SCRIPT(PlayerScript)->OnTakeDamage(p_Player, p_DamageEffectType, p_Damage, p_SchoolMask, p_CleanDamage);
+    ScriptHooks::OnTakeDamage.Dispatch([&](PlayerScript* p_Script) { p_Script->OnTakeDamage(p_Player, p_DamageEffectType, p_Damage, p_SchoolMask, p_CleanDamage); });
 }
 
 /// Called when player block attack
@@ -2170,7 +2298,7 @@ void ScriptMgr::OnPlayerTakeDamage(Player* p_Player, DamageEffectType p_DamageEf
 /// @p_DamageInfo  : Damage Infos
 void ScriptMgr::OnPlayerBlock(Player* p_Player, Unit* p_Attacker)
 {
-    FOREACH_SCRIPT(PlayerScript)->OnBlock(p_Player, p_Attacker);
+    ScriptHooks::OnBlock.Dispatch([&](PlayerScript* p_Script) { p_Script->OnBlock(p_Player, p_Attacker); });
 }
 
 /// Called when player earn achievement
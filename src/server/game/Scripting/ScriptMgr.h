@@ -47,6 +47,9 @@ class ScriptMgr
         /// Initialize some spell date for scripted creature
         void FillSpellSummary();
 
+        /// Subscribe the scripts to the hooks dispatched through a ScriptHookList, once all of them are added
+        void BuildScriptHooks();
+
     /// Scheduled scripts
     public:
         /// Increase scheduled script count
@@ -438,21 +441,21 @@ class ScriptMgr
         /// @p_WasNew : Was new ?
         void OnSocketClose(WorldSocket* p_Socket, bool p_WasNew);
 
-        /// Called when a packet is sent to a client. The packet object is a copy of the original packet, so reading and modifying it is safe.
-        /// @p_Socket  : Socket who send the packet
-        /// @p_Packet  : Sent packet
+        /// Called when a (valid) packet is received by a client. The packet is not copied, scripts copy it to read it.
+        /// @p_Socket  : Socket who received the packet
+        /// @p_Packet  : Received packet
         /// @p_Session : Session who receive the packet /!\ CAN BE NULLPTR
-        void OnPacketReceive(WorldSocket* p_Socket, WorldPacket p_Packet, WorldSession* p_Session = nullptr);
+        void OnPacketReceive(WorldSocket* p_Socket, WorldPacket const& p_Packet, WorldSession* p_Session = nullptr);
 
-        /// Called when a (valid) packet is received by a client. The packet object is a copy of the original packet, so reading and modifying it is safe.
-        /// @p_Socket : Socket who received the packet
-        /// @p_Packet : Received packet
-        void OnPacketSend(WorldSocket* p_Socket, WorldPacket p_Packet);
+        /// Called when a packet is sent to a client. The packet is not copied, scripts copy it to read it.
+        /// @p_Socket : Socket who send the packet
+        /// @p_Packet : Sent packet
+        void OnPacketSend(WorldSocket* p_Socket, WorldPacket const& p_Packet);
         /// Called when an invalid (unknown opcode) packet is received by a client. The packet is a reference to the original packet; not a copy.
         /// This allows you to actually handle unknown packets (for whatever purpose).
         /// @p_Socket : Socket who received the packet
         /// @p_Packet : Received packet
-        void OnUnknownPacketReceive(WorldSocket* p_Socket, WorldPacket p_Packet);
+        void OnUnknownPacketReceive(WorldSocket* p_Socket, WorldPacket const& p_Packet);
 
     /// WorldScript
     public:
@@ -16,7 +16,7 @@
 #define INTERREALM_REMOVE_PLAYERS_TIMER 1000
 
 InterRealmClient::InterRealmClient(IRSocket* socket):
-m_isNeedClose(false), m_IRSocket(socket)
+m_isNeedClose(false), m_IRSocket(socket), m_TunnelBatch(IR_SMSG_TUNNEL_BATCH)
 {
     m_realmId = 0;
 
@@ -42,6 +42,8 @@ m_isNeedClose(false), m_IRSocket(socket)
 
     m_remove_players_timer = INTERREALM_REMOVE_PLAYERS_TIMER;
 
+    m_TunnelBatch.LoadConfig();
+
     _isDatabaseOpened = false;
 
     if (socket)
@@ -85,6 +87,15 @@ void InterRealmClient::SendTunneledPacket(uint64 playerGuid, WorldPacket const*
 
     const_cast<WorldPacket*>(packet)->FlushBits();
 
+    if (m_TunnelBatch.IsEnabled())
+    {
+        m_TunnelBatch.Append(playerGuid, *packet, [this](WorldPacket const* p_Batch)
+        {
+            SendPacketDirect(p_Batch);
+        });
+        return;
+    }
+
     WorldPacket tmpPacket(IR_SMSG_TUNNEL_PACKET, 8 + 2 + packet->size());
     tmpPacket << playerGuid;
     tmpPacket << packet->GetOpcode();
@@ -92,6 +103,7 @@ void InterRealmClient::SendTunneledPacket(uint64 playerGuid, WorldPacket const*
     if (packet->size() > 0)
         tmpPacket.append(packet->contents(), packet->size());
 
+    m_TunnelBatch.RecordSentPacket(tmpPacket.size(), tmpPacket.size());
     SendPacket(&tmpPacket);
 }
 
@@ -100,6 +112,22 @@ void InterRealmClient::SendPacket(WorldPacket const* packet)
     if (packet == NULL)
         return;
 
+    /// Tunneled packets queued before this one must reach the realm first
+    FlushTunnelBatch();
+
+    SendPacketDirect(packet);
+}
+
+void InterRealmClient::FlushTunnelBatch()
+{
+    m_TunnelBatch.Flush([this](WorldPacket const* p_Batch)
+    {
+        SendPacketDirect(p_Batch);
+    });
+}
+
+void InterRealmClient::SendPacketDirect(WorldPacket const* packet)
+{
     if (!m_IRSocket || m_IRSocket->IsClosed())
         return;
 
@@ -158,28 +186,63 @@ void InterRealmClient::Handle_TunneledPacket(WorldPacket* recvPacket)
     uint64 playerGuid;
     uint16 opcodeId;
 
+    m_TunnelBatch.RecordReceivedPacket(recvPacket->size());
+
     *recvPacket >> playerGuid;
     *recvPacket >> opcodeId;
 
-    recvPacket->SetTunneled(true);
-    recvPacket->SetOpcode(opcodeId);
+    QueueTunneledPacket(playerGuid, opcodeId, recvPacket);
+}
 
+void InterRealmClient::Handle_TunneledBatch(WorldPacket* recvPacket)
+{
     if (IsNeedClose())
     {
         delete recvPacket;
         return;
     }
 
-    IRPlayers::const_iterator itr = m_Players.find(playerGuid);
-    if (itr == m_Players.end() || itr->second->GetSession()->IsIRClosing() || g_OpcodeTable[WOW_CLIENT_TO_SERVER][opcodeId] == nullptr)
+    bool l_Valid = m_TunnelBatch.Read(*recvPacket, [this](uint64 p_PlayerGuid, uint16 p_Opcode, uint8 const* p_Data, uint32 p_Size)
+    {
+        /// Same layout as IR_CMSG_TUNNEL_PACKET, the session reads after the guid and opcode
+        WorldPacket* l_Packet = new WorldPacket(p_Opcode, 8 + 2 + p_Size);
+        *l_Packet << uint64(p_PlayerGuid);
+        *l_Packet << uint16(p_Opcode);
+
+        if (p_Size)
+            l_Packet->append(p_Data, p_Size);
+
+        l_Packet->read_skip(8 + 2);
+
+        QueueTunneledPacket(p_PlayerGuid, p_Opcode, l_Packet);
+    });
+
+    delete recvPacket;
+
+    if (!l_Valid)
+        sLog->outError(LOG_FILTER_INTERREALM, "InterRealmClient::Handle_TunneledBatch malformed batch received from realm %i, dropped.", m_realmId);
+}
+
+void InterRealmClient::QueueTunneledPacket(uint64 p_PlayerGuid, uint16 p_Opcode, WorldPacket* p_Packet)
+{
+    p_Packet->SetTunneled(true);
+    p_Packet->SetOpcode(p_Opcode);
+
+    if (IsNeedClose())
+    {
+        delete p_Packet;
+        return;
+    }
+
+    IRPlayers::const_iterator itr = m_Players.find(p_PlayerGuid);
+    if (itr == m_Players.end() || itr->second->GetSession()->IsIRClosing() || g_OpcodeTable[WOW_CLIENT_TO_SERVER][p_Opcode] == nullptr)
     {
         sLog->outError(LOG_FILTER_INTERREALM, "no player");
-        delete recvPacket;
-        recvPacket = NULL;
+        delete p_Packet;
         return;
     }
 
-    itr->second->GetSession()->QueuePacket(recvPacket);
+    itr->second->GetSession()->QueuePacket(p_Packet);
 }
 
 void InterRealmClient::Handle_WhoAmI(WorldPacket& packet)
@@ -20,6 +20,7 @@
 #include "Define.h"
 #include "DatabaseEnv.h"
 #include "DatabaseWorkerPool.h"
+#include "InterRealmTunnelBatch.h"
 #include <LockedMap.h>
 
 struct CharacterPortData;
@@ -101,6 +102,7 @@ class InterRealmClient
         void Handle_ServerSide(WorldPacket& recvPacket) { }
         
         void Handle_TunneledPacket(WorldPacket* recvPacket);
+        void Handle_TunneledBatch(WorldPacket* recvPacket);
 
         void Handle_Hello(WorldPacket& recvPacket);
         void Handle_WhoAmI(WorldPacket& packet);
@@ -205,6 +207,10 @@ class InterRealmClient
         
         void SendPacket(WorldPacket const* packet);
         void SendTunneledPacket(uint64 playerGuid, WorldPacket const* packet, bool forced = false);
+        /// Send the tunneled packets batched since the last call
+        void FlushTunnelBatch();
+
+        InterRealmTunnelBatch& GetTunnelBatch() { return m_TunnelBatch; }
 
         void RemovePlayerFromIR(Player *player);
 
@@ -242,6 +248,12 @@ class InterRealmClient
 
         void ProcessWorldSessionPacket(WorldSession* _session, WorldPacket* packet);
 
+        /// Write to the socket without flushing the tunnel batch first
+        void SendPacketDirect(WorldPacket const* packet);
+
+        /// Hand a tunneled client packet to its player session, takes ownership of p_Packet
+        void QueueTunneledPacket(uint64 p_PlayerGuid, uint16 p_Opcode, WorldPacket* p_Packet);
+
         void UpdateDatabaseConnection(const uint32 diff);
 
         void UpdateCheckPlayers(const uint32 diff);
@@ -273,6 +285,9 @@ class InterRealmClient
 
         IRSocket* m_IRSocket;
 
+        /// Tunneled packets coalesced until the next Update
+        InterRealmTunnelBatch m_TunnelBatch;
+
         /// Local realm guids
         ACE_Based::LockedMap<uint32, bool> m_WaitingFoLocalRealmGuid;
 
@@ -145,6 +145,12 @@ void InterRealmMgr::Update(const uint32 diff)
     //Unlock();
 }
 
+void InterRealmMgr::FlushTunnelBatches()
+{
+    for (ClientMap::const_iterator itr = clients.begin(); itr != clients.end(); ++itr)
+        (*itr)->FlushTunnelBatch();
+}
+
 void InterRealmMgr::SendPacketToAll(WorldPacket* packet)
 {
     for (ClientMap::const_iterator itr = clients.begin(); itr != clients.end(); ++itr)
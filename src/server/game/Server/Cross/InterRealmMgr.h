@@ -59,6 +59,8 @@ class InterRealmMgr
         InterRealmClient* GetClientByRealmNumber(uint32 realmNumber);
 
         void Update(const uint32 diff);
+        /// Send the tunneled packets batched by every client during the world update
+        void FlushTunnelBatches();
 
         void SendBGStartAnnouncer(const char* bgName, uint32 min_level, uint32 max_level);
 
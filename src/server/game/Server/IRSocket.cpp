@@ -617,6 +617,9 @@ int IRSocket::ProcessIncoming(WorldPacket* new_pct)
             case IR_SMSG_TUNNEL_PACKET:
                 return Handle_TunneledPacket(new_pct);
                 break;
+            case IR_SMSG_TUNNEL_BATCH:
+                return Handle_TunneledBatch(new_pct);
+                break;
             default:
             {
                 ACE_GUARD_RETURN(LockType, Guard, m_SessionLock, -1);
@@ -644,6 +647,8 @@ int IRSocket::Handle_TunneledPacket(WorldPacket* packet)
     uint64 playerGuid;
     uint16 opcodeId;
 
+    m_InterRealmSession->GetTunnelBatch().RecordReceivedPacket(packet->size());
+
     *packet >> playerGuid;
     *packet >> opcodeId;
 
@@ -663,6 +668,29 @@ int IRSocket::Handle_TunneledPacket(WorldPacket* packet)
 
     return 0;
 }
+
+int IRSocket::Handle_TunneledBatch(WorldPacket* packet)
+{
+    bool l_Valid = m_InterRealmSession->GetTunnelBatch().Read(*packet, [](uint64 p_PlayerGuid, uint16 p_Opcode, uint8 const* p_Data, uint32 p_Size)
+    {
+        Player* l_Player = sObjectAccessor->FindPlayerInOrOutOfWorld(p_PlayerGuid);
+        if (!l_Player || !l_Player->GetSession())
+            return;
+
+        WorldPacket l_Packet((Opcodes)p_Opcode, p_Size);
+        if (p_Size)
+            l_Packet.append(p_Data, p_Size);
+
+        l_Player->GetSession()->SendPacket(&l_Packet, false, true);
+    });
+
+    delete packet;
+
+    if (!l_Valid)
+        sLog->outError(LOG_FILTER_INTERREALM, "IRSocket::Handle_TunneledBatch malformed batch received, dropped.");
+
+    return 0;
+}
 # else
 IRSocket::IRSocket(): IRHandler(),
 m_LastPingTime(ACE_Time_Value::zero),
@@ -1217,6 +1245,9 @@ int IRSocket::ProcessIncoming(WorldPacket* new_pct)
                 //ACE_GUARD_RETURN(LockType, Guard, m_SessionLock, -1);
                 m_InterRealmClient->Handle_TunneledPacket(new_pct);
                 break;
+            case IR_CMSG_TUNNEL_BATCH:
+                m_InterRealmClient->Handle_TunneledBatch(new_pct);
+                break;
             default:
                 //aptr.release();
                 m_InterRealmClient->AddPacket(new_pct);
@@ -118,6 +118,7 @@ class IRSocket : public IRHandler
 
 #ifndef CROSS
         int Handle_TunneledPacket(WorldPacket* new_pct);
+        int Handle_TunneledBatch(WorldPacket* new_pct);
 #else
         int Handle_Ping(WorldPacket* packet);
 #endif
@@ -162,6 +162,9 @@ enum IROpcodes
     IR_SMSG_PLAYER_RECONNECT_RESULT                 = 0x75,
     IR_CMSG_PLAYER_RECONNECT_READY_TO_LOAD          = 0x76,
 
+    IR_CMSG_TUNNEL_BATCH                            = 0x77,
+    IR_SMSG_TUNNEL_BATCH                            = 0x78,
+
     IR_NUM_MSG_TYPES,
 };
 
@@ -124,7 +124,7 @@ class IRReactorRunnable : protected ACE_Task_Base
 };
 
 InterRealmSession::InterRealmSession() : m_rand(0), m_tunnel_open(false),
-m_RecvWPct(0), m_RecvPct()
+m_TunnelBatch(IR_CMSG_TUNNEL_BATCH), m_RecvWPct(0), m_RecvPct()
 {
     m_IsConnected = false;
     m_force_stop = false;
@@ -237,6 +237,7 @@ void InterRealmSession::ProcessPlayersAfterDisconnect()
 void InterRealmSession::ClearSocket()
 {
     m_tunnel_open = false;
+    m_TunnelBatch.Clear();
 
     if (m_IRSocket)
     {
@@ -272,6 +273,8 @@ void InterRealmSession::run()
 
     sLog->outError(LOG_FILTER_INTERREALM, "Loaded InterRealm configuration, %s:%u, id %u", m_IP.c_str(), m_port, m_ir_id);    
 
+    m_TunnelBatch.LoadConfig();
+
     m_Connector = NULL;
 
     ACE_INET_Addr connect_addr (m_port, m_IP.c_str());
@@ -335,6 +338,17 @@ void InterRealmSession::SendTunneledPacket(uint64 playerGuid, WorldPacket const*
         return;
     }
     
+    if (m_TunnelBatch.IsEnabled())
+    {
+        m_TunnelBatch.Append(playerGuid, *packet, [this](WorldPacket const* p_Batch)
+        {
+            SendPacketDirect(p_Batch);
+        });
+
+        delete packet;
+        return;
+    }
+
     WorldPacket tmpPacket(IR_CMSG_TUNNEL_PACKET, 8 + 2 + packet->size());
     tmpPacket << (uint64)playerGuid;
     tmpPacket << (uint16)packet->GetOpcode();
@@ -344,6 +358,7 @@ void InterRealmSession::SendTunneledPacket(uint64 playerGuid, WorldPacket const*
 
     delete packet;
     
+    m_TunnelBatch.RecordSentPacket(tmpPacket.size(), tmpPacket.size());
     SendPacket(&tmpPacket);
 }
 
@@ -373,6 +388,22 @@ void InterRealmSession::SendPacket(WorldPacket const* packet)
     if (packet == NULL)
         return;
 
+    /// Tunneled packets queued before this one must reach the cross first
+    FlushTunnelBatch();
+
+    SendPacketDirect(packet);
+}
+
+void InterRealmSession::FlushTunnelBatch()
+{
+    m_TunnelBatch.Flush([this](WorldPacket const* p_Batch)
+    {
+        SendPacketDirect(p_Batch);
+    });
+}
+
+void InterRealmSession::SendPacketDirect(WorldPacket const* packet)
+{
     if (packet->GetOpcode() != IR_CMSG_WHO_AM_I && 
         packet->GetOpcode() != IR_CMSG_HELLO && !IsConnected())
         return;
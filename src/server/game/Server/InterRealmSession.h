@@ -29,6 +29,7 @@
 #include <ace/SOCK_Connector.h>
 
 #include "IRSocketConnector.h"
+#include "InterRealmTunnelBatch.h"
 
 #include "SharedDefines.h"
 
@@ -114,6 +115,8 @@ class InterRealmSession: public ACE_Based::Runnable
         void SendTunneledPacket(uint64 guid, WorldPacket const* packet);
         void SendTunneledPacketToClient(uint64 guid, WorldPacket const *packet);
         void SendPacket(WorldPacket const* packet);
+        /// Send the tunneled packets batched since the last call
+        void FlushTunnelBatch();
         void SendPSysMessage(Player *player, char const *format, ...);
         void SendServerAnnounce(uint64 guid, std::string const &text);
         void SendPlayerTeleport(Player *player, uint32 zoneId, Player *target, bool isSpectator = false);
@@ -207,9 +210,14 @@ class InterRealmSession: public ACE_Based::Runnable
 
         void ClearSocket();
 
+        InterRealmTunnelBatch& GetTunnelBatch() { return m_TunnelBatch; }
+
     private:
         void BuildPlayerArenaInfoBlock(Player* player, ByteBuffer& packet);
 
+        /// Write to the socket without flushing the tunnel batch first
+        void SendPacketDirect(WorldPacket const* packet);
+
         bool m_needProcessDisconnect;
 
         IRReactorRunnable* m_Reactor;
@@ -231,6 +239,9 @@ class InterRealmSession: public ACE_Based::Runnable
 
         ACE_Based::LockedQueue<WorldPacket*, ACE_Thread_Mutex> _queue; 
 
+        /// Tunneled packets coalesced until the next Update
+        InterRealmTunnelBatch m_TunnelBatch;
+
         /// here are stored the fragments of the received data
         WorldPacket* m_RecvWPct;
 
@@ -0,0 +1,133 @@
+////////////////////////////////////////////////////////////////////////////////
+//
+//  MILLENIUM-STUDIO
+//  Copyright 2016 Millenium-studio SARL
+//  All Rights Reserved.
+//
+////////////////////////////////////////////////////////////////////////////////
+
+#include "InterRealmTunnelBatch.h"
+#include "Config.h"
+#include "Log.h"
+
+#include <zlib.h>
+
+InterRealmTunnelBatch::InterRealmTunnelBatch(uint16 p_Opcode) :
+    m_Pending(p_Opcode, 0), m_Compressed(p_Opcode, 0), m_PendingCount(0),
+    m_Enabled(false), m_MaxSize(0), m_CompressionLevel(0), m_CompressionThreshold(0)
+{
+}
+
+void InterRealmTunnelBatch::LoadConfig()
+{
+    std::lock_guard<std::mutex> l_Guard(m_Lock);
+
+    m_Enabled              = ConfigMgr::GetBoolDefault("InterRealm.Tunnel.Batch", false);
+    m_MaxSize              = std::max(1024, ConfigMgr::GetIntDefault("InterRealm.Tunnel.BatchMaxSize", 32 * 1024));
+    m_CompressionLevel     = std::min(9, ConfigMgr::GetIntDefault("InterRealm.Tunnel.CompressionLevel", 1));
+    m_CompressionThreshold = std::max(0, ConfigMgr::GetIntDefault("InterRealm.Tunnel.CompressionThreshold", 512));
+
+    m_Pending.reserve(m_MaxSize + IR_TUNNEL_BATCH_HEADER_SIZE);
+}
+
+void InterRealmTunnelBatch::RecordSentPacket(uint32 p_RawSize, uint32 p_WireSize)
+{
+    m_Stats.SentPackets++;
+    m_Stats.SentRawBytes += p_RawSize;
+    m_Stats.SentWireBytes += p_WireSize;
+}
+
+void InterRealmTunnelBatch::RecordReceivedPacket(uint32 p_WireSize)
+{
+    m_Stats.ReceivedPackets++;
+    m_Stats.ReceivedWireBytes += p_WireSize;
+}
+
+void InterRealmTunnelBatch::Clear()
+{
+    std::lock_guard<std::mutex> l_Guard(m_Lock);
+    ResetLocked();
+}
+
+bool InterRealmTunnelBatch::AppendLocked(uint64 p_Guid, WorldPacket const& p_Packet)
+{
+    /// Room for the batch header, written once the batch is built
+    if (!m_PendingCount)
+        m_Pending.resize(IR_TUNNEL_BATCH_HEADER_SIZE);
+
+    m_Pending << uint64(p_Guid);
+    m_Pending << uint16(p_Packet.GetOpcode());
+    m_Pending << uint32(p_Packet.size());
+
+    if (p_Packet.size() > 0)
+        m_Pending.append(p_Packet.contents(), p_Packet.size());
+
+    ++m_PendingCount;
+
+    return m_Pending.size() >= m_MaxSize;
+}
+
+WorldPacket const* InterRealmTunnelBatch::BuildLocked()
+{
+    if (!m_PendingCount)
+        return nullptr;
+
+    uint32 l_RawSize = uint32(m_Pending.size() - IR_TUNNEL_BATCH_HEADER_SIZE);
+    uint8 l_Flags = 0;
+    WorldPacket* l_Batch = &m_Pending;
+
+    if (m_CompressionLevel > 0 && l_RawSize >= m_CompressionThreshold)
+    {
+        uLongf l_DestSize = compressBound(l_RawSize);
+        m_Compressed.resize(IR_TUNNEL_BATCH_HEADER_SIZE + l_DestSize);
+
+        uint8* l_Dest = const_cast<uint8*>(m_Compressed.contents()) + IR_TUNNEL_BATCH_HEADER_SIZE;
+        int l_Result = compress2(l_Dest, &l_DestSize, m_Pending.contents() + IR_TUNNEL_BATCH_HEADER_SIZE, l_RawSize, m_CompressionLevel);
+
+        /// Keep the plain batch when deflate does not pay off
+        if (l_Result == Z_OK && l_DestSize < l_RawSize)
+        {
+            m_Compressed.resize(IR_TUNNEL_BATCH_HEADER_SIZE + l_DestSize);
+            l_Batch = &m_Compressed;
+            l_Flags |= IR_TUNNEL_BATCH_FLAG_COMPRESSED;
+            m_Stats.SentCompressedBatches++;
+        }
+        else if (l_Result != Z_OK)
+            sLog->outError(LOG_FILTER_INTERREALM, "InterRealmTunnelBatch: cannot compress %u bytes (zlib error %i), sending them uncompressed.", l_RawSize, l_Result);
+    }
+
+    l_Batch->put<uint8>(0, l_Flags);
+    l_Batch->put<uint32>(1, m_PendingCount);
+    l_Batch->put<uint32>(5, l_RawSize);
+
+    m_Stats.SentPackets += m_PendingCount;
+    m_Stats.SentBatches++;
+    m_Stats.SentRawBytes += l_RawSize;
+    m_Stats.SentWireBytes += l_Batch->size();
+
+    return l_Batch;
+}
+
+void InterRealmTunnelBatch::ResetLocked()
+{
+    m_Pending.clear();
+    m_PendingCount = 0;
+}
+
+bool InterRealmTunnelBatch::Inflate(WorldPacket const& p_Batch, uint32 p_RawSize, ByteBuffer& p_Out)
+{
+    if (!p_RawSize || p_RawSize > IR_TUNNEL_BATCH_MAX_RAW_SIZE || p_Batch.size() < IR_TUNNEL_BATCH_HEADER_SIZE)
+        return false;
+
+    p_Out.resize(p_RawSize);
+
+    uLongf l_DestSize = p_RawSize;
+    int l_Result = uncompress(const_cast<uint8*>(p_Out.contents()), &l_DestSize, p_Batch.contents() + IR_TUNNEL_BATCH_HEADER_SIZE, p_Batch.size() - IR_TUNNEL_BATCH_HEADER_SIZE);
+    if (l_Result != Z_OK || l_DestSize != p_RawSize)
+    {
+        sLog->outError(LOG_FILTER_INTERREALM, "InterRealmTunnelBatch: cannot inflate a batch of %u bytes (zlib error %i).", p_RawSize, l_Result);
+        return false;
+    }
+
+    return true;
+}
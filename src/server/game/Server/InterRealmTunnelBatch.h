@@ -0,0 +1,163 @@
+////////////////////////////////////////////////////////////////////////////////
+//
+//  MILLENIUM-STUDIO
+//  Copyright 2016 Millenium-studio SARL
+//  All Rights Reserved.
+//
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef INTERREALM_TUNNEL_BATCH_H
+#define INTERREALM_TUNNEL_BATCH_H
+
+#include "WorldPacket.h"
+
+#include <atomic>
+#include <mutex>
+
+enum InterRealmTunnelBatchFlags
+{
+    IR_TUNNEL_BATCH_FLAG_COMPRESSED = 0x01
+};
+
+/// Batch body : uint8 flags, uint32 packet count, uint32 entries size, then the entries (zlib deflated when compressed)
+/// Entry      : uint64 player guid, uint16 opcode, uint32 payload size, payload
+#define IR_TUNNEL_BATCH_HEADER_SIZE         (1 + 4 + 4)
+#define IR_TUNNEL_BATCH_ENTRY_HEADER_SIZE   (8 + 2 + 4)
+/// Refuse to inflate anything bigger, a batch is flushed at InterRealm.Tunnel.BatchMaxSize anyway
+#define IR_TUNNEL_BATCH_MAX_RAW_SIZE        (16 * 1024 * 1024)
+
+/// Tunnel counters of an InterRealm endpoint, written by the network and map threads
+struct InterRealmTunnelStats
+{
+    InterRealmTunnelStats() : SentPackets(0), SentBatches(0), SentCompressedBatches(0), SentRawBytes(0), SentWireBytes(0),
+        ReceivedPackets(0), ReceivedBatches(0), ReceivedWireBytes(0) { }
+
+    std::atomic<uint64> SentPackets;
+    std::atomic<uint64> SentBatches;
+    std::atomic<uint64> SentCompressedBatches;
+    std::atomic<uint64> SentRawBytes;           ///< Tunneled packets with their guid/opcode header, before compression
+    std::atomic<uint64> SentWireBytes;          ///< What was actually handed to the socket for them
+    std::atomic<uint64> ReceivedPackets;
+    std::atomic<uint64> ReceivedBatches;
+    std::atomic<uint64> ReceivedWireBytes;
+};
+
+/// Coalesces the tunneled packets of one InterRealm connection into framed batches.
+///
+/// Packets are appended straight into the pending batch (a single copy of the payload) and sent
+/// as one IR packet at the end of each world tick, when the batch reaches InterRealm.Tunnel.BatchMaxSize, or
+/// before any other IR packet so the tunnel keeps its ordering with the control opcodes.
+class InterRealmTunnelBatch
+{
+    public:
+        explicit InterRealmTunnelBatch(uint16 p_Opcode);
+
+        /// Read the InterRealm.Tunnel.* settings
+        void LoadConfig();
+
+        bool IsEnabled() const { return m_Enabled; }
+
+        InterRealmTunnelStats& GetStats() { return m_Stats; }
+        InterRealmTunnelStats const& GetStats() const { return m_Stats; }
+
+        /// Account a tunneled packet sent on its own (batching disabled)
+        void RecordSentPacket(uint32 p_RawSize, uint32 p_WireSize);
+        /// Account a tunneled packet received on its own
+        void RecordReceivedPacket(uint32 p_WireSize);
+
+        /// Queue a tunneled packet, p_Send(WorldPacket const*) is called if the batch has to be flushed
+        template<class Sender> void Append(uint64 p_Guid, WorldPacket const& p_Packet, Sender p_Send)
+        {
+            std::lock_guard<std::mutex> l_Guard(m_Lock);
+
+            if (AppendLocked(p_Guid, p_Packet))
+                FlushLocked(p_Send);
+        }
+
+        /// Send the pending packets as one batch through p_Send(WorldPacket const*)
+        template<class Sender> void Flush(Sender p_Send)
+        {
+            std::lock_guard<std::mutex> l_Guard(m_Lock);
+            FlushLocked(p_Send);
+        }
+
+        /// Drop the pending packets, used when the connection is lost
+        void Clear();
+
+        /// Call p_Handler(uint64 guid, uint16 opcode, uint8 const* payload, uint32 size) for each packet of a received batch.
+        /// The payload points into the batch (or its inflated copy) and is only valid during the call.
+        template<class Handler> bool Read(WorldPacket& p_Batch, Handler p_Handler)
+        {
+            ByteBuffer l_Inflated;
+            ByteBuffer* l_Entries = &p_Batch;
+
+            uint8 l_Flags;
+            uint32 l_Count;
+            uint32 l_RawSize;
+            p_Batch >> l_Flags;
+            p_Batch >> l_Count;
+            p_Batch >> l_RawSize;
+
+            m_Stats.ReceivedBatches++;
+            m_Stats.ReceivedWireBytes += p_Batch.size();
+
+            if (l_Flags & IR_TUNNEL_BATCH_FLAG_COMPRESSED)
+            {
+                if (!Inflate(p_Batch, l_RawSize, l_Inflated))
+                    return false;
+
+                l_Entries = &l_Inflated;
+            }
+
+            for (uint32 l_I = 0; l_I < l_Count; ++l_I)
+            {
+                uint64 l_Guid;
+                uint16 l_Opcode;
+                uint32 l_Size;
+                *l_Entries >> l_Guid;
+                *l_Entries >> l_Opcode;
+                *l_Entries >> l_Size;
+
+                if (l_Entries->rpos() + l_Size > l_Entries->size())
+                    return false;
+
+                p_Handler(l_Guid, l_Opcode, l_Size ? l_Entries->contents() + l_Entries->rpos() : nullptr, l_Size);
+                l_Entries->read_skip(l_Size);
+            }
+
+            m_Stats.ReceivedPackets += l_Count;
+            p_Batch.rfinish();
+            return true;
+        }
+
+    private:
+        /// Returns true once the batch should be flushed
+        bool AppendLocked(uint64 p_Guid, WorldPacket const& p_Packet);
+        /// Finalize the pending batch, compressed if worth it, nullptr if there is nothing to send
+        WorldPacket const* BuildLocked();
+        void ResetLocked();
+
+        template<class Sender> void FlushLocked(Sender p_Send)
+        {
+            if (WorldPacket const* l_Batch = BuildLocked())
+                p_Send(l_Batch);
+
+            ResetLocked();
+        }
+
+        static bool Inflate(WorldPacket const& p_Batch, uint32 p_RawSize, ByteBuffer& p_Out);
+
+        std::mutex m_Lock;
+        WorldPacket m_Pending;
+        WorldPacket m_Compressed;
+        uint32 m_PendingCount;
+
+        bool m_Enabled;
+        uint32 m_MaxSize;
+        int32 m_CompressionLevel;
+        uint32 m_CompressionThreshold;
+
+        InterRealmTunnelStats m_Stats;
+};
+
+#endif
@@ -8,6 +8,8 @@
 
 #include "Opcodes.h"
 #include "WorldSession.h"
+#include "Config.h"
+#include "Util.h"
 
 OpcodeHandler* g_OpcodeTable[TRANSFER_DIRECTION_MAX][NUM_OPCODE_HANDLERS] = { };
 
@@ -1101,7 +1103,7 @@ void InitOpcodes()
     /// Character
     //////////////////////////////////////////////////////////////////////////
 #ifndef CROSS
-    DEFINE_OPCODE_HANDLER(CMSG_ENUM_CHARACTERS,                                 STATUS_AUTHED,      PROCESS_THREADUNSAFE,   &WorldSession::HandleCharEnumOpcode             , PROCESS_LOCAL);
+    DEFINE_OPCODE_HANDLER(CMSG_ENUM_CHARACTERS,                                 STATUS_AUTHED,      PROCESS_THREADSAFE_SESSION, &WorldSession::HandleCharEnumOpcode             , PROCESS_LOCAL);
     DEFINE_OPCODE_HANDLER(CMSG_CREATE_CHARACTER,                                STATUS_AUTHED,      PROCESS_THREADUNSAFE,   &WorldSession::HandleCharCreateOpcode           , PROCESS_LOCAL);
     DEFINE_OPCODE_HANDLER(CMSG_GENERATE_RANDOM_CHARACTER_NAME,                  STATUS_AUTHED,      PROCESS_THREADUNSAFE,   &WorldSession::HandleRandomizeCharNameOpcode    , PROCESS_LOCAL);
     DEFINE_OPCODE_HANDLER(CMSG_CHAR_DELETE,                                     STATUS_AUTHED,      PROCESS_THREADUNSAFE,   &WorldSession::HandleCharDeleteOpcode           , PROCESS_LOCAL);
@@ -1112,8 +1114,8 @@ void InitOpcodes()
 #endif
 
     DEFINE_OPCODE_HANDLER(CMSG_LOAD_SCREEN,                                     STATUS_AUTHED,      PROCESS_THREADUNSAFE,   &WorldSession::HandleLoadScreenOpcode           , PROCESS_DISTANT_IF_NEED);
-    DEFINE_OPCODE_HANDLER(CMSG_REQUEST_ACCOUNT_DATA,                            STATUS_AUTHED,      PROCESS_THREADUNSAFE,   &WorldSession::HandleRequestAccountData         , PROCESS_DISTANT_IF_NEED);
-    DEFINE_OPCODE_HANDLER(CMSG_UPDATE_ACCOUNT_DATA,                             STATUS_AUTHED,      PROCESS_THREADUNSAFE,   &WorldSession::HandleUpdateAccountData          , PROCESS_DISTANT_IF_NEED);
+    DEFINE_OPCODE_HANDLER(CMSG_REQUEST_ACCOUNT_DATA,                            STATUS_AUTHED,      PROCESS_THREADSAFE_SESSION, &WorldSession::HandleRequestAccountData         , PROCESS_DISTANT_IF_NEED);
+    DEFINE_OPCODE_HANDLER(CMSG_UPDATE_ACCOUNT_DATA,                             STATUS_AUTHED,      PROCESS_THREADSAFE_SESSION, &WorldSession::HandleUpdateAccountData          , PROCESS_DISTANT_IF_NEED);
     DEFINE_OPCODE_HANDLER(CMSG_SET_DUNGEON_DIFFICULTY,                          STATUS_LOGGEDIN,    PROCESS_THREADUNSAFE,   &WorldSession::HandleSetDungeonDifficultyOpcode , PROCESS_DISTANT_IF_NEED);
     DEFINE_OPCODE_HANDLER(CMSG_SET_RAID_DIFFICULTY,                             STATUS_LOGGEDIN,    PROCESS_THREADUNSAFE,   &WorldSession::HandleSetRaidDifficultyOpcode    , PROCESS_DISTANT_IF_NEED);
     DEFINE_OPCODE_HANDLER(CMSG_SHOWING_CLOAK,                                   STATUS_LOGGEDIN,    PROCESS_THREADUNSAFE,   &WorldSession::HandleShowingCloakOpcode         , PROCESS_DISTANT_IF_NEED);
@@ -1360,7 +1362,7 @@ void InitOpcodes()
     //////////////////////////////////////////////////////////////////////////
     /// Account data
     //////////////////////////////////////////////////////////////////////////
-    DEFINE_OPCODE_HANDLER(CMSG_GET_UNDELETE_CHARACTER_COOLDOWN_STATUS,          STATUS_AUTHED,      PROCESS_THREADUNSAFE,   &WorldSession::HandleUndeleteCharacter          , PROCESS_LOCAL);
+    DEFINE_OPCODE_HANDLER(CMSG_GET_UNDELETE_CHARACTER_COOLDOWN_STATUS,          STATUS_AUTHED,      PROCESS_THREADSAFE_SESSION, &WorldSession::HandleUndeleteCharacter          , PROCESS_LOCAL);
 
     //////////////////////////////////////////////////////////////////////////
     /// Chat
@@ -2235,3 +2237,43 @@ void InitOpcodes()
 
 #undef DEFINE_OPCODE_HANDLER
 };
+
+/// Per session update limits of the client opcodes, from Session.OpcodeLimits ("CMSG_NAME:count CMSG_NAME:count ...")
+void LoadOpcodeLimits()
+{
+    for (uint32 l_Opcode = 0; l_Opcode < NUM_OPCODE_HANDLERS; ++l_Opcode)
+    {
+        if (OpcodeHandler* l_Handler = g_OpcodeTable[WOW_CLIENT_TO_SERVER][l_Opcode])
+            l_Handler->MaxPerUpdate = 0;
+    }
+
+    Tokenizer l_Entries(ConfigMgr::GetStringDefault("Session.OpcodeLimits", ""), ' ');
+    for (char const* l_Entry : l_Entries)
+    {
+        std::string l_Limit(l_Entry);
+
+        std::size_t l_Separator = l_Limit.find(':');
+        if (l_Separator == std::string::npos)
+        {
+            sLog->outError(LOG_FILTER_SERVER_LOADING, "Session.OpcodeLimits: %s is not OPCODE_NAME:count, skipped", l_Entry);
+            continue;
+        }
+
+        std::string l_Name = l_Limit.substr(0, l_Separator);
+        uint32 l_MaxPerUpdate = std::max(atoi(l_Limit.c_str() + l_Separator + 1), 0);
+
+        bool l_Found = false;
+        for (uint32 l_Opcode = 0; l_Opcode < NUM_OPCODE_HANDLERS && !l_Found; ++l_Opcode)
+        {
+            OpcodeHandler* l_Handler = g_OpcodeTable[WOW_CLIENT_TO_SERVER][l_Opcode];
+            if (l_Handler && l_Name == l_Handler->name)
+            {
+                l_Handler->MaxPerUpdate = l_MaxPerUpdate;
+                l_Found = true;
+            }
+        }
+
+        if (!l_Found)
+            sLog->outError(LOG_FILTER_SERVER_LOADING, "Session.OpcodeLimits: unknown client opcode %s, skipped", l_Name.c_str());
+    }
+}
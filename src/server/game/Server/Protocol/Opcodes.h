@@ -15,6 +15,8 @@
 
 #include "Common.h"
 
+#include <atomic>
+
 enum OpcodeTransferDirection : uint8
 {
     WOW_SERVER_TO_CLIENT = 0,
@@ -1990,7 +1992,9 @@ enum PacketProcessing
 {
     PROCESS_INPLACE = 0,                                        // process packet whenever we receive it - mostly for non-handled or non-implemented packets
     PROCESS_THREADUNSAFE,                                       // packet is not thread-safe - process it in World::UpdateSessions()
-    PROCESS_THREADSAFE                                          // packet is thread-safe - process it in Map::Update()
+    PROCESS_THREADSAFE,                                         // packet is thread-safe - process it in Map::Update()
+    PROCESS_THREADSAFE_SESSION,                                 // handler only uses its session and async queries - thread-safe, also processed by the session workers when not on a map
+    MAX_PACKET_PROCESSING
 };
 
 enum IRPacketProcessing
@@ -2005,21 +2009,56 @@ class WorldSession;
 
 typedef void(WorldSession::*g_OpcodeHandlerType)(WorldPacket& recvPacket);
 
+/// Handler cost of a client opcode, summed over all the sessions of the realm, see .debug stats opcodes.
+/// Updated by the map threads, so relaxed atomics: a reader may see the fields of two different packets.
+struct OpcodeStats
+{
+    OpcodeStats() : Count(0), TotalTime(0), MaxTime(0), Bytes(0) {}
+
+    void Add(uint32 p_Time, uint32 p_Bytes)
+    {
+        Count.fetch_add(1, std::memory_order_relaxed);
+        TotalTime.fetch_add(p_Time, std::memory_order_relaxed);
+        Bytes.fetch_add(p_Bytes, std::memory_order_relaxed);
+
+        uint32 l_MaxTime = MaxTime.load(std::memory_order_relaxed);
+        while (p_Time > l_MaxTime && !MaxTime.compare_exchange_weak(l_MaxTime, p_Time, std::memory_order_relaxed))
+            ;
+    }
+
+    /// Average handler time in microseconds, the expected cost of the next packet
+    uint32 GetAverageTime() const
+    {
+        uint64 l_Count = Count.load(std::memory_order_relaxed);
+        return l_Count ? uint32(TotalTime.load(std::memory_order_relaxed) / l_Count) : 0;
+    }
+
+    std::atomic<uint64> Count;
+    std::atomic<uint64> TotalTime;                          ///< In microseconds
+    std::atomic<uint32> MaxTime;                            ///< In microseconds
+    std::atomic<uint64> Bytes;
+};
+
 struct OpcodeHandler
 {
-    OpcodeHandler() {}
+    OpcodeHandler() : MaxPerUpdate(0) {}
     OpcodeHandler(char const* _name, SessionStatus _status, PacketProcessing _processing, g_OpcodeHandlerType _handler, IRPacketProcessing _forwardToIR)
-        : name(_name), status(_status), packetProcessing(_processing), handler(_handler), forwardToIR(_forwardToIR) {}
+        : name(_name), status(_status), packetProcessing(_processing), handler(_handler), forwardToIR(_forwardToIR), MaxPerUpdate(0) {}
 
     char const* name;
     SessionStatus status;
     PacketProcessing packetProcessing;
     g_OpcodeHandlerType handler;
 	IRPacketProcessing forwardToIR;
+
+    OpcodeStats Stats;
+    uint32 MaxPerUpdate;                                    ///< Packets handled per session update, from Session.OpcodeLimits, 0 for no limit
 };
 
 extern OpcodeHandler* g_OpcodeTable[TRANSFER_DIRECTION_MAX][NUM_OPCODE_HANDLERS];
 void InitOpcodes();
+/// Per session update limits of the client opcodes, from Session.OpcodeLimits
+void LoadOpcodeLimits();
 
 // Lookup opcode name for human understandable logging
 inline std::string GetOpcodeNameForLogging(uint16 id, int p_Direction)
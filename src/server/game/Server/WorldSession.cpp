@@ -46,6 +46,8 @@
 #include "PetBattle.h"
 #include "Chat.h"
 
+#include <chrono>
+
 bool MapSessionFilter::Process(WorldPacket* packet)
 {
     uint16 opcode = DropHighBytes(packet->GetOpcode());
@@ -97,6 +99,15 @@ bool WorldSessionFilter::Process(WorldPacket* packet)
     return (player->IsInWorld() == false);
 }
 
+bool SessionWorkerFilter::Process(WorldPacket* packet)
+{
+    OpcodeHandler const* opHandle = g_OpcodeTable[WOW_CLIENT_TO_SERVER][DropHighBytes(packet->GetOpcode())];
+    if (!opHandle)
+        return false;
+
+    return opHandle->packetProcessing == PROCESS_THREADSAFE_SESSION && opHandle->status == STATUS_AUTHED;
+}
+
 /// WorldSession constructor
 #ifndef CROSS
 WorldSession::WorldSession(uint32 id, WorldSocket* sock, AccountTypes sec, bool ispremium, uint8 premiumType, uint8 expansion, time_t mute_time, LocaleConstant locale, uint32 recruiter, bool isARecruiter, uint32 p_VoteRemainingTime, uint32 p_ServiceFlags, uint32 p_CustomFlags)
@@ -167,6 +178,8 @@ WorldSession::WorldSession(uint32 id, InterRealmClient* irc, AccountTypes sec, b
     m_AlreadyPurchasePoints = false;
 
     m_IsStressTestSession   = false;
+    m_HandledPacketCount    = 0;
+    m_HandlerTime           = 0;
     m_playerRecentlyLogout  = false;
     m_playerSave            = false;
     m_TutorialsChanged      = false;
@@ -382,12 +395,71 @@ void WorldSession::LogUnprocessedTail(WorldPacket* packet)
     packet->print_storage();
 }
 
-struct OpcodeInfo
+/// Account a handled packet to its opcode, for the session and the realm
+void WorldSession::RecordHandledPacket(OpcodeHandler* p_Handler, uint16 p_Opcode, uint32 p_Time, uint32 p_Bytes)
+{
+    ++m_HandledPacketCount;
+    m_HandlerTime += p_Time;
+
+    if (p_Handler)
+        p_Handler->Stats.Add(p_Time, p_Bytes);
+
+    for (UpdateOpcodeCount& l_Count : m_UpdateOpcodes)
+    {
+        if (l_Count.Opcode == p_Opcode)
+        {
+            ++l_Count.Count;
+            l_Count.Time += p_Time;
+            return;
+        }
+    }
+
+    UpdateOpcodeCount l_Count;
+    l_Count.Opcode = p_Opcode;
+    l_Count.Count  = 1;
+    l_Count.Time   = p_Time;
+    m_UpdateOpcodes.push_back(l_Count);
+}
+
+WorldSession::UpdateOpcodeCount const* WorldSession::GetUpdateOpcodeCount(uint16 p_Opcode) const
 {
-    OpcodeInfo(uint32 nb, uint32 time) : nbPkt(nb), totalTime(time) {}
-    uint32 nbPkt;
-    uint32 totalTime;
-};
+    for (UpdateOpcodeCount const& l_Count : m_UpdateOpcodes)
+    {
+        if (l_Count.Opcode == p_Opcode)
+            return &l_Count;
+    }
+
+    return nullptr;
+}
+
+/// True once the current Update call used its packet cap or time budget, or the limit of the opcode of the next packet.
+/// The loop then stops, so the next packets keep their order and are handled on the next Update call.
+bool WorldSession::ShouldDeferNextPacket(uint32 p_ProcessedPackets, uint32 p_UsedTime)
+{
+    if (p_ProcessedPackets >= sWorld->getIntConfig(CONFIG_SESSION_MAX_PACKETS_PER_UPDATE))
+        return true;
+
+    /// The queue is only popped by the thread updating the session, the front packet stays the same until then
+    uint16 l_Opcode = _recvQueue.peek(true)->GetOpcode();
+
+    OpcodeHandler const* l_Handler = g_OpcodeTable[WOW_CLIENT_TO_SERVER][l_Opcode];
+    if (!l_Handler)
+        return false;
+
+    if (l_Handler->MaxPerUpdate)
+    {
+        UpdateOpcodeCount const* l_Count = GetUpdateOpcodeCount(l_Opcode);
+        if (l_Count && l_Count->Count >= l_Handler->MaxPerUpdate)
+            return true;
+    }
+
+    /// An expensive handler waits for the next update rather than overrunning the budget, one packet is always handled
+    uint32 l_Budget = sWorld->getIntConfig(CONFIG_SESSION_UPDATE_BUDGET);
+    if (l_Budget && p_ProcessedPackets && p_UsedTime + l_Handler->Stats.GetAverageTime() > l_Budget)
+        return true;
+
+    return false;
+}
 
 #ifdef CROSS
 /// Update the WorldSession (triggered by World update)
@@ -407,11 +479,15 @@ bool WorldSession::Update(uint32 diff, PacketFilter& updater)
 
     uint32 opcode = 0;
 
+    m_UpdateOpcodes.clear();
+
     while (!_recvQueue.empty() && _recvQueue.next(packet, updater))
     {
         opcode = packet->GetOpcode();
 
-        const OpcodeHandler* opHandle = g_OpcodeTable[WOW_CLIENT_TO_SERVER][packet->GetOpcode()];
+        OpcodeHandler* opHandle = g_OpcodeTable[WOW_CLIENT_TO_SERVER][packet->GetOpcode()];
+        auto l_HandlerStart = std::chrono::steady_clock::now();
+
         if (opHandle)
         {
             try
@@ -438,6 +514,9 @@ bool WorldSession::Update(uint32 diff, PacketFilter& updater)
             }
         }
 
+        RecordHandledPacket(opHandle, opcode, uint32(std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - l_HandlerStart).count()),
+            uint32(packet->size()));
+
         if (packet != NULL)
             delete packet;
 
@@ -453,12 +532,60 @@ bool WorldSession::Update(uint32 diff, PacketFilter& updater)
     return true;
 }
 #else
+/// Runs on a MapUpdater thread while the world thread waits, only for sessions whose player is not on a map.
+/// Nothing but the handlers: timers, query callbacks and logout stay in Update, which handles the remaining packets.
+void WorldSession::UpdateThreadSafePackets()
+{
+    if (!m_Socket || m_Socket->IsClosed() || m_inQueue)
+        return;
+
+    SessionWorkerFilter l_Filter(this);
+    WorldPacket* l_Packet = nullptr;
+    uint32 l_ProcessedPackets = 0;
+    uint32 l_UsedTime = 0;
+
+    m_UpdateOpcodes.clear();
+
+    while (!_recvQueue.empty() && !ShouldDeferNextPacket(l_ProcessedPackets, l_UsedTime) && _recvQueue.next(l_Packet, l_Filter))
+    {
+        OpcodeHandler* l_Handler = g_OpcodeTable[WOW_CLIENT_TO_SERVER][l_Packet->GetOpcode()];
+        auto l_HandlerStart = std::chrono::steady_clock::now();
+
+        try
+        {
+            /// Same as the STATUS_AUTHED case of Update
+            if (l_Packet->GetOpcode() == CMSG_ENUM_CHARACTERS)
+                m_playerRecentlyLogout = false;
+
+            sScriptMgr->OnPacketReceive(m_Socket, *l_Packet, this);
+            (this->*l_Handler->handler)(*l_Packet);
+            if (sLog->ShouldLog(LOG_FILTER_NETWORKIO, LOG_LEVEL_TRACE) && l_Packet->rpos() < l_Packet->wpos())
+                LogUnprocessedTail(l_Packet);
+        }
+        catch (ByteBufferException &)
+        {
+            sLog->outError(LOG_FILTER_NETWORKIO, "WorldSession::UpdateThreadSafePackets ByteBufferException occured while parsing a packet (opcode: %u) from client %s, accountid=%i. Skipped packet.",
+                l_Packet->GetOpcode(), GetRemoteAddress().c_str(), GetAccountId());
+        }
+
+        uint32 l_HandlerTime = uint32(std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - l_HandlerStart).count());
+        l_UsedTime += l_HandlerTime;
+
+        RecordHandledPacket(l_Handler, l_Packet->GetOpcode(), l_HandlerTime, uint32(l_Packet->size()));
+        delete l_Packet;
+
+        ++l_ProcessedPackets;
+    }
+}
+
 /// Update the WorldSession (triggered by World update)
 bool WorldSession::Update(uint32 diff, PacketFilter& updater)
 {
     uint32 sessionDiff = getMSTime();
     uint32 nbPacket = 0;
-    std::map<uint32, OpcodeInfo> pktHandle; // opcodeId / OpcodeInfo
+    uint32 l_UsedTime = 0;
+
+    m_UpdateOpcodes.clear();
 
     /// Antispam Timer update
     if (sWorld->getBoolConfig(CONFIG_ANTISPAM_ENABLED))
@@ -534,10 +661,11 @@ bool WorldSession::Update(uint32 diff, PacketFilter& updater)
     uint32 processedPackets = 0;
     while (m_Socket && !m_Socket->IsClosed() &&
             !_recvQueue.empty() && _recvQueue.peek(true) != firstDelayedPacket &&
+            !ShouldDeferNextPacket(processedPackets, l_UsedTime) &&
             _recvQueue.next(packet, updater))
     {
-        const OpcodeHandler* opHandle = g_OpcodeTable[WOW_CLIENT_TO_SERVER][packet->GetOpcode()];
-        uint32 pktTime = getMSTime();
+        OpcodeHandler* opHandle = g_OpcodeTable[WOW_CLIENT_TO_SERVER][packet->GetOpcode()];
+        auto l_HandlerStart = std::chrono::steady_clock::now();
 
         try
         {
@@ -564,7 +692,7 @@ bool WorldSession::Update(uint32 diff, PacketFilter& updater)
                     }
                     else if (m_Player->IsInWorld())
                     {
-                        sScriptMgr->OnPacketReceive(m_Socket, WorldPacket(*packet), this);
+                        sScriptMgr->OnPacketReceive(m_Socket, *packet, this);
                         (this->*opHandle->handler)(*packet);
                         if (sLog->ShouldLog(LOG_FILTER_NETWORKIO, LOG_LEVEL_TRACE) && packet->rpos() < packet->wpos())
                             LogUnprocessedTail(packet);
@@ -644,7 +772,7 @@ bool WorldSession::Update(uint32 diff, PacketFilter& updater)
                     else
                     {
                         // not expected _player or must checked in packet hanlder
-                        sScriptMgr->OnPacketReceive(m_Socket, WorldPacket(*packet), this);
+                        sScriptMgr->OnPacketReceive(m_Socket, *packet, this);
                         (this->*opHandle->handler)(*packet);
                         if (sLog->ShouldLog(LOG_FILTER_NETWORKIO, LOG_LEVEL_TRACE) && packet->rpos() < packet->wpos())
                             LogUnprocessedTail(packet);
@@ -657,7 +785,7 @@ bool WorldSession::Update(uint32 diff, PacketFilter& updater)
                         LogUnexpectedOpcode(packet, "STATUS_TRANSFER", "the player is still in world");
                     else
                     {
-                        sScriptMgr->OnPacketReceive(m_Socket, WorldPacket(*packet), this);
+                        sScriptMgr->OnPacketReceive(m_Socket, *packet, this);
                         (this->*opHandle->handler)(*packet);
                         if (sLog->ShouldLog(LOG_FILTER_NETWORKIO, LOG_LEVEL_TRACE) && packet->rpos() < packet->wpos())
                             LogUnprocessedTail(packet);
@@ -676,7 +804,7 @@ bool WorldSession::Update(uint32 diff, PacketFilter& updater)
                     if (packet->GetOpcode() == CMSG_ENUM_CHARACTERS)
                         m_playerRecentlyLogout = false;
 
-                    sScriptMgr->OnPacketReceive(m_Socket, WorldPacket(*packet), this);
+                    sScriptMgr->OnPacketReceive(m_Socket, *packet, this);
                     (this->*opHandle->handler)(*packet);
                     if (sLog->ShouldLog(LOG_FILTER_NETWORKIO, LOG_LEVEL_TRACE) && packet->rpos() < packet->wpos())
                         LogUnprocessedTail(packet);
@@ -703,28 +831,18 @@ bool WorldSession::Update(uint32 diff, PacketFilter& updater)
 
         nbPacket++;
 
+        uint32 l_HandlerTime = uint32(std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - l_HandlerStart).count());
+        l_UsedTime += l_HandlerTime;
+
         if (deletePacket)
         {
-            std::map<uint32, OpcodeInfo>::iterator itr = pktHandle.find(packet->GetOpcode());
-            if (itr == pktHandle.end())
-                pktHandle.insert(std::make_pair(packet->GetOpcode(), OpcodeInfo(1, getMSTime() - pktTime)));
-            else
-            {
-                OpcodeInfo& data = (*itr).second;
-                data.nbPkt += 1;
-                data.totalTime += getMSTime() - pktTime;
-            }
-
+            RecordHandledPacket(opHandle, packet->GetOpcode(), l_HandlerTime, uint32(packet->size()));
             delete packet;
         }
 
-#define MAX_PROCESSED_PACKETS_IN_SAME_WORLDSESSION_UPDATE 50
-        processedPackets++;
-
-        //process only a max amout of packets in 1 Update() call.
+        //process only a max amout of packets and of handler time in 1 Update() call, see ShouldDeferNextPacket.
         //Any leftover will be processed in next update
-        if (processedPackets > MAX_PROCESSED_PACKETS_IN_SAME_WORLDSESSION_UPDATE)
-            break;
+        processedPackets++;
     }
 
     if (m_Socket && !m_Socket->IsClosed() && _warden)
@@ -758,20 +876,17 @@ bool WorldSession::Update(uint32 diff, PacketFilter& updater)
     sessionDiff = getMSTime() - sessionDiff;
     if (sessionDiff > 100)
     {
-        std::map<uint32, OpcodeInfo>::iterator itr = pktHandle.find(CMSG_ADD_FRIEND);
-        if (itr != pktHandle.end())
+        UpdateOpcodeCount const* l_AddFriend = GetUpdateOpcodeCount(CMSG_ADD_FRIEND);
+        if (l_AddFriend && l_AddFriend->Count > 5)
         {
-            if ((*itr).second.nbPkt > 5)
-            {
-                sLog->outAshran("Account [%u] has been kicked for flood of CMSG_ADD_FRIEND (count : %u)", GetAccountId(), (*itr).second.nbPkt);
-                KickPlayer();
-                return false;
-            }
+            sLog->outAshran("Account [%u] has been kicked for flood of CMSG_ADD_FRIEND (count : %u)", GetAccountId(), l_AddFriend->Count);
+            KickPlayer();
+            return false;
         }
 
         sLog->outAshran("Session of account [%u] take more than 100 ms to execute (%u ms)", GetAccountId(), sessionDiff);
-        for (auto itr : pktHandle)
-            sLog->outAshran("-----> %u %s (%u ms)", itr.second.nbPkt, GetOpcodeNameForLogging((Opcodes)itr.first, WOW_CLIENT_TO_SERVER).c_str(), itr.second.totalTime);
+        for (UpdateOpcodeCount const& l_Count : m_UpdateOpcodes)
+            sLog->outAshran("-----> %u %s (%u ms)", l_Count.Count, GetOpcodeNameForLogging((Opcodes)l_Count.Opcode, WOW_CLIENT_TO_SERVER).c_str(), l_Count.Time / IN_MILLISECONDS);
     }
 
     return true;
@@ -335,6 +335,18 @@ public:
     virtual bool Process(WorldPacket* packet);
 };
 
+/// Only the PROCESS_THREADSAFE_SESSION packets of an authed session, for the session workers of World::UpdateSessions()
+/// Stops at the first other packet so the packets of a session are still handled in order
+class SessionWorkerFilter : public PacketFilter
+{
+public:
+    explicit SessionWorkerFilter(WorldSession* pSession) : PacketFilter(pSession) {}
+    ~SessionWorkerFilter() {}
+
+    virtual bool Process(WorldPacket* packet);
+    virtual bool ProcessLogout() const { return false; }
+};
+
 // Proxy structure to contain data passed to callback function,
 // only to prevent bloating the parameter list
 class CharacterCreateInfo
@@ -493,6 +505,14 @@ class WorldSession
 
         void QueuePacket(WorldPacket* new_packet);
         bool Update(uint32 diff, PacketFilter& updater);
+#ifndef CROSS
+        /// Handle the thread safe packets at the head of the queue, called by the session workers before Update
+        void UpdateThreadSafePackets();
+#endif
+
+        /// Packets handled by the session since login, and the time spent in their handlers (in microseconds)
+        uint64 GetHandledPacketCount() const { return m_HandledPacketCount; }
+        uint64 GetHandlerTime() const { return m_HandlerTime; }
 
         /// Handle the authentication waiting queue (to be completed)
         void SendAuthWaitQue(uint32 position);
@@ -1542,6 +1562,20 @@ class WorldSession
         void LogUnexpectedOpcode(WorldPacket* packet, const char* status, const char *reason);
         void LogUnprocessedTail(WorldPacket* packet);
 
+        /// Packets of an opcode handled by the current Update call
+        struct UpdateOpcodeCount
+        {
+            uint16 Opcode;
+            uint32 Count;
+            uint32 Time;                                    ///< In microseconds
+        };
+
+        /// Account a handled packet to its opcode, for the session and the realm
+        void RecordHandledPacket(OpcodeHandler* p_Handler, uint16 p_Opcode, uint32 p_Time, uint32 p_Bytes);
+        UpdateOpcodeCount const* GetUpdateOpcodeCount(uint16 p_Opcode) const;
+        /// True once the current Update call used its packet cap or time budget, or the limit of the opcode of the next packet
+        bool ShouldDeferNextPacket(uint32 p_ProcessedPackets, uint32 p_UsedTime);
+
         // EnumData helpers
         bool CharCanLogin(uint32 lowGUID)
         {
@@ -1664,6 +1698,10 @@ class WorldSession
         time_t m_LoginTime;
 
         bool m_IsStressTestSession;
+
+        std::vector<UpdateOpcodeCount> m_UpdateOpcodes;     ///< Reused by each Update call, a few distinct opcodes per call
+        uint64 m_HandledPacketCount;
+        uint64 m_HandlerTime;                               ///< In microseconds
 };
 #endif
 /// @}
@@ -493,7 +493,10 @@ SpellValue::SpellValue(SpellInfo const* proto)
 Spell::Spell(Unit* caster, SpellInfo const* info, TriggerCastFlags triggerFlags, uint64 originalCasterGUID, bool skipCheck) :
 m_spellInfo(sSpellMgr->GetSpellForDifficultyFromSpell(info, caster)),
 m_caster((info->AttributesEx6 & SPELL_ATTR6_CAST_BY_CHARMER && caster->GetCharmerOrOwner()) ? caster->GetCharmerOrOwner() : caster)
-, m_spellValue(new SpellValue(m_spellInfo)), m_preGeneratedPath(PathGenerator(m_caster))
+, m_spellValue(new SpellValue(m_spellInfo))
+, m_UniqueTargetInfo(SpellArenaAllocator<TargetInfo>(m_Arena)), m_UniqueGOTargetInfo(SpellArenaAllocator<GOTargetInfo>(m_Arena))
+, m_UniqueItemInfo(SpellArenaAllocator<ItemTargetInfo>(m_Arena)), m_UniqueAreaTriggerTargetInfo(SpellArenaAllocator<AreaTriggerTargetInfo>(m_Arena))
+, m_preGeneratedPath(PathGenerator(m_caster))
 {
     m_customError = SPELL_CUSTOM_ERROR_NONE;
     m_skipCheck = skipCheck;
@@ -808,7 +811,7 @@ void Spell::SelectSpellTargets()
         if (m_spellInfo->IsChanneled())
         {
             uint32 mask = (1 << i);
-            for (std::list<TargetInfo>::iterator ihit = m_UniqueTargetInfo.begin(); ihit != m_UniqueTargetInfo.end(); ++ihit)
+            for (TargetInfoList::iterator ihit = m_UniqueTargetInfo.begin(); ihit != m_UniqueTargetInfo.end(); ++ihit)
             {
                 if (ihit->effectMask & mask)
                 {
@@ -820,7 +823,7 @@ void Spell::SelectSpellTargets()
         else if (m_auraScaleMask)
         {
             bool checkLvl = !m_UniqueTargetInfo.empty();
-            for (std::list<TargetInfo>::iterator ihit = m_UniqueTargetInfo.begin(); ihit != m_UniqueTargetInfo.end();)
+            for (TargetInfoList::iterator ihit = m_UniqueTargetInfo.begin(); ihit != m_UniqueTargetInfo.end();)
             {
                 // remove targets which did not pass min level check
                 if (m_auraScaleMask && ihit->effectMask == m_auraScaleMask)
@@ -1232,7 +1235,7 @@ void Spell::SelectImplicitAreaTargets(SpellEffIndex p_EffIndex, SpellImplicitTar
         case TARGET_REFERENCE_TYPE_LAST:
         {
             // find last added target for this effect
-            for (std::list<TargetInfo>::reverse_iterator l_Iterator = m_UniqueTargetInfo.rbegin(); l_Iterator != m_UniqueTargetInfo.rend(); ++l_Iterator)
+            for (TargetInfoList::reverse_iterator l_Iterator = m_UniqueTargetInfo.rbegin(); l_Iterator != m_UniqueTargetInfo.rend(); ++l_Iterator)
             {
                 if (l_Iterator->effectMask & (1<<p_EffIndex))
                 {
@@ -1322,9 +1325,9 @@ void Spell::SelectImplicitAreaTargets(SpellEffIndex p_EffIndex, SpellImplicitTar
 
     CallScriptObjectAreaTargetSelectHandlers(l_Targets, p_EffIndex);
 
-    std::list<Unit*> l_UnitTargets;
-    std::list<GameObject*> l_GObjTargets;
-    std::list<AreaTrigger*> l_AreaTriggerTargets;
+    SpellArenaList<Unit*>::Type        l_UnitTargets((SpellArenaAllocator<Unit*>(m_Arena)));
+    SpellArenaList<GameObject*>::Type  l_GObjTargets((SpellArenaAllocator<GameObject*>(m_Arena)));
+    SpellArenaList<AreaTrigger*>::Type l_AreaTriggerTargets((SpellArenaAllocator<AreaTrigger*>(m_Arena)));
     // for compability with older code - add only unit and go targets
     // TODO: remove this
     if (!l_Targets.empty())
@@ -1394,7 +1397,7 @@ void Spell::SelectImplicitAreaTargets(SpellEffIndex p_EffIndex, SpellImplicitTar
                     break;
 
                 // Remove targets outside caster's raid
-                for (std::list<Unit*>::iterator l_Iterator = l_UnitTargets.begin(); l_Iterator != l_UnitTargets.end();)
+                for (SpellArenaList<Unit*>::Type::iterator l_Iterator = l_UnitTargets.begin(); l_Iterator != l_UnitTargets.end();)
                 {
                     if (!(*l_Iterator)->IsInRaidWith(m_caster))
                         l_Iterator = l_UnitTargets.erase(l_Iterator);
@@ -1415,7 +1418,7 @@ void Spell::SelectImplicitAreaTargets(SpellEffIndex p_EffIndex, SpellImplicitTar
                         // Normal case
                         if (p_EffIndex == 0 && !m_caster->HasAura(115738))
                         {
-                            for (std::list<Unit*>::iterator l_Iterator = l_UnitTargets.begin() ; l_Iterator != l_UnitTargets.end();)
+                            for (SpellArenaList<Unit*>::Type::iterator l_Iterator = l_UnitTargets.begin() ; l_Iterator != l_UnitTargets.end();)
                             {
                                 bool l_Found = false;
                                 uint8 l_TypesI = 0;
@@ -1543,7 +1546,7 @@ void Spell::SelectImplicitAreaTargets(SpellEffIndex p_EffIndex, SpellImplicitTar
                 if (l_RemoveEnemies)
                 {
                     /// Remove targets outside caster's raid
-                    for (std::list<Unit*>::iterator l_Iterator = l_UnitTargets.begin(); l_Iterator != l_UnitTargets.end();)
+                    for (SpellArenaList<Unit*>::Type::iterator l_Iterator = l_UnitTargets.begin(); l_Iterator != l_UnitTargets.end();)
                     {
                         if (!(*l_Iterator)->IsInRaidWith(m_caster))
                             l_Iterator = l_UnitTargets.erase(l_Iterator);
@@ -1570,7 +1573,7 @@ void Spell::SelectImplicitAreaTargets(SpellEffIndex p_EffIndex, SpellImplicitTar
             }
             else
             {
-                for (std::list<Unit*>::iterator l_Iterator = l_UnitTargets.begin(); l_Iterator != l_UnitTargets.end();)
+                for (SpellArenaList<Unit*>::Type::iterator l_Iterator = l_UnitTargets.begin(); l_Iterator != l_UnitTargets.end();)
                     if ((*l_Iterator)->getPowerType() != (Powers)l_Power)
                         l_Iterator = l_UnitTargets.erase(l_Iterator);
                     else
@@ -1598,7 +1601,7 @@ void Spell::SelectImplicitAreaTargets(SpellEffIndex p_EffIndex, SpellImplicitTar
         if (uint32 l_MaxTargets = m_spellValue->MaxAffectedTargets)
             JadeCore::Containers::RandomResizeList(l_UnitTargets, l_MaxTargets);
 
-        for (std::list<Unit*>::iterator l_Iterator = l_UnitTargets.begin(); l_Iterator != l_UnitTargets.end(); ++l_Iterator)
+        for (SpellArenaList<Unit*>::Type::iterator l_Iterator = l_UnitTargets.begin(); l_Iterator != l_UnitTargets.end(); ++l_Iterator)
             AddUnitTarget(*l_Iterator, p_EffMask, false);
     }
 
@@ -1607,7 +1610,7 @@ void Spell::SelectImplicitAreaTargets(SpellEffIndex p_EffIndex, SpellImplicitTar
         if (uint32 l_MaxTargets = m_spellValue->MaxAffectedTargets)
             JadeCore::Containers::RandomResizeList(l_GObjTargets, l_MaxTargets);
 
-        for (std::list<GameObject*>::iterator l_Iterator = l_GObjTargets.begin(); l_Iterator != l_GObjTargets.end(); ++l_Iterator)
+        for (SpellArenaList<GameObject*>::Type::iterator l_Iterator = l_GObjTargets.begin(); l_Iterator != l_GObjTargets.end(); ++l_Iterator)
             AddGOTarget(*l_Iterator, p_EffMask);
     }
 
@@ -1616,7 +1619,7 @@ void Spell::SelectImplicitAreaTargets(SpellEffIndex p_EffIndex, SpellImplicitTar
         if (uint32 l_MaxTargets = m_spellValue->MaxAffectedTargets)
             JadeCore::Containers::RandomResizeList(l_AreaTriggerTargets, l_MaxTargets);
 
-        for (std::list<AreaTrigger*>::iterator l_Iterator = l_AreaTriggerTargets.begin(); l_Iterator != l_AreaTriggerTargets.end(); ++l_Iterator)
+        for (SpellArenaList<AreaTrigger*>::Type::iterator l_Iterator = l_AreaTriggerTargets.begin(); l_Iterator != l_AreaTriggerTargets.end(); ++l_Iterator)
             AddAreaTriggerTarget(*l_Iterator, p_EffMask);
     }
 }
@@ -2386,6 +2389,18 @@ void Spell::SearchTargets(SEARCHER& searcher, uint32 containerMask, Unit* refere
 
         Map& map = *(referer->GetMap());
 
+        /// Player only searches use the player spatial hash of the map
+        if (containerMask == GRID_MAP_TYPE_MASK_PLAYER)
+        {
+            auto l_Worker = [&searcher](Player* p_Player) -> void
+            {
+                searcher.Visit(p_Player);
+            };
+
+            map.VisitPlayersInRange(x, y, radius, l_Worker);
+            return;
+        }
+
         if (searchInWorld)
         {
             TypeContainerVisitor<SEARCHER, WorldTypeMapContainer> world_object_notifier(searcher);
@@ -2642,7 +2657,7 @@ void Spell::AddUnitTarget(Unit* target, uint32 effectMask, bool checkIfValid /*=
     uint64 targetGUID = target->GetGUID();
 
     // Lookup target in already in list
-    for (std::list<TargetInfo>::iterator ihit = m_UniqueTargetInfo.begin(); ihit != m_UniqueTargetInfo.end(); ++ihit)
+    for (TargetInfoList::iterator ihit = m_UniqueTargetInfo.begin(); ihit != m_UniqueTargetInfo.end(); ++ihit)
     {
         if (targetGUID == ihit->targetGUID)             // Found in list
         {
@@ -2822,7 +2837,7 @@ void Spell::AddGOTarget(GameObject* go, uint32 effectMask)
     uint64 targetGUID = go->GetGUID();
 
     // Lookup target in already in list
-    for (std::list<GOTargetInfo>::iterator ihit = m_UniqueGOTargetInfo.begin(); ihit != m_UniqueGOTargetInfo.end(); ++ihit)
+    for (GOTargetInfoList::iterator ihit = m_UniqueGOTargetInfo.begin(); ihit != m_UniqueGOTargetInfo.end(); ++ihit)
     {
         if (targetGUID == ihit->targetGUID)                 // Found in list
         {
@@ -2871,7 +2886,7 @@ void Spell::AddItemTarget(Item* item, uint32 effectMask)
         return;
 
     // Lookup target in already in list
-    for (std::list<ItemTargetInfo>::iterator ihit = m_UniqueItemInfo.begin(); ihit != m_UniqueItemInfo.end(); ++ihit)
+    for (ItemTargetInfoList::iterator ihit = m_UniqueItemInfo.begin(); ihit != m_UniqueItemInfo.end(); ++ihit)
     {
         if (item == ihit->item)                            // Found in list
         {
@@ -2902,7 +2917,7 @@ void Spell::AddAreaTriggerTarget(AreaTrigger* p_AreaTrigger, uint32 p_EffectMask
     uint64 l_TargetGUID = p_AreaTrigger->GetGUID();
 
     // Lookup target in already in list
-    for (std::list<AreaTriggerTargetInfo>::iterator l_Iterator = m_UniqueAreaTriggerTargetInfo.begin(); l_Iterator != m_UniqueAreaTriggerTargetInfo.end(); ++l_Iterator)
+    for (AreaTriggerTargetInfoList::iterator l_Iterator = m_UniqueAreaTriggerTargetInfo.begin(); l_Iterator != m_UniqueAreaTriggerTargetInfo.end(); ++l_Iterator)
     {
         if (l_TargetGUID == l_Iterator->targetGUID)                 // Found in list
         {
@@ -3653,7 +3668,7 @@ bool Spell::UpdateChanneledTargetList()
             modOwner->ApplySpellMod(m_spellInfo->Id, SPELLMOD_RANGE, range, this);
     }
 
-    for (std::list<TargetInfo>::iterator ihit= m_UniqueTargetInfo.begin(); ihit != m_UniqueTargetInfo.end(); ++ihit)
+    for (TargetInfoList::iterator ihit= m_UniqueTargetInfo.begin(); ihit != m_UniqueTargetInfo.end(); ++ihit)
     {
         if (ihit->missCondition == SPELL_MISS_NONE && (channelTargetEffectMask & ihit->effectMask))
         {
@@ -3927,7 +3942,7 @@ void Spell::cancel()
             break;
 
         case SPELL_STATE_CASTING:
-            for (std::list<TargetInfo>::const_iterator ihit = m_UniqueTargetInfo.begin(); ihit != m_UniqueTargetInfo.end(); ++ihit)
+            for (TargetInfoList::const_iterator ihit = m_UniqueTargetInfo.begin(); ihit != m_UniqueTargetInfo.end(); ++ihit)
                 if ((*ihit).missCondition == SPELL_MISS_NONE)
                     if (Unit* unit = m_caster->GetGUID() == ihit->targetGUID ? m_caster : ObjectAccessor::GetUnit(*m_caster, ihit->targetGUID))
                         unit->RemoveOwnedAura(m_spellInfo->Id, m_originalCasterGUID, 0, AURA_REMOVE_BY_CANCEL);
@@ -4277,10 +4292,10 @@ void Spell::handle_immediate()
     // process immediate effects (items, ground, etc.) also initialize some variables
     _handle_immediate_phase();
 
-    for (std::list<TargetInfo>::iterator ihit= m_UniqueTargetInfo.begin(); ihit != m_UniqueTargetInfo.end(); ++ihit)
+    for (TargetInfoList::iterator ihit= m_UniqueTargetInfo.begin(); ihit != m_UniqueTargetInfo.end(); ++ihit)
         DoAllEffectOnTarget(&(*ihit));
 
-    for (std::list<GOTargetInfo>::iterator ihit= m_UniqueGOTargetInfo.begin(); ihit != m_UniqueGOTargetInfo.end(); ++ihit)
+    for (GOTargetInfoList::iterator ihit= m_UniqueGOTargetInfo.begin(); ihit != m_UniqueGOTargetInfo.end(); ++ihit)
         DoAllEffectOnTarget(&(*ihit));
 
     FinishTargetProcessing();
@@ -4319,7 +4334,7 @@ uint64 Spell::handle_delayed(uint64 t_offset)
     bool single_missile = (m_targets.HasDst());
 
     // now recheck units targeting correctness (need before any effects apply to prevent adding immunity at first effect not allow apply second spell effect and similar cases)
-    for (std::list<TargetInfo>::iterator ihit= m_UniqueTargetInfo.begin(); ihit != m_UniqueTargetInfo.end(); ++ihit)
+    for (TargetInfoList::iterator ihit= m_UniqueTargetInfo.begin(); ihit != m_UniqueTargetInfo.end(); ++ihit)
     {
         if (ihit->processed == false)
         {
@@ -4334,7 +4349,7 @@ uint64 Spell::handle_delayed(uint64 t_offset)
     }
 
     // now recheck gameobject targeting correctness
-    for (std::list<GOTargetInfo>::iterator ighit= m_UniqueGOTargetInfo.begin(); ighit != m_UniqueGOTargetInfo.end(); ++ighit)
+    for (GOTargetInfoList::iterator ighit= m_UniqueGOTargetInfo.begin(); ighit != m_UniqueGOTargetInfo.end(); ++ighit)
     {
         if (ighit->processed == false)
         {
@@ -4392,7 +4407,7 @@ void Spell::_handle_immediate_phase()
     }
 
     // process items
-    for (std::list<ItemTargetInfo>::iterator ihit= m_UniqueItemInfo.begin(); ihit != m_UniqueItemInfo.end(); ++ihit)
+    for (ItemTargetInfoList::iterator ihit= m_UniqueItemInfo.begin(); ihit != m_UniqueItemInfo.end(); ++ihit)
         DoAllEffectOnTarget(&(*ihit));
 
     if (!m_originalCaster)
@@ -4554,7 +4569,7 @@ void Spell::update(uint32 difftime)
                 {
                     if (Player* p = m_caster->GetCharmerOrOwnerPlayerOrPlayerItself())
                     {
-                        for (std::list<TargetInfo>::iterator ihit = m_UniqueTargetInfo.begin(); ihit != m_UniqueTargetInfo.end(); ++ihit)
+                        for (TargetInfoList::iterator ihit = m_UniqueTargetInfo.begin(); ihit != m_UniqueTargetInfo.end(); ++ihit)
                         {
                             TargetInfo* target = &*ihit;
                             if (!IS_CRE_OR_VEH_GUID(target->targetGUID))
@@ -4567,7 +4582,7 @@ void Spell::update(uint32 difftime)
                             p->CastedCreatureOrGO(unit->GetEntry(), unit->GetGUID(), m_spellInfo->Id);
                         }
 
-                        for (std::list<GOTargetInfo>::iterator ihit = m_UniqueGOTargetInfo.begin(); ihit != m_UniqueGOTargetInfo.end(); ++ihit)
+                        for (GOTargetInfoList::iterator ihit = m_UniqueGOTargetInfo.begin(); ihit != m_UniqueGOTargetInfo.end(); ++ihit)
                         {
                             GOTargetInfo* target = &*ihit;
 
@@ -5144,18 +5159,18 @@ void Spell::SendSpellGo()
     // Process targets data
     {
         // ---- Miss target ---- //
-        for (std::list<TargetInfo>::iterator ihit = m_UniqueTargetInfo.begin(); ihit != m_UniqueTargetInfo.end(); ++ihit)
+        for (TargetInfoList::iterator ihit = m_UniqueTargetInfo.begin(); ihit != m_UniqueTargetInfo.end(); ++ihit)
         {
             if ((*ihit).effectMask == 0)                  // No effect apply - all immuned add state
                 ihit->missCondition = SPELL_MISS_IMMUNE2;
         }
 
-        for (std::list<TargetInfo>::const_iterator ihit = m_UniqueTargetInfo.begin(); ihit != m_UniqueTargetInfo.end(); ++ihit)
+        for (TargetInfoList::const_iterator ihit = m_UniqueTargetInfo.begin(); ihit != m_UniqueTargetInfo.end(); ++ihit)
             if (ihit->missCondition != SPELL_MISS_NONE)        // Add only miss
                 ++l_MissCount;
 
         // ---- Hit target ---- //
-        for (std::list<TargetInfo>::const_iterator ihit = m_UniqueTargetInfo.begin(); ihit != m_UniqueTargetInfo.end(); ++ihit)
+        for (TargetInfoList::const_iterator ihit = m_UniqueTargetInfo.begin(); ihit != m_UniqueTargetInfo.end(); ++ihit)
         {
             if ((*ihit).missCondition == SPELL_MISS_NONE)       // Add only hits
             {
@@ -5168,7 +5183,7 @@ void Spell::SendSpellGo()
         if (!m_spellInfo->IsChanneled())
             m_channelTargetEffectMask = 0;
 
-        for (std::list<GOTargetInfo>::const_iterator ighit = m_UniqueGOTargetInfo.begin(); ighit != m_UniqueGOTargetInfo.end(); ++ighit)
+        for (GOTargetInfoList::const_iterator ighit = m_UniqueGOTargetInfo.begin(); ighit != m_UniqueGOTargetInfo.end(); ++ighit)
             ++l_HitCount;
     }
 
@@ -5297,23 +5312,23 @@ void Spell::SendSpellGo()
     // Send hit guid
     {
         // First units ...
-        for (std::list<TargetInfo>::const_iterator ihit = m_UniqueTargetInfo.begin(); ihit != m_UniqueTargetInfo.end(); ++ihit)
+        for (TargetInfoList::const_iterator ihit = m_UniqueTargetInfo.begin(); ihit != m_UniqueTargetInfo.end(); ++ihit)
             if ((*ihit).missCondition == SPELL_MISS_NONE)
                 l_Data.appendPackGUID(ihit->targetGUID);
 
         // And GameObjects
-        for (std::list<GOTargetInfo>::const_iterator ighit = m_UniqueGOTargetInfo.begin(); ighit != m_UniqueGOTargetInfo.end(); ++ighit)
+        for (GOTargetInfoList::const_iterator ighit = m_UniqueGOTargetInfo.begin(); ighit != m_UniqueGOTargetInfo.end(); ++ighit)
             l_Data.appendPackGUID(ighit->targetGUID);
     }
 
     // Send missed guid
     {
-        for (std::list<TargetInfo>::const_iterator ihit = m_UniqueTargetInfo.begin(); ihit != m_UniqueTargetInfo.end(); ++ihit)
+        for (TargetInfoList::const_iterator ihit = m_UniqueTargetInfo.begin(); ihit != m_UniqueTargetInfo.end(); ++ihit)
             if ((*ihit).missCondition != SPELL_MISS_NONE)
                 l_Data.appendPackGUID(ihit->targetGUID);
     }
 
-    for (std::list<TargetInfo>::const_iterator ihit = m_UniqueTargetInfo.begin(); ihit != m_UniqueTargetInfo.end(); ++ihit)
+    for (TargetInfoList::const_iterator ihit = m_UniqueTargetInfo.begin(); ihit != m_UniqueTargetInfo.end(); ++ihit)
     {
         if (ihit->missCondition != SPELL_MISS_NONE)
         {
@@ -5712,7 +5727,7 @@ void Spell::TakePower()
             {
                 if (uint64 targetGUID = m_targets.GetUnitTargetGUID())
                 {
-                    for (std::list<TargetInfo>::iterator ihit = m_UniqueTargetInfo.begin(); ihit != m_UniqueTargetInfo.end(); ++ihit)
+                    for (TargetInfoList::iterator ihit = m_UniqueTargetInfo.begin(); ihit != m_UniqueTargetInfo.end(); ++ihit)
                     {
                         if (ihit->targetGUID == targetGUID)
                         {
@@ -6088,7 +6103,7 @@ void Spell::HandleThreatSpells()
     // since 2.0.1 threat from positive effects also is distributed among all targets, so the overall caused threat is at most the defined bonus
     threat /= m_UniqueTargetInfo.size();
 
-    for (std::list<TargetInfo>::iterator ihit = m_UniqueTargetInfo.begin(); ihit != m_UniqueTargetInfo.end(); ++ihit)
+    for (TargetInfoList::iterator ihit = m_UniqueTargetInfo.begin(); ihit != m_UniqueTargetInfo.end(); ++ihit)
     {
         if (ihit->missCondition != SPELL_MISS_NONE)
             continue;
@@ -6136,7 +6151,7 @@ void Spell::HandleHolyPower(Player* caster)
 
     if (uint64 targetGUID = m_targets.GetUnitTargetGUID())
     {
-        for (std::list<TargetInfo>::iterator ihit = m_UniqueTargetInfo.begin(); ihit != m_UniqueTargetInfo.end(); ++ihit)
+        for (TargetInfoList::iterator ihit = m_UniqueTargetInfo.begin(); ihit != m_UniqueTargetInfo.end(); ++ihit)
         {
             if (ihit->targetGUID == targetGUID)
             {
@@ -7615,7 +7630,7 @@ bool Spell::CanAutoCast(Unit* target)
     {
         SelectSpellTargets();
         //check if among target units, our WANTED target is as well (->only self cast spells return false)
-        for (std::list<TargetInfo>::iterator ihit= m_UniqueTargetInfo.begin(); ihit != m_UniqueTargetInfo.end(); ++ihit)
+        for (TargetInfoList::iterator ihit= m_UniqueTargetInfo.begin(); ihit != m_UniqueTargetInfo.end(); ++ihit)
             if (ihit->targetGUID == targetguid)
                 return true;
     }
@@ -8417,7 +8432,7 @@ void Spell::DelayedChannel()
     else
         m_timer -= delaytime;
 
-    for (std::list<TargetInfo>::const_iterator ihit = m_UniqueTargetInfo.begin(); ihit != m_UniqueTargetInfo.end(); ++ihit)
+    for (TargetInfoList::const_iterator ihit = m_UniqueTargetInfo.begin(); ihit != m_UniqueTargetInfo.end(); ++ihit)
         if ((*ihit).missCondition == SPELL_MISS_NONE)
             if (Unit* unit = (m_caster->GetGUID() == ihit->targetGUID) ? m_caster : ObjectAccessor::GetUnit(*m_caster, ihit->targetGUID))
                 unit->DelayOwnedAuras(m_spellInfo->Id, m_originalCasterGUID, delaytime);
@@ -8622,15 +8637,15 @@ bool Spell::IsNeedSendToClient() const
 
 bool Spell::HaveTargetsForEffect(uint8 effect) const
 {
-    for (std::list<TargetInfo>::const_iterator itr = m_UniqueTargetInfo.begin(); itr != m_UniqueTargetInfo.end(); ++itr)
+    for (TargetInfoList::const_iterator itr = m_UniqueTargetInfo.begin(); itr != m_UniqueTargetInfo.end(); ++itr)
         if (itr->effectMask & (1 << effect))
             return true;
 
-    for (std::list<GOTargetInfo>::const_iterator itr = m_UniqueGOTargetInfo.begin(); itr != m_UniqueGOTargetInfo.end(); ++itr)
+    for (GOTargetInfoList::const_iterator itr = m_UniqueGOTargetInfo.begin(); itr != m_UniqueGOTargetInfo.end(); ++itr)
         if (itr->effectMask & (1 << effect))
             return true;
 
-    for (std::list<ItemTargetInfo>::const_iterator itr = m_UniqueItemInfo.begin(); itr != m_UniqueItemInfo.end(); ++itr)
+    for (ItemTargetInfoList::const_iterator itr = m_UniqueItemInfo.begin(); itr != m_UniqueItemInfo.end(); ++itr)
         if (itr->effectMask & (1 << effect))
             return true;
 
@@ -8760,7 +8775,7 @@ void Spell::HandleLaunchPhase()
 
     bool usesAmmo = m_spellInfo->AttributesCu & SPELL_ATTR0_CU_DIRECT_DAMAGE;
 
-    for (std::list<TargetInfo>::iterator ihit= m_UniqueTargetInfo.begin(); ihit != m_UniqueTargetInfo.end(); ++ihit)
+    for (TargetInfoList::iterator ihit= m_UniqueTargetInfo.begin(); ihit != m_UniqueTargetInfo.end(); ++ihit)
     {
         TargetInfo& target = *ihit;
 
@@ -14,6 +14,8 @@
 #include "ObjectMgr.h"
 #include "SpellInfo.h"
 #include "PathGenerator.h"
+#include "ObjectPool.h"
+#include "SpellArena.h"
 
 class Unit;
 class Player;
@@ -361,6 +363,7 @@ class Spell
     friend void Unit::SetCurrentCastedSpell(Spell* pSpell);
     friend class SpellScript;
 public:
+    OBJECT_POOL_ALLOCATED(OBJECT_POOL_SPELL)
 
     void EffectNULL(SpellEffIndex effIndex);
     void EffectUnused(SpellEffIndex effIndex);
@@ -794,6 +797,9 @@ protected:
     // Spell target subsystem
     // *****************************************
     // Targets store structures and data
+    /// Owns the nodes of the target containers below, declared first so it outlives them
+    SpellArena m_Arena;
+
     struct TargetInfo
     {
         uint64 targetGUID;
@@ -807,7 +813,8 @@ protected:
         bool   scaleAura : 1;
         int32  damage;
     };
-    std::list<TargetInfo> m_UniqueTargetInfo;
+    typedef SpellArenaList<TargetInfo>::Type TargetInfoList;
+    TargetInfoList m_UniqueTargetInfo;
     uint32 m_channelTargetEffectMask;                        // Mask req. alive targets
 
     struct GOTargetInfo
@@ -817,14 +824,16 @@ protected:
         uint32  effectMask : 32;
         bool   processed : 1;
     };
-    std::list<GOTargetInfo> m_UniqueGOTargetInfo;
+    typedef SpellArenaList<GOTargetInfo>::Type GOTargetInfoList;
+    GOTargetInfoList m_UniqueGOTargetInfo;
 
     struct ItemTargetInfo
     {
         Item  *item;
         uint32 effectMask;
     };
-    std::list<ItemTargetInfo> m_UniqueItemInfo;
+    typedef SpellArenaList<ItemTargetInfo>::Type ItemTargetInfoList;
+    ItemTargetInfoList m_UniqueItemInfo;
 
     struct AreaTriggerTargetInfo
     {
@@ -833,7 +842,8 @@ protected:
         uint32 effectMask : 32;
         bool   processed  : 1;
     };
-    std::list<AreaTriggerTargetInfo> m_UniqueAreaTriggerTargetInfo;
+    typedef SpellArenaList<AreaTriggerTargetInfo>::Type AreaTriggerTargetInfoList;
+    AreaTriggerTargetInfoList m_UniqueAreaTriggerTargetInfo;
 
     SpellDestination m_destTargets[SpellEffIndex::MAX_EFFECTS];
 
@@ -0,0 +1,45 @@
+////////////////////////////////////////////////////////////////////////////////
+//
+//  MILLENIUM-STUDIO
+//  Copyright 2016 Millenium-studio SARL
+//  All Rights Reserved.
+//
+////////////////////////////////////////////////////////////////////////////////
+
+#include "SpellArena.h"
+
+#include <cstdlib>
+
+SpellArena::~SpellArena()
+{
+    while (m_Blocks)
+    {
+        Block* l_Next = m_Blocks->Next;
+        free(m_Blocks);
+        m_Blocks = l_Next;
+    }
+}
+
+void* SpellArena::AllocateBlock(size_t p_Size)
+{
+    size_t l_DataSize = std::max<size_t>(p_Size, SPELL_ARENA_BLOCK_SIZE);
+
+    Block* l_Block = static_cast<Block*>(malloc(sizeof(Block) + l_DataSize));
+    if (!l_Block)
+        throw std::bad_alloc();
+
+    l_Block->Next = m_Blocks;
+    l_Block->Size = l_DataSize;
+    m_Blocks = l_Block;
+    ++m_BlockCount;
+
+    uint8* l_Data = reinterpret_cast<uint8*>(l_Block + 1);
+
+    /// A chunk bigger than a block gets its own block, the current one keeps serving the small ones
+    if (p_Size >= SPELL_ARENA_BLOCK_SIZE && size_t(m_End - m_Position) > 0)
+        return l_Data;
+
+    m_Position = l_Data + p_Size;
+    m_End      = l_Data + l_DataSize;
+    return l_Data;
+}
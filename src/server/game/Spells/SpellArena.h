@@ -0,0 +1,174 @@
+////////////////////////////////////////////////////////////////////////////////
+//
+//  MILLENIUM-STUDIO
+//  Copyright 2016 Millenium-studio SARL
+//  All Rights Reserved.
+//
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef SPELL_ARENA_H
+#define SPELL_ARENA_H
+
+#include "Define.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <list>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#define SPELL_ARENA_INLINE_SIZE     512             ///< Single target casts and small AoE (about 6 units), no allocation at all for them
+#define SPELL_ARENA_BLOCK_SIZE      8192
+#define SPELL_ARENA_ALIGNMENT       8
+#define SPELL_ARENA_FREE_LISTS      32              ///< Recycled sizes, up to SPELL_ARENA_FREE_LISTS * SPELL_ARENA_ALIGNMENT bytes
+
+/// Bump allocator owning the target containers of one cast.
+///
+/// The first SPELL_ARENA_INLINE_SIZE bytes live inside the arena itself (so inside the Spell), bigger casts
+/// chain malloc'd blocks released all at once with the arena. Freed chunks go to a free list per size and
+/// are reused by the next allocation of the same size, so erasing and re-adding targets does not grow it.
+/// Not thread safe, a cast is only handled by the thread updating its caster.
+class SpellArena
+{
+    public:
+        SpellArena() : m_Position(m_Inline.m_Bytes), m_End(m_Inline.m_Bytes + SPELL_ARENA_INLINE_SIZE), m_Blocks(nullptr), m_BlockCount(0)
+        {
+            for (uint32 l_I = 0; l_I < SPELL_ARENA_FREE_LISTS; ++l_I)
+                m_FreeLists[l_I] = nullptr;
+        }
+
+        ~SpellArena();
+
+        void* Allocate(size_t p_Size)
+        {
+            p_Size = AlignSize(p_Size);
+
+            uint32 l_FreeList = uint32(p_Size / SPELL_ARENA_ALIGNMENT) - 1;
+            if (l_FreeList < SPELL_ARENA_FREE_LISTS && m_FreeLists[l_FreeList])
+            {
+                FreeChunk* l_Chunk = m_FreeLists[l_FreeList];
+                m_FreeLists[l_FreeList] = l_Chunk->Next;
+                return l_Chunk;
+            }
+
+            if (size_t(m_End - m_Position) < p_Size)
+                return AllocateBlock(p_Size);
+
+            void* l_Result = m_Position;
+            m_Position += p_Size;
+            return l_Result;
+        }
+
+        void Deallocate(void* p_Pointer, size_t p_Size)
+        {
+            p_Size = AlignSize(p_Size);
+
+            /// Bigger chunks are only released with the arena
+            uint32 l_FreeList = uint32(p_Size / SPELL_ARENA_ALIGNMENT) - 1;
+            if (l_FreeList >= SPELL_ARENA_FREE_LISTS)
+                return;
+
+            FreeChunk* l_Chunk = static_cast<FreeChunk*>(p_Pointer);
+            l_Chunk->Next = m_FreeLists[l_FreeList];
+            m_FreeLists[l_FreeList] = l_Chunk;
+        }
+
+        /// Blocks allocated once the inline storage was full
+        uint32 GetBlockCount() const { return m_BlockCount; }
+
+    private:
+        SpellArena(SpellArena const&);
+        SpellArena& operator=(SpellArena const&);
+
+        struct FreeChunk
+        {
+            FreeChunk* Next;
+        };
+
+        struct Block
+        {
+            Block* Next;
+            uint64 Size;                            ///< Keeps the data SPELL_ARENA_ALIGNMENT aligned
+        };
+
+        static size_t AlignSize(size_t p_Size)
+        {
+            return (std::max<size_t>(p_Size, sizeof(FreeChunk)) + SPELL_ARENA_ALIGNMENT - 1) & ~size_t(SPELL_ARENA_ALIGNMENT - 1);
+        }
+
+        void* AllocateBlock(size_t p_Size);
+
+        union InlineStorage
+        {
+            uint8 m_Bytes[SPELL_ARENA_INLINE_SIZE];
+            uint64 m_Align;
+        };
+
+        InlineStorage m_Inline;
+        uint8* m_Position;
+        uint8* m_End;
+        Block* m_Blocks;
+        uint32 m_BlockCount;
+        FreeChunk* m_FreeLists[SPELL_ARENA_FREE_LISTS];
+};
+
+/// Standard allocator handing out memory of a SpellArena, the arena must outlive the containers using it
+template<class T> class SpellArenaAllocator
+{
+    public:
+        typedef T value_type;
+        typedef T* pointer;
+        typedef T const* const_pointer;
+        typedef T& reference;
+        typedef T const& const_reference;
+        typedef size_t size_type;
+        typedef ptrdiff_t difference_type;
+
+        template<class U> struct rebind
+        {
+            typedef SpellArenaAllocator<U> other;
+        };
+
+        explicit SpellArenaAllocator(SpellArena& p_Arena) : m_Arena(&p_Arena) { }
+        template<class U> SpellArenaAllocator(SpellArenaAllocator<U> const& p_Other) : m_Arena(p_Other.GetArena()) { }
+
+        SpellArena* GetArena() const { return m_Arena; }
+
+        T* allocate(size_t p_Count, void const* = nullptr)
+        {
+            static_assert(std::alignment_of<T>::value <= SPELL_ARENA_ALIGNMENT, "SpellArena alignment is too small for this type");
+            return static_cast<T*>(m_Arena->Allocate(p_Count * sizeof(T)));
+        }
+
+        void deallocate(T* p_Pointer, size_t p_Count)
+        {
+            m_Arena->Deallocate(p_Pointer, p_Count * sizeof(T));
+        }
+
+        size_t max_size() const { return size_t(-1) / sizeof(T); }
+
+        template<class U, class... Args> void construct(U* p_Pointer, Args&&... p_Args)
+        {
+            ::new((void*)p_Pointer) U(std::forward<Args>(p_Args)...);
+        }
+
+        template<class U> void destroy(U* p_Pointer)
+        {
+            p_Pointer->~U();
+        }
+
+        template<class U> bool operator==(SpellArenaAllocator<U> const& p_Other) const { return m_Arena == p_Other.GetArena(); }
+        template<class U> bool operator!=(SpellArenaAllocator<U> const& p_Other) const { return m_Arena != p_Other.GetArena(); }
+
+    private:
+        SpellArena* m_Arena;
+};
+
+/// std::list with its nodes in a SpellArena, for the target containers of a cast
+template<class T> struct SpellArenaList
+{
+    typedef std::list<T, SpellArenaAllocator<T>> Type;
+};
+
+#endif
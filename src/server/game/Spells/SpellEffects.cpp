@@ -429,7 +429,7 @@ void Spell::EffectSchoolDMG(SpellEffIndex effIndex)
                 if (m_spellInfo->AttributesCu & SPELL_ATTR0_CU_SHARE_DAMAGE)
                 {
                     uint32 count = 0;
-                    for (std::list<TargetInfo>::iterator ihit = m_UniqueTargetInfo.begin(); ihit != m_UniqueTargetInfo.end(); ++ihit)
+                    for (TargetInfoList::iterator ihit = m_UniqueTargetInfo.begin(); ihit != m_UniqueTargetInfo.end(); ++ihit)
                     if (ihit->effectMask & (1 << effIndex))
                         ++count;
 
@@ -519,7 +519,7 @@ void Spell::EffectSchoolDMG(SpellEffIndex effIndex)
                                 damage = stacks * (damage + 0.1f * m_caster->SpellBaseDamageBonusDone(m_spellInfo->GetSchoolMask()));
                                 damage = m_caster->SpellDamageBonusDone(unitTarget, m_spellInfo, damage, effIndex, SPELL_DIRECT_DAMAGE);
                                 uint32 count = 0;
-                                for (std::list<TargetInfo>::iterator ihit = m_UniqueTargetInfo.begin(); ihit != m_UniqueTargetInfo.end(); ++ihit)
+                                for (TargetInfoList::iterator ihit = m_UniqueTargetInfo.begin(); ihit != m_UniqueTargetInfo.end(); ++ihit)
                                     ++count;
                                 damage /= count;
                             }
@@ -807,7 +807,7 @@ void Spell::EffectDummy(SpellEffIndex effIndex)
                 case 31789: // Righteous Defense (step 1)
                 {
                     // Clear targets for eff 1
-                    for (std::list<TargetInfo>::iterator ihit = m_UniqueTargetInfo.begin(); ihit != m_UniqueTargetInfo.end(); ++ihit)
+                    for (TargetInfoList::iterator ihit = m_UniqueTargetInfo.begin(); ihit != m_UniqueTargetInfo.end(); ++ihit)
                         ihit->effectMask &= ~(1 << 1);
 
                     // not empty (checked), copy
@@ -1847,7 +1847,7 @@ void Spell::EffectHeal(SpellEffIndex effIndex)
             case 15290: // Vampiric Embrace
             {
                 uint32 count = 0;
-                for (std::list<TargetInfo>::iterator ihit = m_UniqueTargetInfo.begin(); ihit != m_UniqueTargetInfo.end(); ++ihit)
+                for (TargetInfoList::iterator ihit = m_UniqueTargetInfo.begin(); ihit != m_UniqueTargetInfo.end(); ++ihit)
                     if (ihit->effectMask & (1 << effIndex))
                         ++count;
 
@@ -2406,7 +2406,7 @@ void Spell::EffectEnergize(SpellEffIndex effIndex)
             break;
         case 35395: // Crusader Strike
             if (uint64 targetGUID = m_targets.GetUnitTargetGUID())
-                for (std::list<TargetInfo>::iterator ihit = m_UniqueTargetInfo.begin(); ihit != m_UniqueTargetInfo.end(); ++ihit)
+                for (TargetInfoList::iterator ihit = m_UniqueTargetInfo.begin(); ihit != m_UniqueTargetInfo.end(); ++ihit)
                 {
                     if (ihit->targetGUID == targetGUID)
                     {
@@ -4112,7 +4112,7 @@ void Spell::EffectWeaponDmg(SpellEffIndex effIndex)
                 case 70814: ///< Bone Slice
                 {
                     uint32 count = 0;
-                    for (std::list<TargetInfo>::iterator ihit = m_UniqueTargetInfo.begin(); ihit != m_UniqueTargetInfo.end(); ++ihit)
+                    for (TargetInfoList::iterator ihit = m_UniqueTargetInfo.begin(); ihit != m_UniqueTargetInfo.end(); ++ihit)
                         if (ihit->effectMask & (1 << effIndex))
                             ++count;
 
@@ -4279,7 +4279,7 @@ void Spell::EffectWeaponDmg(SpellEffIndex effIndex)
     if (m_spellInfo->Id == 30213)
     {
         uint32 count = 0;
-        for (std::list<TargetInfo>::iterator ihit = m_UniqueTargetInfo.begin(); ihit != m_UniqueTargetInfo.end(); ++ihit)
+        for (TargetInfoList::iterator ihit = m_UniqueTargetInfo.begin(); ihit != m_UniqueTargetInfo.end(); ++ihit)
         {
             if (ihit->effectMask & (1 << effIndex))
                 ++count;
@@ -8624,6 +8624,8 @@ void Spell::EffectFinishGarrisonShipment(SpellEffIndex p_EffIndex)
                     l_TempShipmentsList[l_OrderI]->CompleteTime = l_CurrentTimeStamp;
                 }
 
+                l_GarrisonMgr->ScheduleUpdate(MS::Garrison::UpdateType::WorkOrders);
+
                 m_caster->CastSpell(m_caster, 180704, true); ///< Rush Order visual
             }
         }
@@ -327,10 +327,13 @@ typedef std::unordered_map<uint32, SpellVisualVector> SpellVisualMap;
 class SpellInfo
 {
 public:
+    /// Hot fields, read by every cast, proc and aura tick: kept together at the head of the object so
+    /// a spell lookup touches a few cache lines. Effects come right after, their types are read as often.
     uint32 Id;
-    SpellCategoryEntry const* CategoryEntry;
-    uint32 Dispel;
-    uint32 Mechanic;
+    uint32 SchoolMask;
+    uint32 DmgClass;
+    uint32 PowerType;
+    uint32 PreventionType;
     uint32 Attributes;
     uint32 AttributesEx;
     uint32 AttributesEx2;
@@ -346,46 +349,58 @@ public:
     uint32 AttributesEx12;
     uint32 AttributesEx13;
     uint32 AttributesCu;
-    uint64 Stances;
-    uint64 StancesNot;
+    uint32 ExplicitTargetMask;
     uint32 Targets;
-    uint32 TargetCreatureType;
-    uint32 RequiresSpellFocus;
+    uint32 InterruptFlags;
+    uint64 AuraInterruptFlags;
+    uint64 ChannelInterruptFlags;
     uint32 FacingCasterFlags;
-    uint32 CasterAuraState;
-    uint32 TargetAuraState;
-    uint32 CasterAuraStateNot;
-    uint32 TargetAuraStateNot;
-    uint32 CasterAuraSpell;
-    uint32 TargetAuraSpell;
-    uint32 ExcludeCasterAuraSpell;
-    uint32 ExcludeTargetAuraSpell;
     SpellCastTimesEntry const* CastTimeEntry;
+    SpellRangeEntry const* RangeEntry;
+    SpellDurationEntry const* DurationEntry;
+    float  Speed;
     uint32 RecoveryTime;
     uint32 CategoryRecoveryTime;
     uint32 StartRecoveryCategory;
     uint32 StartRecoveryTime;
-    uint32 InterruptFlags;
-    uint64 AuraInterruptFlags;
-    uint64 ChannelInterruptFlags;
+    SpellCategoryEntry const* CategoryEntry;
+    SpellCategoryEntry const* ChargeCategoryEntry;
     uint32 ProcFlags;
     uint32 ProcChance;
     uint32 ProcCharges;
     uint32 ProcCooldown;
     float ProcBasePPM;
+    uint32 StackAmount;
+    uint32 MaxAffectedTargets;
+    uint32 SpellFamilyName;
+    flag128 SpellFamilyFlags;
+    uint32 Dispel;
+    uint32 Mechanic;
+    uint32 DifficultyID;
+    uint8 EffectCount;
+    SpellEffectInfo Effects[SpellEffIndex::MAX_EFFECTS];
+
+    /// Cold fields, DBC data read by the spell checks, the client packets and the loaders
+    uint64 Stances;
+    uint64 StancesNot;
+    uint32 TargetCreatureType;
+    uint32 RequiresSpellFocus;
+    uint32 CasterAuraState;
+    uint32 TargetAuraState;
+    uint32 CasterAuraStateNot;
+    uint32 TargetAuraStateNot;
+    uint32 CasterAuraSpell;
+    uint32 TargetAuraSpell;
+    uint32 ExcludeCasterAuraSpell;
+    uint32 ExcludeTargetAuraSpell;
     std::vector<SpellProcsPerMinuteModEntry const*> ProcPPMMods;
     uint32 MaxLevel;
     uint32 BaseLevel;
     uint32 SpellLevel;
-    SpellDurationEntry const* DurationEntry;
-    uint32 PowerType;
     uint32 ManaCost;
     uint32 ManaPerSecond;
     float ManaCostPercentage;
     uint32 RuneCostID;
-    SpellRangeEntry const* RangeEntry;
-    float  Speed;
-    uint32 StackAmount;
     uint32 InternalCooldown;
     uint32 Totem[2];
     int32  Reagent[MAX_SPELL_REAGENTS];
@@ -401,14 +416,7 @@ public:
     char* SpellName;
     char* Rank;
     uint32 MaxTargetLevel;
-    uint32 MaxAffectedTargets;
-    uint32 SpellFamilyName;
-    flag128 SpellFamilyFlags;
-    uint32 DmgClass;
-    uint32 PreventionType;
     int32  AreaGroupId;
-    uint32 SchoolMask;
-    SpellCategoryEntry const* ChargeCategoryEntry;
     uint32 SpellDifficultyId;
     uint32 SpellScalingId;
     uint32 SpellAuraOptionsId;
@@ -432,12 +440,9 @@ public:
     int32  ScalingClass;
     float  NerfFactor;
     int32  NerfMaxLevel;
-    SpellEffectInfo Effects[SpellEffIndex::MAX_EFFECTS];
-    uint32 ExplicitTargetMask;
     SpellChainNode const* ChainEntry;
     std::list<SpellPowerEntry const*> SpellPowers;
     uint32 ResearchProject;
-    uint8 EffectCount;
 
     // SpecializationSpellEntry
     std::list<uint32> SpecializationIdList;
@@ -446,9 +451,6 @@ public:
     // TalentInfo
     std::list<uint32> m_TalentIDs;
 
-    // Difficulty
-    uint32 DifficultyID;
-
     SpellVisualMap m_SpellVisuals;
 
     // struct access functions
@@ -1419,8 +1419,8 @@ void SpellMgr::LoadSpellRanks()
     {
         for (int difficulty = 0; difficulty < Difficulty::MaxDifficulties; difficulty++)
         {
-            if (mSpellInfoMap[difficulty][itr->first])
-                mSpellInfoMap[difficulty][itr->first]->ChainEntry = NULL;
+            if (SpellInfo* l_SpellInfo = _GetSpellInfo(itr->first, difficulty))
+                l_SpellInfo->ChainEntry = NULL;
         }
     }
     mSpellChains.clear();
@@ -1512,8 +1512,8 @@ void SpellMgr::LoadSpellRanks()
             mSpellChains[addedSpell].rank = itr->second;
             mSpellChains[addedSpell].prev = GetSpellInfo(prevRank);
             for (int difficulty = 0; difficulty < Difficulty::MaxDifficulties; difficulty++)
-                if (mSpellInfoMap[difficulty][addedSpell])
-                    mSpellInfoMap[difficulty][addedSpell]->ChainEntry = &mSpellChains[addedSpell];
+                if (SpellInfo* l_SpellInfo = _GetSpellInfo(addedSpell, difficulty))
+                    l_SpellInfo->ChainEntry = &mSpellChains[addedSpell];
             prevRank = addedSpell;
             ++itr;
             if (itr == rankChain.end())
@@ -3122,8 +3122,8 @@ void SpellMgr::LoadSpellInfoStore()
     uint32 oldMSTime = getMSTime();
 
     UnloadSpellInfoStore();
-    for (int difficulty = 0; difficulty < Difficulty::MaxDifficulties; difficulty++)
-        mSpellInfoMap[difficulty].resize(sSpellStore.GetNumRows(), nullptr);
+    mSpellInfoMap.resize(sSpellStore.GetNumRows(), nullptr);
+    mSpellDifficultyIndex.resize(sSpellStore.GetNumRows(), 0);
 
     for (uint32 l_ID = 0; l_ID < sSpellXSpellVisualStore.GetNumRows(); ++l_ID)
     {
@@ -3134,18 +3134,40 @@ void SpellMgr::LoadSpellInfoStore()
         VisualsBySpellMap[l_Entry->SpellId][l_Entry->DifficultyID].push_back(l_Entry);
     }
 
+    /// Reserve the difficulty slots first, the parallel loop below only fills them
+    for (auto const& l_Itr : mAvaiableDifficultyBySpell)
+    {
+        if (l_Itr.first >= mSpellInfoMap.size() || !sSpellStore.LookupEntry(l_Itr.first))
+            continue;
+
+        for (uint32 l_Difficulty : l_Itr.second)
+        {
+            if (l_Difficulty != DifficultyNone && l_Difficulty < Difficulty::MaxDifficulties)
+                _SetSpellInfo(l_Itr.first, l_Difficulty, nullptr);
+        }
+    }
+
     ParallelFor(0, sSpellStore.GetNumRows(), [this](uint32 l_I) -> void
     {
         if (SpellEntry const* spellEntry = sSpellStore.LookupEntry(l_I))
         {
+            auto l_DifficultyItr = mAvaiableDifficultyBySpell.find(l_I);
+            if (l_DifficultyItr == mAvaiableDifficultyBySpell.end())
+                return;
+
             auto l_Itr = VisualsBySpellMap.find(l_I);
             SpellVisualMap emptyMap;
             SpellVisualMap& visualMap = (l_Itr == VisualsBySpellMap.end()) ? emptyMap : l_Itr->second;
 
-            std::set<uint32> difficultyInfo = mAvaiableDifficultyBySpell[l_I];
+            std::set<uint32> const& difficultyInfo = l_DifficultyItr->second;
+
+            for (std::set<uint32>::const_iterator itr = difficultyInfo.begin(); itr != difficultyInfo.end(); itr++)
+            {
+                if ((*itr) >= Difficulty::MaxDifficulties)
+                    continue;
 
-            for (std::set<uint32>::iterator itr = difficultyInfo.begin(); itr != difficultyInfo.end(); itr++)
-                mSpellInfoMap[(*itr)][l_I] = new SpellInfo(spellEntry, (*itr), std::move(visualMap));
+                _SetSpellInfo(l_I, (*itr), new SpellInfo(spellEntry, (*itr), std::move(visualMap)));
+            }
         }
     });
 
@@ -3157,7 +3179,7 @@ void SpellMgr::LoadSpellInfoStore()
 
         for (int difficulty = 0; difficulty < Difficulty::MaxDifficulties; difficulty++)
         {
-            SpellInfo* spell = mSpellInfoMap[difficulty][spellPower->SpellId];
+            SpellInfo* spell = _GetSpellInfo(spellPower->SpellId, difficulty);
             if (!spell)
                 continue;
 
@@ -3171,7 +3193,7 @@ void SpellMgr::LoadSpellInfoStore()
         if (!l_TalentEntry)
             continue;
 
-        SpellInfo* l_SpellInfo = mSpellInfoMap[DifficultyNone][l_TalentEntry->SpellID];
+        SpellInfo* l_SpellInfo = _GetSpellInfo(l_TalentEntry->SpellID, DifficultyNone);
         if (l_SpellInfo)
             l_SpellInfo->m_TalentIDs.push_back(l_TalentEntry->Id);
 
@@ -3184,30 +3206,73 @@ void SpellMgr::LoadSpellInfoStore()
         }
     }
 
+    /// Memory report, the legacy index was one pointer array per difficulty
+    SpellInfoStoreReport& l_Report = mSpellInfoStoreReport;
+    l_Report = SpellInfoStoreReport();
+
+    for (SpellInfo const* l_SpellInfo : mSpellInfoMap)
+    {
+        if (l_SpellInfo)
+            ++l_Report.SpellInfoCount;
+    }
+
+    for (SpellDifficultyInfos const& l_Infos : mSpellDifficultyInfos)
+    {
+        ++l_Report.DifficultySpellCount;
+        for (SpellInfo const* l_SpellInfo : l_Infos.Infos)
+        {
+            if (l_SpellInfo)
+                ++l_Report.DifficultySpellInfoCount;
+        }
+
+        l_Report.IndexBytes += l_Infos.Infos.capacity() * sizeof(SpellInfo*);
+    }
+
+    l_Report.SpellInfoCount   += l_Report.DifficultySpellInfoCount;
+    l_Report.ObjectBytes       = uint64(l_Report.SpellInfoCount) * sizeof(SpellInfo);
+    l_Report.LegacyIndexBytes  = uint64(mSpellInfoMap.size()) * sizeof(SpellInfo*) * Difficulty::MaxDifficulties;
+    l_Report.IndexBytes       += uint64(mSpellInfoMap.size()) * (sizeof(SpellInfo*) + sizeof(uint32)) + mSpellDifficultyInfos.size() * sizeof(SpellDifficultyInfos);
+
+    sLog->outInfo(LOG_FILTER_SERVER_LOADING, ">> SpellInfo store: %u SpellInfo (%u for %u spells with difficulties), %u KB of objects (%u bytes each), index %u KB (was %u KB)",
+        l_Report.SpellInfoCount, l_Report.DifficultySpellInfoCount, l_Report.DifficultySpellCount, uint32(l_Report.ObjectBytes / 1024), uint32(sizeof(SpellInfo)),
+        uint32(l_Report.IndexBytes / 1024), uint32(l_Report.LegacyIndexBytes / 1024));
+
     sLog->outInfo(LOG_FILTER_SERVER_LOADING, ">> Loaded spell info store in %u ms", GetMSTimeDiffToNow(oldMSTime));
 }
 
 void SpellMgr::UnloadSpellInfoStore()
 {
-    for (int difficulty = 0; difficulty < Difficulty::MaxDifficulties; difficulty++)
+    for (uint32 i = 0; i < mSpellInfoMap.size(); ++i)
     {
-        for (uint32 i = 0; i < mSpellInfoMap[difficulty].size(); ++i)
-        {
-            if (mSpellInfoMap[difficulty][i])
-                delete mSpellInfoMap[difficulty][i];
-        }
-        mSpellInfoMap[difficulty].clear();
+        if (mSpellInfoMap[i])
+            delete mSpellInfoMap[i];
     }
+
+    for (SpellDifficultyInfos& l_Infos : mSpellDifficultyInfos)
+    {
+        for (SpellInfo* l_SpellInfo : l_Infos.Infos)
+            delete l_SpellInfo;
+    }
+
+    mSpellInfoMap.clear();
+    mSpellDifficultyIndex.clear();
+    mSpellDifficultyInfos.clear();
 }
 
 void SpellMgr::UnloadSpellInfoImplicitTargetConditionLists()
 {
-    for (int difficulty = 0; difficulty < Difficulty::MaxDifficulties; difficulty++)
+    for (uint32 i = 0; i < mSpellInfoMap.size(); ++i)
+    {
+        if (mSpellInfoMap[i])
+            mSpellInfoMap[i]->_UnloadImplicitTargetConditionLists();
+    }
+
+    for (SpellDifficultyInfos& l_Infos : mSpellDifficultyInfos)
     {
-        for (uint32 i = 0; i < mSpellInfoMap[difficulty].size(); ++i)
+        for (SpellInfo* l_SpellInfo : l_Infos.Infos)
         {
-            if (mSpellInfoMap[difficulty][i])
-                mSpellInfoMap[difficulty][i]->_UnloadImplicitTargetConditionLists();
+            if (l_SpellInfo)
+                l_SpellInfo->_UnloadImplicitTargetConditionLists();
         }
     }
 }
@@ -3221,7 +3286,7 @@ void SpellMgr::LoadSpellCustomAttr()
     {
         for (int difficulty = 0; difficulty < Difficulty::MaxDifficulties; difficulty++)
         {
-            spellInfo = mSpellInfoMap[difficulty][i];
+            spellInfo = _GetSpellInfo(i, difficulty);
             if (!spellInfo)
                 continue;
 
@@ -6886,7 +6951,7 @@ void SpellMgr::LoadSpellCustomAttr()
                 std::unordered_map<uint32, SpellVisualMap> l_VisualsBySpell;
                 SpellInfo* fishingDummy = new SpellInfo(sSpellStore.LookupEntry(131474), difficulty, std::move(l_VisualsBySpell[spellInfo->Effects[0].TriggerSpell]));
                 fishingDummy->Id = spellInfo->Effects[0].TriggerSpell;
-                mSpellInfoMap[difficulty][spellInfo->Effects[0].TriggerSpell] = fishingDummy;
+                _SetSpellInfo(spellInfo->Effects[0].TriggerSpell, difficulty, fishingDummy);
                 break;
             }
             /// Mogu'shan Vault
@@ -7860,7 +7925,7 @@ const SpellInfo* SpellMgr::GetSpellInfo(uint32 p_SpellID, Difficulty p_Difficult
             DifficultyEntry const* l_Difficulty = sDifficultyStore.LookupEntry(p_Difficulty);
             while (l_Difficulty != nullptr)
             {
-                SpellInfo const* l_SpellInfo = mSpellInfoMap[l_Difficulty->ID][p_SpellID];
+                SpellInfo const* l_SpellInfo = _GetSpellInfo(p_SpellID, l_Difficulty->ID);
                 if (l_SpellInfo != nullptr)
                     return l_SpellInfo;
 
@@ -7868,12 +7933,48 @@ const SpellInfo* SpellMgr::GetSpellInfo(uint32 p_SpellID, Difficulty p_Difficult
             }
         }
 
-        return mSpellInfoMap[DifficultyNone][p_SpellID];
+        return mSpellInfoMap[p_SpellID];
     }
 
     return nullptr;
 }
 
+SpellInfo* SpellMgr::_GetSpellInfo(uint32 p_SpellID, uint32 p_Difficulty) const
+{
+    if (p_SpellID >= mSpellInfoMap.size())
+        return nullptr;
+
+    if (p_Difficulty == DifficultyNone)
+        return mSpellInfoMap[p_SpellID];
+
+    uint32 l_Index = mSpellDifficultyIndex[p_SpellID];
+    if (!l_Index)
+        return nullptr;
+
+    return mSpellDifficultyInfos[l_Index - 1].Get(p_Difficulty);
+}
+
+void SpellMgr::_SetSpellInfo(uint32 p_SpellID, uint32 p_Difficulty, SpellInfo* p_SpellInfo)
+{
+    if (p_SpellID >= mSpellInfoMap.size())
+        return;
+
+    if (p_Difficulty == DifficultyNone)
+    {
+        mSpellInfoMap[p_SpellID] = p_SpellInfo;
+        return;
+    }
+
+    uint32& l_Index = mSpellDifficultyIndex[p_SpellID];
+    if (!l_Index)
+    {
+        mSpellDifficultyInfos.push_back(SpellDifficultyInfos());
+        l_Index = mSpellDifficultyInfos.size();
+    }
+
+    mSpellDifficultyInfos[l_Index - 1].Set(p_Difficulty, p_SpellInfo);
+}
+
 int64 SpellMgr::GetSpellVisualOverride(uint32 p_SpellID) const
 {
     switch (p_SpellID)
@@ -568,6 +568,59 @@ typedef std::vector<bool> EnchantCustomAttribute;
 
 typedef std::vector<SpellInfo*> SpellInfoMap;
 
+/// SpellInfo of the difficulties of a spell other than DifficultyNone, most spells have none
+struct SpellDifficultyInfos
+{
+    SpellDifficultyInfos() : DifficultyMask(0) { }
+
+    SpellInfo* Get(uint32 p_Difficulty) const
+    {
+        if (!(DifficultyMask & (1 << p_Difficulty)))
+            return nullptr;
+
+        return Infos[GetSlot(p_Difficulty)];
+    }
+
+    void Set(uint32 p_Difficulty, SpellInfo* p_SpellInfo)
+    {
+        if (DifficultyMask & (1 << p_Difficulty))
+        {
+            Infos[GetSlot(p_Difficulty)] = p_SpellInfo;
+            return;
+        }
+
+        Infos.insert(Infos.begin() + GetSlot(p_Difficulty), p_SpellInfo);
+        DifficultyMask |= 1 << p_Difficulty;
+    }
+
+    /// Infos are ordered by difficulty, the slot is the number of lower difficulties present
+    uint32 GetSlot(uint32 p_Difficulty) const
+    {
+        uint32 l_LowerMask = DifficultyMask & ((1 << p_Difficulty) - 1);
+        uint32 l_Slot = 0;
+        for (; l_LowerMask; l_LowerMask &= l_LowerMask - 1)
+            ++l_Slot;
+
+        return l_Slot;
+    }
+
+    uint32 DifficultyMask;
+    std::vector<SpellInfo*> Infos;
+};
+
+/// Memory used by the SpellInfo store, logged at startup and shown by .debug stats spellstore
+struct SpellInfoStoreReport
+{
+    SpellInfoStoreReport() : SpellInfoCount(0), DifficultySpellInfoCount(0), DifficultySpellCount(0), ObjectBytes(0), LegacyIndexBytes(0), IndexBytes(0) { }
+
+    uint32 SpellInfoCount;
+    uint32 DifficultySpellInfoCount;    ///< SpellInfo for a difficulty other than DifficultyNone
+    uint32 DifficultySpellCount;        ///< Spells with at least one difficulty SpellInfo
+    uint64 ObjectBytes;
+    uint64 LegacyIndexBytes;            ///< One pointer per spell and per difficulty
+    uint64 IndexBytes;
+};
+
 typedef std::map<int32, std::vector<int32> > SpellLinkedMap;
 
 bool IsPrimaryProfessionSkill(uint32 skill);
@@ -708,7 +761,8 @@ class SpellMgr
         // SpellInfo object management
         SpellInfo const* GetSpellInfo(uint32 spellId, Difficulty difficulty = DifficultyNone) const;
         int64 GetSpellVisualOverride(uint32 p_SpellID) const;
-        uint32 GetSpellInfoStoreSize() const { return mSpellInfoMap[DifficultyNone].size(); }
+        uint32 GetSpellInfoStoreSize() const { return mSpellInfoMap.size(); }
+        SpellInfoStoreReport const& GetSpellInfoStoreReport() const { return mSpellInfoStoreReport; }
         std::set<uint32> GetSpellClassList(uint8 ClassID) const { return mSpellClassInfo[ClassID]; }
         std::list<uint32> GetSpellPowerList(uint32 spellId) const { return mSpellPowerInfo[spellId]; }
         TalentsPlaceHoldersSpell GetTalentPlaceHoldersSpell() const { return mPlaceHolderSpells; }
@@ -824,6 +878,10 @@ class SpellMgr
         std::vector<uint32>        mSpellCreateItemList;
 
     private:
+        /// Exact lookup, without difficulty fallback
+        SpellInfo* _GetSpellInfo(uint32 p_SpellID, uint32 p_Difficulty) const;
+        void _SetSpellInfo(uint32 p_SpellID, uint32 p_Difficulty, SpellInfo* p_SpellInfo);
+
         SpellDifficultySearcherMap mSpellDifficultySearcherMap;
         SpellChainMap              mSpellChains;
         SpellsRequiringSpellMap    mSpellsReqSpell;
@@ -851,7 +909,10 @@ class SpellMgr
         SkillLineAbilityMap        mSkillLineAbilityMap;
         PetLevelupSpellMap         mPetLevelupSpellMap;
         PetDefaultSpellsMap        mPetDefaultSpellsMap;           // only spells not listed in related mPetLevelupSpellMap entry
-        SpellInfoMap               mSpellInfoMap[Difficulty::MaxDifficulties];
+        SpellInfoMap               mSpellInfoMap;                  // DifficultyNone
+        std::vector<uint32>        mSpellDifficultyIndex;          // index + 1 in mSpellDifficultyInfos, 0 if the spell has no difficulty SpellInfo
+        std::vector<SpellDifficultyInfos> mSpellDifficultyInfos;
+        SpellInfoStoreReport       mSpellInfoStoreReport;
         SpellClassList             mSpellClassInfo;
         SpecializatioPerkMap       mSpecializationPerks;
         TalentSpellSet             mTalentSpellInfo;
@@ -19,6 +19,10 @@
 
 namespace Vignette
 {
+    std::atomic<uint64> Manager::s_PositionPushes(0);
+    std::atomic<uint64> Manager::s_UpdatesSent(0);
+    std::atomic<int64>  Manager::s_UnitSourcedVignettes(0);
+
     Manager::Manager(Player const* p_Player)
     {
         m_Owner = p_Player;
@@ -29,7 +33,13 @@ namespace Vignette
         m_Owner = nullptr;
 
         for (auto l_Iterator : m_Vignettes)
+        {
+            /// The creature drops the tracker itself on its next relocation
+            if (IS_UNIT_GUID(l_Iterator.second->GeSourceGuid()))
+                s_UnitSourcedVignettes--;
+
             delete l_Iterator.second;
+        }
     }
 
     Vignette::Entity* Manager::CreateAndAddVignette(VignetteEntry const* p_VignetteEntry, uint32 const p_MapId, Vignette::Type const p_VignetteType, G3D::Vector3 const p_Position, uint64 const p_SourceGuid)
@@ -48,6 +58,15 @@ namespace Vignette
         m_Vignettes.insert(std::make_pair(l_Vignette->GetGuid(), l_Vignette));
         m_AddedVignette.insert(l_Vignette->GetGuid());
 
+        /// The creature pushes its position to the vignette when it moves
+        if (IS_UNIT_GUID(p_SourceGuid))
+        {
+            s_UnitSourcedVignettes++;
+
+            if (Creature* l_SourceCreature = sObjectAccessor->FindCreature(p_SourceGuid))
+                l_SourceCreature->AddVignetteTracker(m_Owner->GetGUID());
+        }
+
         return l_Vignette;
     }
 
@@ -60,9 +79,11 @@ namespace Vignette
         {
             if (l_Iterator->second->GetVignetteEntry()->Id == p_VignetteEntry->Id)
             {
+                uint64 l_SourceGuid = l_Iterator->second->GeSourceGuid();
                 delete l_Iterator->second;
                 m_RemovedVignette.insert(l_Iterator->first);
                 l_Iterator = m_Vignettes.erase(l_Iterator);
+                UntrackSource(l_SourceGuid);
                 continue;
             }
 
@@ -76,9 +97,11 @@ namespace Vignette
         {
             if (p_Lamba(l_Iterator->second))
             {
+                uint64 l_SourceGuid = l_Iterator->second->GeSourceGuid();
                 delete l_Iterator->second;
                 m_RemovedVignette.insert(l_Iterator->first);
                 l_Iterator = m_Vignettes.erase(l_Iterator);
+                UntrackSource(l_SourceGuid);
                 continue;
             }
 
@@ -86,6 +109,32 @@ namespace Vignette
         }
     }
 
+    bool Manager::HasVignetteFromSource(uint64 p_SourceGuid) const
+    {
+        for (auto l_Iterator : m_Vignettes)
+        {
+            if (l_Iterator.second->GeSourceGuid() == p_SourceGuid)
+                return true;
+        }
+
+        return false;
+    }
+
+    void Manager::UntrackSource(uint64 p_SourceGuid)
+    {
+        if (!IS_UNIT_GUID(p_SourceGuid))
+            return;
+
+        s_UnitSourcedVignettes--;
+
+        /// Another vignette of the player may still follow the same creature
+        if (HasVignetteFromSource(p_SourceGuid))
+            return;
+
+        if (Creature* l_SourceCreature = ObjectAccessor::GetCreature(*m_Owner, p_SourceGuid))
+            l_SourceCreature->RemoveVignetteTracker(m_Owner->GetGUID());
+    }
+
     void Manager::SendVignetteUpdateToClient()
     {
         WorldPacket l_Data(SMSG_VIGNETTE_UPDATE);
@@ -156,21 +205,30 @@ namespace Vignette
         m_UpdatedVignette.clear();
 
         m_Owner->GetSession()->SendPacket(&l_Data);
+        s_UpdatesSent++;
     }
 
     void Manager::Update()
     {
+        /// Send update to client if needed
+        if (!m_AddedVignette.empty() || !m_UpdatedVignette.empty() || !m_RemovedVignette.empty())
+            SendVignetteUpdateToClient();
+    }
+
+    bool Manager::OnSourceRelocated(Creature const* p_Source)
+    {
+        bool l_Tracked = false;
+
         for (auto l_Iterator : m_Vignettes)
         {
             auto l_Vignette = l_Iterator.second;
+            if (l_Vignette->GeSourceGuid() != p_Source->GetGUID())
+                continue;
 
-            /// - Update the position of the vignette if vignette is linked to a creature
-            if (IS_UNIT_GUID(l_Vignette->GeSourceGuid()))
-            {
-                Creature* l_SourceCreature = sObjectAccessor->FindCreature(l_Vignette->GeSourceGuid());
-                if (l_SourceCreature != nullptr)
-                    l_Vignette->UpdatePosition(G3D::Vector3(l_SourceCreature->GetPositionX(), l_SourceCreature->GetPositionY(), l_SourceCreature->GetPositionZ()));
-            }
+            l_Tracked = true;
+            s_PositionPushes++;
+
+            l_Vignette->UpdatePosition(G3D::Vector3(p_Source->GetPositionX(), p_Source->GetPositionY(), p_Source->GetPositionZ()));
 
             if (l_Vignette->NeedClientUpdate())
             {
@@ -179,9 +237,7 @@ namespace Vignette
             }
         }
 
-        /// Send update to client if needed
-        if (!m_AddedVignette.empty() || !m_UpdatedVignette.empty() || !m_RemovedVignette.empty())
-            SendVignetteUpdateToClient();
+        return l_Tracked;
     }
     
     template <class T>
@@ -12,6 +12,8 @@
 # include "Common.h"
 # include "Vignette.hpp"
 
+# include <atomic>
+
 class WorldObject;
 class GameObject;
 class Creature;
@@ -58,11 +60,25 @@ namespace Vignette
             */
             void DestroyAndRemoveVignettes(std::function < bool(Vignette::Entity* const)> p_Lamba);
 
+            /**
+            * Check if one of the vignettes of the manager follows the specified source
+            * @param p_SourceGuid : Guid of the source
+            */
+            bool HasVignetteFromSource(uint64 p_SourceGuid) const;
+
             /**
             * Update the vignette manager, send vignette update to client if needed
+            * Nothing is polled, positions are pushed by OnSourceRelocated
             */
             void Update();
 
+            /**
+            * Call by Creature::UpdateVignettePositions when a creature followed by a vignette of the player is relocated
+            * @param p_Source : The relocated creature
+            * @return false if the player has no vignette following the creature anymore
+            */
+            bool OnSourceRelocated(Creature const* p_Source);
+
             /**
             * Call by Player::UpdateVisibilityOf
             * Hook to handle vignettes linked to WorldObjects
@@ -86,11 +102,23 @@ namespace Vignette
             */
             void SendVignetteUpdateToClient();
 
+            /**
+            * Called once a vignette is removed, stop the source creature from pushing its position to the owner
+            * @param p_SourceGuid : Source of the removed vignette
+            */
+            void UntrackSource(uint64 p_SourceGuid);
+
             Player const*                m_Owner;                      ///< Player for who we handle the vignettes
             VignetteContainer            m_Vignettes;                  ///< Contains all the vignette the player can see
             std::set<uint64>             m_RemovedVignette;            ///< Contains all the removed vignettes to send to client at the next SMSG_VIGNETTE_UPDATE
             std::set<uint64>             m_AddedVignette;              ///< Contains all the added vignettes to send to client at the next SMSG_VIGNETTE_UPDATE
             std::set<uint64>             m_UpdatedVignette;            ///< Contains all the updated vignettes to send to client at the next SMSG_VIGNETTE_UPDATE
+
+        public:
+
+            static std::atomic<uint64>   s_PositionPushes;             ///< Creature relocations pushed to a vignette, for .debug stats schedule
+            static std::atomic<uint64>   s_UpdatesSent;                ///< SMSG_VIGNETTE_UPDATE sent, for .debug stats schedule
+            static std::atomic<int64>    s_UnitSourcedVignettes;       ///< Vignettes following a creature, Creature::AddToWorld skips the tracker lookup when none exist
     };
 }
 
@@ -94,6 +94,9 @@
 #include "MMapFactory.h"
 #include "TaxiPathGraph.h"
 #include "ChatLexicsCutter.h"
+#include "ObjectPool.h"
+#include "WorldLoader.h"
+#include <chrono>
 #include <ctime>
 
 uint32 gOnlineGameMaster = 0;
@@ -662,6 +665,16 @@ void World::LoadConfigSettings(bool reload)
     m_bool_configs[CONFIG_PRESERVE_CUSTOM_CHANNELS] = ConfigMgr::GetBoolDefault("PreserveCustomChannels", false);
     m_int_configs[CONFIG_PRESERVE_CUSTOM_CHANNEL_DURATION] = ConfigMgr::GetIntDefault("PreserveCustomChannelDuration", 14);
     m_bool_configs[CONFIG_GRID_UNLOAD] = ConfigMgr::GetBoolDefault("GridUnload", true);
+    m_int_configs[CONFIG_GRID_UNLOAD_MAX_PER_UPDATE] = ConfigMgr::GetIntDefault("GridUnload.MaxPerUpdate", 4);
+    m_bool_configs[CONFIG_GRID_LOADING_DEFERRED] = ConfigMgr::GetBoolDefault("GridLoading.Deferred", true);
+    m_int_configs[CONFIG_GRID_LOADING_OBJECTS_PER_UPDATE] = ConfigMgr::GetIntDefault("GridLoading.ObjectsPerUpdate", 150);
+    m_int_configs[CONFIG_GRID_LOADING_TIME_BUDGET] = ConfigMgr::GetIntDefault("GridLoading.TimeBudget", 10);
+    m_bool_configs[CONFIG_OBJECT_POOL_ENABLED] = ConfigMgr::GetBoolDefault("ObjectPool.Enable", true);
+    m_int_configs[CONFIG_OBJECT_POOL_MAX_FREE_BLOCKS] = ConfigMgr::GetIntDefault("ObjectPool.MaxFreeBlocks", 512);
+    m_int_configs[CONFIG_OBJECT_POOL_MAX_FREE_MEMORY] = ConfigMgr::GetIntDefault("ObjectPool.MaxFreeMemory", 64);
+    ObjectPoolMgr::SetEnabled(m_bool_configs[CONFIG_OBJECT_POOL_ENABLED]);
+    ObjectPoolMgr::SetMaxFreeBlocks(m_int_configs[CONFIG_OBJECT_POOL_MAX_FREE_BLOCKS]);
+    ObjectPoolMgr::SetMaxFreeBytes(uint64(m_int_configs[CONFIG_OBJECT_POOL_MAX_FREE_MEMORY]) * 1024 * 1024);
     m_int_configs[CONFIG_INTERVAL_SAVE] = ConfigMgr::GetIntDefault("PlayerSaveInterval", 15 * MINUTE * IN_MILLISECONDS);
     m_int_configs[CONFIG_INTERVAL_DISCONNECT_TOLERANCE] = ConfigMgr::GetIntDefault("DisconnectToleranceInterval", 0);
     m_bool_configs[CONFIG_STATS_SAVE_ONLY_ON_LOGOUT] = ConfigMgr::GetBoolDefault("PlayerSave.Stats.SaveOnlyOnLogout", true);
@@ -704,6 +717,13 @@ void World::LoadConfigSettings(bool reload)
 
     m_int_configs[CONFIG_SOCKET_TIMEOUTTIME] = ConfigMgr::GetIntDefault("SocketTimeOutTime", 900000);
     m_int_configs[CONFIG_SESSION_ADD_DELAY] = ConfigMgr::GetIntDefault("SessionAddDelay", 10000);
+    m_int_configs[CONFIG_SESSION_MAX_PACKETS_PER_UPDATE] = std::max(ConfigMgr::GetIntDefault("Session.MaxPacketsPerUpdate", 50), 1);
+    m_int_configs[CONFIG_SESSION_UPDATE_BUDGET] = ConfigMgr::GetIntDefault("Session.UpdateBudget", 0);
+    m_int_configs[CONFIG_SESSION_WORKER_BATCH_SIZE] = ConfigMgr::GetIntDefault("Session.WorkerBatchSize", 100);
+
+    /// Opcodes are registered after the first load of the config
+    if (reload)
+        LoadOpcodeLimits();
 
     m_float_configs[CONFIG_GROUP_XP_DISTANCE] = ConfigMgr::GetFloatDefault("MaxGroupXPDistance", 74.0f);
     m_float_configs[CONFIG_INSTANCE_GROUP_XP_DISTANCE] = ConfigMgr::GetFloatDefault("MaxInstanceGroupXPDistance", 150.0f);
@@ -1197,6 +1217,8 @@ void World::LoadConfigSettings(bool reload)
 
     Visibility_RelocationLowerLimit = ConfigMgr::GetFloatDefault("Visibility.RelocationLowerLimit", 20.0f);
     Visibility_AINotifyDelay = ConfigMgr::GetFloatDefault("Visibility.AINotifyDelay", 1000);
+    m_bool_configs[CONFIG_VISIBILITY_DYNAMIC_ENABLED] = ConfigMgr::GetBoolDefault("Visibility.Dynamic.Enable", true);
+    m_int_configs[CONFIG_VISIBILITY_DYNAMIC_COST_PER_LEVEL] = ConfigMgr::GetIntDefault("Visibility.Dynamic.CostPerLevel", 3000);
 
     //visibility in instances
     m_MaxVisibleDistanceInInstances = ConfigMgr::GetFloatDefault("Visibility.Distance.Instances", DEFAULT_VISIBILITY_INSTANCE);
@@ -1311,6 +1333,8 @@ void World::LoadConfigSettings(bool reload)
     m_int_configs[CONFIG_INTERVAL_LOG_UPDATE] = ConfigMgr::GetIntDefault("RecordUpdateTimeDiffInterval", 60000);
     m_int_configs[CONFIG_MIN_LOG_UPDATE] = ConfigMgr::GetIntDefault("MinRecordUpdateTimeDiff", 100);
     m_int_configs[CONFIG_NUMTHREADS] = ConfigMgr::GetIntDefault("MapUpdate.Threads", 1);
+    m_int_configs[CONFIG_LOADING_THREADS] = ConfigMgr::GetIntDefault("Loading.Threads", 4);
+    m_bool_configs[CONFIG_WORLD_SNAPSHOT_ENABLED] = ConfigMgr::GetBoolDefault("WorldSnapshot.Enable", false);
     m_int_configs[CONFIG_MAX_RESULTS_LOOKUP_COMMANDS] = ConfigMgr::GetIntDefault("Command.LookupMaxResults", 0);
 
     // chat logging
@@ -1462,6 +1486,9 @@ void World::LoadConfigSettings(bool reload)
     // Specialization check at spell cast (as it may breaks spells)
     m_bool_configs[CONFIG_DISABLE_SPELL_SPECIALIZATION_CHECK] = ConfigMgr::GetBoolDefault("DisableSpellSpecializationCheck", false);
 
+    // .debug bench commands, they block the calling thread
+    m_bool_configs[CONFIG_DEBUG_BENCHMARKS] = ConfigMgr::GetBoolDefault("Debug.Benchmarks", false);
+
     m_int_configs[CONFIG_ACCOUNT_BIND_ALLOWED_GROUP_MASK] = ConfigMgr::GetIntDefault("AccountBind.AllowedGroupRealmMask", 0x7FFFFFFF);
     m_int_configs[CONFIG_ACCOUNT_BIND_GROUP_MASK] = ConfigMgr::GetIntDefault("AccountBind.GroupRealmMask", 1);
     m_int_configs[CONFIG_ACCOUNT_BIND_SHOP_GROUP_MASK] = ConfigMgr::GetIntDefault("AccountBind.ShopGroupMask", 0x7FFFFFFF);
@@ -1482,15 +1509,16 @@ void World::LoadConfigSettings(bool reload)
 
     // Load Lexics Cutter
     m_lexicsCutter = new LexicsCutter();
-    m_lexicsCutter->ReadLetterAnalogs(fn_analogsfile);
-    m_lexicsCutter->ReadInnormativeWords(fn_wordsfile);
-    m_lexicsCutter->MapInnormativeWords();
 
-    // read additional parameters
+    // read additional parameters, the words are compiled with them
     m_lexicsCutter->IgnoreLetterRepeat = ConfigMgr::GetBoolDefault("LexicsCutterIgnoreRepeats", true);
     m_lexicsCutter->IgnoreMiddleSpaces = ConfigMgr::GetBoolDefault("LexicsCutterIgnoreSpaces", true);
     m_lexicsCutter->CheckLetterContains = ConfigMgr::GetBoolDefault("LexicsCutterCheckContains", false);
 
+    m_lexicsCutter->ReadLetterAnalogs(fn_analogsfile);
+    m_lexicsCutter->ReadInnormativeWords(fn_wordsfile);
+    m_lexicsCutter->MapInnormativeWords();
+
 #ifndef CROSS
     // InterRealm settings
     m_bool_configs[CONFIG_INTERREALM_ENABLE] = ConfigMgr::GetBoolDefault("InterRealm.Enabled", false);
@@ -1509,6 +1537,7 @@ void World::SetInitialWorldSettings()
 {
     ///- Server startup begin
     uint32 startupBegin = getMSTime();
+    WorldLoader l_Loader;
 
     ///- Initialize the random number generator
     srand((unsigned int)time(NULL));
@@ -1527,6 +1556,16 @@ void World::SetInitialWorldSettings()
     ///- Initialize config settings
     LoadConfigSettings();
 
+    ///- Bulk loaders read their rows from the previous start snapshot while the world database is unchanged
+    if (getBoolConfig(CONFIG_WORLD_SNAPSHOT_ENABLED))
+    {
+        std::string l_SnapshotDirectory = ConfigMgr::GetStringDefault("WorldSnapshot.Directory", "");
+        if (l_SnapshotDirectory.empty())
+            l_SnapshotDirectory = m_dataPath + "snapshots";
+
+        WorldDatabase.EnableSnapshots(l_SnapshotDirectory);
+    }
+
     ///- Load Motd from database
     LoadDBMotd();
 
@@ -1562,7 +1601,7 @@ void World::SetInitialWorldSettings()
 
     ///- Loading strings. Getting no records means core load has to be canceled because no error message can be output.
 
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Trinity strings...");
+    l_Loader.Begin("Loading Trinity strings...");
     if (!sObjectMgr->LoadTrinityStrings())
         exit(1);                                            // Error message displayed in function already
 
@@ -1577,62 +1616,62 @@ void World::SetInitialWorldSettings()
 #endif
 
     ///- Load the DBC files
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Initialize data stores...");
+    l_Loader.Begin("Initialize data stores...");
     LoadDBCStores(m_dataPath);
     LoadDB2Stores(m_dataPath);
     DetectDBCLang();
 
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Initialize Spell Difficulty ...");
+    l_Loader.Begin("Initialize Spell Difficulty ...");
     sSpellMgr->InitializeSpellDifficulty();
 
     /// Load weighted graph on taxi nodes path
     sTaxiPathGraph.Initialize();
 
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading SpellInfo store...");
+    l_Loader.Begin("Loading SpellInfo store...");
     sSpellMgr->LoadSpellInfoStore();
 
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading TalentSpellInfo store....");
+    l_Loader.Begin("Loading TalentSpellInfo store....");
     sSpellMgr->LoadTalentSpellInfo();
 
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading SpellPowerInfo store....");
+    l_Loader.Begin("Loading SpellPowerInfo store....");
     sSpellMgr->LoadSpellPowerInfo();
 
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading SkillLineAbilityMultiMap Data...");
+    l_Loader.Begin("Loading SkillLineAbilityMultiMap Data...");
     sSpellMgr->LoadSkillLineAbilityMap();
 
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Spell custom attributes...");
+    l_Loader.Begin("Loading Spell custom attributes...");
     sSpellMgr->LoadSpellCustomAttr();
 
     if (sWorld->getBoolConfig(CONFIG_ENABLE_RESEARCH_SITE_LOAD))
     {
-        sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Research Site Zones...");
+        l_Loader.Begin("Loading Research Site Zones...");
         sObjectMgr->LoadResearchSiteZones();
 
-        sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Research Site Loot...");
+        l_Loader.Begin("Loading Research Site Loot...");
         sObjectMgr->LoadResearchSiteLoot();
     }
 
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading GameObject models...");
+    l_Loader.Begin("Loading GameObject models...");
     LoadGameObjectModelList();
 
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Script Names...");
+    l_Loader.Begin("Loading Script Names...");
     sObjectMgr->LoadScriptNames();
 
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Instance Template...");
+    l_Loader.Begin("Loading Instance Template...");
     sObjectMgr->LoadInstanceTemplate();
 
     // Must be called before `creature_respawn`/`gameobject_respawn` tables
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading instances...");
+    l_Loader.Begin("Loading instances...");
     sInstanceSaveMgr->LoadInstances();
 
     uint32 oldMSTime = getMSTime();
 
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Creature Texts...");
+    l_Loader.Begin("Loading Creature Texts...");
     sCreatureTextMgr->LoadCreatureTexts();
 
     if (sWorld->getBoolConfig(CONFIG_ENABLE_LOCALES))
     {
-        sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Localization strings...");
+        l_Loader.Begin("Loading Localization strings...");
         sObjectMgr->LoadCreatureLocales();
         sObjectMgr->LoadGameObjectLocales();
         sObjectMgr->LoadQuestLocales();
@@ -1641,81 +1680,81 @@ void World::SetInitialWorldSettings()
         sObjectMgr->LoadGossipMenuItemsLocales();
         sObjectMgr->LoadPointOfInterestLocales();
 
-        sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Creature Text Locales...");
+        l_Loader.Begin("Loading Creature Text Locales...");
         sCreatureTextMgr->LoadCreatureTextLocales();
     }
 
     sObjectMgr->SetDBCLocaleIndex(GetDefaultDbcLocale());        // Get once for all the locale index of DBC language (console/broadcasts)
     sLog->outInfo(LOG_FILTER_SERVER_LOADING, ">> Localization strings loaded in %u ms", GetMSTimeDiffToNow(oldMSTime));
 
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Page Texts...");
+    l_Loader.Begin("Loading Page Texts...");
     sObjectMgr->LoadPageTexts();
 
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Game Object Templates...");         // must be after LoadPageTexts
+    l_Loader.Begin("Loading Game Object Templates...");         // must be after LoadPageTexts
     sObjectMgr->LoadGameObjectTemplate();
 
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Garrison Plot Building Content...");
+    l_Loader.Begin("Loading Garrison Plot Building Content...");
     sObjectMgr->LoadGarrisonPlotBuildingContent();
 
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Npc Recipes Conditions...");
+    l_Loader.Begin("Loading Npc Recipes Conditions...");
     sObjectMgr->LoadNpcRecipesConditions();
 
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Transport templates...");
+    l_Loader.Begin("Loading Transport templates...");
     sTransportMgr->LoadTransportTemplates();
 
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Spell Rank Data...");
+    l_Loader.Begin("Loading Spell Rank Data...");
     sSpellMgr->LoadSpellRanks();
 
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Spell Required Data...");
+    l_Loader.Begin("Loading Spell Required Data...");
     sSpellMgr->LoadSpellRequired();
 
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Spell Group types...");
+    l_Loader.Begin("Loading Spell Group types...");
     sSpellMgr->LoadSpellGroups();
 
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Spell Learn Skills...");
+    l_Loader.Begin("Loading Spell Learn Skills...");
     sSpellMgr->LoadSpellLearnSkills();                           // must be after LoadSpellRanks
 
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Spell Learn Spells...");
+    l_Loader.Begin("Loading Spell Learn Spells...");
     sSpellMgr->LoadSpellLearnSpells();
 
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Spell Proc Event conditions...");
+    l_Loader.Begin("Loading Spell Proc Event conditions...");
     sSpellMgr->LoadSpellProcEvents();
 
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Spell Proc conditions and data...");
+    l_Loader.Begin("Loading Spell Proc conditions and data...");
     sSpellMgr->LoadSpellProcs();
 
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Spell Bonus Data...");
+    l_Loader.Begin("Loading Spell Bonus Data...");
     sSpellMgr->LoadSpellBonusess();
 
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Aggro Spells Definitions...");
+    l_Loader.Begin("Loading Aggro Spells Definitions...");
     sSpellMgr->LoadSpellThreats();
 
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Spell Group Stack Rules...");
+    l_Loader.Begin("Loading Spell Group Stack Rules...");
     sSpellMgr->LoadSpellGroupStackRules();
 
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading forbidden spells...");
+    l_Loader.Begin("Loading forbidden spells...");
     sSpellMgr->LoadForbiddenSpells();
 
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Spell Phase Dbc Info...");
+    l_Loader.Begin("Loading Spell Phase Dbc Info...");
     sObjectMgr->LoadSpellPhaseInfo();
 
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading NPC Texts...");
+    l_Loader.Begin("Loading NPC Texts...");
     sObjectMgr->LoadGossipText();
 
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Enchant Spells Proc datas...");
+    l_Loader.Begin("Loading Enchant Spells Proc datas...");
     sSpellMgr->LoadSpellEnchantProcData();
 
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Item Random Enchantments Table...");
+    l_Loader.Begin("Loading Item Random Enchantments Table...");
     LoadRandomEnchantmentsTable();
 
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Disables");
+    l_Loader.Begin("Loading Disables");
     DisableMgr::LoadDisables();                                                             // must be before loading quests and items
 
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Items...");                           ///< must be after LoadRandomEnchantmentsTable and LoadPageTexts
+    l_Loader.Begin("Loading Items...");                           ///< must be after LoadRandomEnchantmentsTable and LoadPageTexts
     sObjectMgr->LoadItemTemplates();
     sObjectMgr->LoadItemTemplateCorrections();
 
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Item set names...");                  ///< must be after LoadItemPrototypes
+    l_Loader.Begin("Loading Item set names...");                  ///< must be after LoadItemPrototypes
     sObjectMgr->LoadItemTemplateAddon();
 
     sLog->outInfo(LOG_FILTER_GENERAL, "Loading Item Scripts...");                           ///< must be after LoadItemPrototypes
@@ -1736,175 +1775,175 @@ void World::SetInitialWorldSettings()
     sLog->outInfo(LOG_FILTER_GENERAL, "Loading Item Bonus Group Linked...");                ///< must be after LoadItemPrototypes
     sObjectMgr->LoadItemBonusGroupLinked();
 
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Creature Model Based Info Data...");
+    l_Loader.Begin("Loading Creature Model Based Info Data...");
     sObjectMgr->LoadCreatureModelInfo();
 
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Creature templates...");
+    l_Loader.Begin("Loading Creature templates...");
     sObjectMgr->LoadCreatureTemplates();
 
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Equipment templates...");             // Must be after LoadCreatureTemplate
+    l_Loader.Begin("Loading Equipment templates...");             // Must be after LoadCreatureTemplate
     sObjectMgr->LoadEquipmentTemplates();
 
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Creature templates difficulties...");
+    l_Loader.Begin("Loading Creature templates difficulties...");
     sObjectMgr->LoadCreatureTemplatesDifficulties();
 
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Creature template addons...");
+    l_Loader.Begin("Loading Creature template addons...");
     sObjectMgr->LoadCreatureTemplateAddons();
 
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Reputation Reward Rates...");
+    l_Loader.Begin("Loading Reputation Reward Rates...");
     sObjectMgr->LoadReputationRewardRate();
 
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Currency Loot Templates...");
+    l_Loader.Begin("Loading Currency Loot Templates...");
     sObjectMgr->LoadCurrencyOnKill();
 
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Currency Loot Templates Personnal...");
+    l_Loader.Begin("Loading Currency Loot Templates Personnal...");
     sObjectMgr->LoadPersonnalCurrencyOnKill();
 
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Creature Reputation OnKill Data...");
+    l_Loader.Begin("Loading Creature Reputation OnKill Data...");
     sObjectMgr->LoadReputationOnKill();
 
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Reputation Spillover Data...");
+    l_Loader.Begin("Loading Reputation Spillover Data...");
     sObjectMgr->LoadReputationSpilloverTemplate();
 
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Points Of Interest Data...");
+    l_Loader.Begin("Loading Points Of Interest Data...");
     sObjectMgr->LoadPointsOfInterest();
 
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Creature Base Stats...");
+    l_Loader.Begin("Loading Creature Base Stats...");
     sObjectMgr->LoadCreatureClassLevelStats();
 
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Creature Group Size Stats...");
+    l_Loader.Begin("Loading Creature Group Size Stats...");
     sObjectMgr->LoadCreatureGroupSizeStats();
 
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Creature Data...");
+    l_Loader.Begin("Loading Creature Data...");
     sObjectMgr->LoadCreatures();
 
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Temporary Summon Data...");
+    l_Loader.Begin("Loading Temporary Summon Data...");
     sObjectMgr->LoadTempSummons();                               // must be after LoadCreatureTemplates() and LoadGameObjectTemplates()
 
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading pet levelup spells...");
+    l_Loader.Begin("Loading pet levelup spells...");
     sSpellMgr->LoadPetLevelupSpellMap();
 
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading pet default spells additional to levelup spells...");
+    l_Loader.Begin("Loading pet default spells additional to levelup spells...");
     sSpellMgr->LoadPetDefaultSpells();
 
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Creature Addon Data...");
+    l_Loader.Begin("Loading Creature Addon Data...");
     sObjectMgr->LoadCreatureAddons();                            // must be after LoadCreatureTemplates() and LoadCreatures()
 
     if (sWorld->getBoolConfig(CONFIG_ENABLE_GAMEOBJECTS))
     {
-        sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Gameobject Data...");
+        l_Loader.Begin("Loading Gameobject Data...");
         sObjectMgr->LoadGameobjects();
     }
 
     if (sWorld->getBoolConfig(CONFIG_ENABLE_QUEST))
     {
-        sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Creature Linked Respawn...");
+        l_Loader.Begin("Loading Creature Linked Respawn...");
         sObjectMgr->LoadLinkedRespawn();                             // must be after LoadCreatures(), LoadGameObjects()
 
-        sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Weather Data...");
+        l_Loader.Begin("Loading Weather Data...");
         WeatherMgr::LoadWeatherData();
 
-        sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Quests...");
+        l_Loader.Begin("Loading Quests...");
         sObjectMgr->LoadQuests();                                    // must be loaded after DBCs, creature_template, item_template, gameobject tables
 
-        sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Checking Quest Disables");
+        l_Loader.Begin("Checking Quest Disables");
         DisableMgr::CheckQuestDisables();                           // must be after loading quests
 
-        sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Quest Objectives...");
+        l_Loader.Begin("Loading Quest Objectives...");
         sObjectMgr->LoadQuestObjectives();
 
-        sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Quest Objective Locales...");
+        l_Loader.Begin("Loading Quest Objective Locales...");
         sObjectMgr->LoadQuestObjectiveLocales();
 
-        sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Quest POI");
+        l_Loader.Begin("Loading Quest POI");
         sObjectMgr->LoadQuestPOI();
 
-        sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Quests Relations...");
+        l_Loader.Begin("Loading Quests Relations...");
         sObjectMgr->LoadQuestRelations();                            // must be after quest load
     }
 
     if (!sWorld->getBoolConfig(CONFIG_ENABLE_ONLY_SPECIFIC_MAP))
     {
-        sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Objects Pooling Data...");
+        l_Loader.Begin("Loading Objects Pooling Data...");
         sPoolMgr->LoadFromDB();
 
-        sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Game Event Data...");               // must be after loading pools fully
+        l_Loader.Begin("Loading Game Event Data...");               // must be after loading pools fully
         sGameEventMgr->LoadFromDB();
     }
 
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading UNIT_NPC_FLAG_SPELLCLICK Data..."); // must be after LoadQuests
+    l_Loader.Begin("Loading UNIT_NPC_FLAG_SPELLCLICK Data..."); // must be after LoadQuests
     sObjectMgr->LoadNPCSpellClickSpells();
 
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Vehicle Template Accessories...");
+    l_Loader.Begin("Loading Vehicle Template Accessories...");
     sObjectMgr->LoadVehicleTemplateAccessories();                // must be after LoadCreatureTemplates() and LoadNPCSpellClickSpells()
 
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Vehicle Accessories...");
+    l_Loader.Begin("Loading Vehicle Accessories...");
     sObjectMgr->LoadVehicleAccessories();                       // must be after LoadCreatureTemplates() and LoadNPCSpellClickSpells()
 
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Dungeon boss data...");
+    l_Loader.Begin("Loading Dungeon boss data...");
     sObjectMgr->LoadInstanceEncounters();
 
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading LFG rewards...");
+    l_Loader.Begin("Loading LFG rewards...");
     sLFGMgr->LoadRewards();
 
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading LFG entrance positions...");
+    l_Loader.Begin("Loading LFG entrance positions...");
     sLFGMgr->LoadEntrancePositions();
 
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading SpellArea Data...");                // must be after quest load
+    l_Loader.Begin("Loading SpellArea Data...");                // must be after quest load
     sSpellMgr->LoadSpellAreas();
 
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Spell Classes Info...");
+    l_Loader.Begin("Loading Spell Classes Info...");
     sSpellMgr->LoadSpellClassInfo();
 
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Talent Place Holder spell...");
+    l_Loader.Begin("Loading Talent Place Holder spell...");
     sSpellMgr->LoadSpellPlaceHolder();
 
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading AreaTrigger definitions...");
+    l_Loader.Begin("Loading AreaTrigger definitions...");
     sObjectMgr->LoadAreaTriggerTeleports();
 
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Access Requirements...");
+    l_Loader.Begin("Loading Access Requirements...");
     sObjectMgr->LoadAccessRequirements();                        // must be after item template load
 
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading LFR Access Requirements...");
+    l_Loader.Begin("Loading LFR Access Requirements...");
     sObjectMgr->LoadLFRAccessRequirements();
 
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Quest Area Triggers...");
+    l_Loader.Begin("Loading Quest Area Triggers...");
     sObjectMgr->LoadQuestAreaTriggers();                         // must be after LoadQuests
 
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Tavern Area Triggers...");
+    l_Loader.Begin("Loading Tavern Area Triggers...");
     sObjectMgr->LoadTavernAreaTriggers();
 
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading AreaTrigger script names...");
+    l_Loader.Begin("Loading AreaTrigger script names...");
     sObjectMgr->LoadAreaTriggerScripts();
 
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Graveyard-zone links...");
+    l_Loader.Begin("Loading Graveyard-zone links...");
     sObjectMgr->LoadGraveyardZones();
 
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading spell pet auras...");
+    l_Loader.Begin("Loading spell pet auras...");
     sSpellMgr->LoadSpellPetAuras();
 
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Spell target coordinates...");
+    l_Loader.Begin("Loading Spell target coordinates...");
     sSpellMgr->LoadSpellTargetPositions();
 
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading enchant custom attributes...");
+    l_Loader.Begin("Loading enchant custom attributes...");
     sSpellMgr->LoadEnchantCustomAttr();
 
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading linked spells...");
+    l_Loader.Begin("Loading linked spells...");
     sSpellMgr->LoadSpellLinked();
 
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading spells upgrade item stage...");
+    l_Loader.Begin("Loading spells upgrade item stage...");
     sSpellMgr->LoadSpellUpgradeItemStage();
 
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading spells invalid...");
+    l_Loader.Begin("Loading spells invalid...");
     sObjectMgr->LoadSpellInvalid();
 
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading spells stolen...");
+    l_Loader.Begin("Loading spells stolen...");
     sObjectMgr->LoadSpellStolen();
 
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading disabled rankings...");
+    l_Loader.Begin("Loading disabled rankings...");
     sObjectMgr->LoadDisabledEncounters();
 
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading conversation templates...");
+    l_Loader.Begin("Loading conversation templates...");
     sObjectMgr->LoadConversationTemplates();
 
 #ifndef CROSS
@@ -1912,163 +1951,159 @@ void World::SetInitialWorldSettings()
     LoadCharacterInfoStore();
 #endif
 
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Player Create Data...");
+    l_Loader.Begin("Loading Player Create Data...");
     sObjectMgr->LoadPlayerInfo();
 
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Exploration BaseXP Data...");
+    l_Loader.Begin("Loading Exploration BaseXP Data...");
     sObjectMgr->LoadExplorationBaseXP();
 
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Pet Name Parts...");
+    l_Loader.Begin("Loading Pet Name Parts...");
     sObjectMgr->LoadPetNames();
 
 #ifndef CROSS
     CharacterDatabaseCleaner::CleanDatabase();
 #endif
 
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading the max pet number...");
+    l_Loader.Begin("Loading the max pet number...");
     sObjectMgr->LoadPetNumber();
 
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading pet stats...");
+    l_Loader.Begin("Loading pet stats...");
     sObjectMgr->LoadPetStatInfo();
 
 #ifndef CROSS
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Player Corpses...");
+    l_Loader.Begin("Loading Player Corpses...");
     sObjectMgr->LoadCorpses();
 #endif
 
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Player level dependent mail rewards...");
+    l_Loader.Begin("Loading Player level dependent mail rewards...");
     sObjectMgr->LoadMailLevelRewards();
 
 
+    ///- Loaders below only read the templates loaded above and fill their own stores, they run concurrently
     if (sWorld->getBoolConfig(CONFIG_ENABLE_LOOTS))
     {
-        // Loot tables
-        LoadLootTables();
-    }
-
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Skill Discovery Table...");
-    LoadSkillDiscoveryTable();
-
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Skill Extra Item Table...");
-    LoadSkillExtraItemTable();
-
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Skill Fishing base level requirements...");
-    sObjectMgr->LoadFishingBaseSkillLevel();
+        l_Loader.AddTask("Creature loot templates",      LoadLootTemplates_Creature);
+        l_Loader.AddTask("Fishing loot templates",       LoadLootTemplates_Fishing);
+        l_Loader.AddTask("Gameobject loot templates",    LoadLootTemplates_Gameobject);
+        l_Loader.AddTask("Item loot templates",          LoadLootTemplates_Item);
+        l_Loader.AddTask("Mail loot templates",          LoadLootTemplates_Mail);
+        l_Loader.AddTask("Milling loot templates",       LoadLootTemplates_Milling);
+        l_Loader.AddTask("Pickpocketing loot templates", LoadLootTemplates_Pickpocketing);
+        l_Loader.AddTask("Skinning loot templates",      LoadLootTemplates_Skinning);
+        l_Loader.AddTask("Disenchant loot templates",    LoadLootTemplates_Disenchant);
+        l_Loader.AddTask("Prospecting loot templates",   LoadLootTemplates_Prospecting);
+        l_Loader.AddTask("Spell loot templates",         LoadLootTemplates_Spell);
+
+        /// Checks the references of all the other loot stores
+        l_Loader.AddTask("Reference loot templates", LoadLootTemplates_Reference,
+        {
+            "Creature loot templates", "Fishing loot templates", "Gameobject loot templates", "Item loot templates", "Mail loot templates", "Milling loot templates",
+            "Pickpocketing loot templates", "Skinning loot templates", "Disenchant loot templates", "Prospecting loot templates", "Spell loot templates"
+        });
 
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Achievements...");
-    sAchievementMgr->LoadAchievementReferenceList();
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Achievement Criteria Lists...");
-    sAchievementMgr->LoadAchievementCriteriaList();
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Achievement Criteria Data...");
-    sAchievementMgr->LoadAchievementCriteriaData();
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Achievement Rewards...");
-    sAchievementMgr->LoadRewards();
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Achievement Reward Locales...");
-    sAchievementMgr->LoadRewardLocales();
+        l_Loader.AddTask("Loading GameObjects for quests...", [] { sObjectMgr->LoadGameObjectForQuests(); }, { "Gameobject loot templates" });
+    }
+    else
+        l_Loader.AddTask("Loading GameObjects for quests...", [] { sObjectMgr->LoadGameObjectForQuests(); });
+
+    l_Loader.AddTask("Loading Skill Discovery Table...", LoadSkillDiscoveryTable);
+    l_Loader.AddTask("Loading Skill Extra Item Table...", LoadSkillExtraItemTable);
+    l_Loader.AddTask("Loading Skill Fishing base level requirements...", [] { sObjectMgr->LoadFishingBaseSkillLevel(); });
+
+    l_Loader.AddTask("Loading Achievements...",                    [] { sAchievementMgr->LoadAchievementReferenceList(); });
+    l_Loader.AddTask("Loading Achievement Criteria Lists...",      [] { sAchievementMgr->LoadAchievementCriteriaList(); }, { "Loading Achievements..." });
+    l_Loader.AddTask("Loading Achievement Criteria Data...",       [] { sAchievementMgr->LoadAchievementCriteriaData(); }, { "Loading Achievement Criteria Lists..." });
+    l_Loader.AddTask("Loading Achievement Rewards...",             [] { sAchievementMgr->LoadRewards(); },                 { "Loading Achievements..." });
+    l_Loader.AddTask("Loading Achievement Reward Locales...",      [] { sAchievementMgr->LoadRewardLocales(); },           { "Loading Achievement Rewards..." });
+
+    l_Loader.AddTask("Loading BattleMasters...",       [] { sBattlegroundMgr->LoadBattleMastersEntry(); });
+    l_Loader.AddTask("Loading GameTeleports...",       [] { sObjectMgr->LoadGameTele(); });
+    l_Loader.AddTask("Loading Gossip menu...",         [] { sObjectMgr->LoadGossipMenu(); });
+    l_Loader.AddTask("Loading Gossip menu options...", [] { sObjectMgr->LoadGossipMenuItems(); });
+    l_Loader.AddTask("Loading Vendors...",             [] { sObjectMgr->LoadVendors(); });          // must be after load CreatureTemplate and ItemTemplate
+    l_Loader.AddTask("Loading Trainers...",            [] { sObjectMgr->LoadTrainerSpell(); });     // must be after load CreatureTemplate
+    l_Loader.AddTask("Loading Waypoints...",           [] { sWaypointMgr->Load(); });
+    l_Loader.AddTask("Loading SmartAI Waypoints...",   [] { sSmartWaypointMgr->LoadFromDB(); });
+    l_Loader.AddTask("Loading Creature Formations...", [] { sFormationMgr->LoadCreatureFormations(); });
+
+    /// One synchronous connection per loader thread, the pool is sized for the running realm
+    WorldDatabase.ReserveSynchConnections(uint8(std::min<uint32>(getIntConfig(CONFIG_LOADING_THREADS), 255)));
+    l_Loader.RunTasks(getIntConfig(CONFIG_LOADING_THREADS));
+    WorldDatabase.ReleaseSynchConnections();
 
 #ifndef CROSS
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Completed Achievements...");
+    l_Loader.Begin("Loading Completed Achievements...");
     sAchievementMgr->LoadCompletedAchievements();
 
     // Delete expired auctions before loading
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Deleting expired auctions...");
+    l_Loader.Begin("Deleting expired auctions...");
     sAuctionMgr->DeleteExpiredAuctionsAtStartup();
 
     ///- Load dynamic data tables from the database
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Item Auctions...");
+    l_Loader.Begin("Loading Item Auctions...");
     sAuctionMgr->LoadAuctionItems();
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Auctions...");
+    l_Loader.Begin("Loading Auctions...");
     sAuctionMgr->LoadAuctions();
 
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Guild rewards...");
+    l_Loader.Begin("Loading Guild rewards...");
     sGuildMgr->LoadGuildRewards();
 
     sGuildMgr->LoadGuilds();
 
     sGuildFinderMgr->LoadFromDB();
 
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Groups...");
+    l_Loader.Begin("Loading Groups...");
     sGroupMgr->LoadGroups();
 
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading ReservedNames...");
+    l_Loader.Begin("Loading ReservedNames...");
     sObjectMgr->LoadReservedPlayersNames();
 #endif
 
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading GameObjects for quests...");
-    sObjectMgr->LoadGameObjectForQuests();
-
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading BattleMasters...");
-    sBattlegroundMgr->LoadBattleMastersEntry();
-
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading GameTeleports...");
-    sObjectMgr->LoadGameTele();
-
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Gossip menu...");
-    sObjectMgr->LoadGossipMenu();
-
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Gossip menu options...");
-    sObjectMgr->LoadGossipMenuItems();
-
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Vendors...");
-    sObjectMgr->LoadVendors();                                   // must be after load CreatureTemplate and ItemTemplate
-
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Trainers...");
-    sObjectMgr->LoadTrainerSpell();                              // must be after load CreatureTemplate
-
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Waypoints...");
-    sWaypointMgr->Load();
-
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading SmartAI Waypoints...");
-    sSmartWaypointMgr->LoadFromDB();
-
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Creature Formations...");
-    sFormationMgr->LoadCreatureFormations();
-
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading World States...");              // must be loaded before battleground, outdoor PvP and conditions
+    l_Loader.Begin("Loading World States...");              // must be loaded before battleground, outdoor PvP and conditions
     LoadWorldStates();
 
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Phase definitions...");
+    l_Loader.Begin("Loading Phase definitions...");
     sObjectMgr->LoadPhaseDefinitions();
 
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Conditions...");
+    l_Loader.Begin("Loading Conditions...");
     sConditionMgr->LoadConditions();
 
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading faction change achievement pairs...");
+    l_Loader.Begin("Loading faction change achievement pairs...");
     sObjectMgr->LoadFactionChangeAchievements();
 
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading faction change spell pairs...");
+    l_Loader.Begin("Loading faction change spell pairs...");
     sObjectMgr->LoadFactionChangeSpells();
 
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading faction change item pairs...");
+    l_Loader.Begin("Loading faction change item pairs...");
     sObjectMgr->LoadFactionChangeItems();
 
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading faction change reputation pairs...");
+    l_Loader.Begin("Loading faction change reputation pairs...");
     sObjectMgr->LoadFactionChangeReputations();
 
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading faction change title pairs...");
+    l_Loader.Begin("Loading faction change title pairs...");
     sObjectMgr->LoadFactionChangeTitles();
 
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading faction change title pairs...");
+    l_Loader.Begin("Loading faction change title pairs...");
     sObjectMgr->LoadFactionChangeQuests();
 
 #ifndef CROSS
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading GM tickets...");
+    l_Loader.Begin("Loading GM tickets...");
     sTicketMgr->LoadTickets();
 
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading GM surveys...");
+    l_Loader.Begin("Loading GM surveys...");
     sTicketMgr->LoadSurveys();
 #endif
 
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading client addons...");
+    l_Loader.Begin("Loading client addons...");
     AddonMgr::LoadFromDB();
 
 #ifndef CROSS
     ///- Handle outdated emails (delete/return)
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Returning old mails...");
+    l_Loader.Begin("Returning old mails...");
     sObjectMgr->ReturnOrDeleteOldMails(false);
 #endif
 
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Autobroadcasts...");
+    l_Loader.Begin("Loading Autobroadcasts...");
     LoadAutobroadcasts();
 
     ///- Load and initialize scripts
@@ -2079,53 +2114,53 @@ void World::SetInitialWorldSettings()
     sObjectMgr->LoadEventScripts();                              // must be after load Creature/Gameobject(Template/Data)
     sObjectMgr->LoadWaypointScripts();
 
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Scripts text locales...");      // must be after Load*Scripts calls
+    l_Loader.Begin("Loading Scripts text locales...");      // must be after Load*Scripts calls
     sObjectMgr->LoadDbScriptStrings();
 
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading spell script names...");
+    l_Loader.Begin("Loading spell script names...");
     sObjectMgr->LoadSpellScriptNames();
 
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Initializing Scripts...");
+    l_Loader.Begin("Initializing Scripts...");
     sScriptMgr->Initialize();
     sScriptMgr->OnConfigLoad(false);                                // must be done after the ScriptMgr has been properly initialized
 
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Validating spell scripts...");
+    l_Loader.Begin("Validating spell scripts...");
     sObjectMgr->ValidateSpellScripts();
 
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading SmartAI scripts...");
+    l_Loader.Begin("Loading SmartAI scripts...");
     sSmartScriptMgr->LoadSmartAIFromDB();
 
 #ifndef CROSS
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Calendar data...");
+    l_Loader.Begin("Loading Calendar data...");
     sCalendarMgr->LoadFromDB();
 #endif
 
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Cinematic path ...");
+    l_Loader.Begin("Loading Cinematic path ...");
     sCinematicSequenceMgr->Load();
 
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading AreaTrigger templates...");
+    l_Loader.Begin("Loading AreaTrigger templates...");
     sObjectMgr->LoadAreaTriggerTemplates();
 
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading AreaTrigger move splines...");
+    l_Loader.Begin("Loading AreaTrigger move splines...");
     sObjectMgr->LoadAreaTriggerMoveSplines();
 
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading AreaTrigger move templates...");
+    l_Loader.Begin("Loading AreaTrigger move templates...");
     sObjectMgr->LoadAreaTriggerMoveTemplates();
 
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading FollowerQuests...");
+    l_Loader.Begin("Loading FollowerQuests...");
     sObjectMgr->LoadFollowerQuests();
 
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Bonus quest...");
+    l_Loader.Begin("Loading Bonus quest...");
     sObjectMgr->LoadBonusQuests();
 
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading QuestForItem...");
+    l_Loader.Begin("Loading QuestForItem...");
     sObjectMgr->LoadQuestForItem();
 
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Spell Auras Not Save...");
+    l_Loader.Begin("Loading Spell Auras Not Save...");
     sSpellMgr->LoadSpellAurasNotSave();
 
     ///- Initialize game time and timers
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Initialize game time and timers");
+    l_Loader.Begin("Initialize game time and timers");
     m_gameTime = time(NULL);
     m_startTime = m_gameTime;
 
@@ -2170,14 +2205,14 @@ void World::SetInitialWorldSettings()
     AIRegistry::Initialize();
 
     ///- Initialize MapManager
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Starting Map System");
+    l_Loader.Begin("Starting Map System");
     sMapMgr->Initialize();
 
     ///- Initialize Battlegrounds
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Starting Battleground System");
+    l_Loader.Begin("Starting Battleground System");
     sBattlegroundMgr->CreateInitialBattlegrounds();
 
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Starting Game Event system...");
+    l_Loader.Begin("Starting Game Event system...");
     uint32 nextGameEvent = sGameEventMgr->StartSystem();
     m_timers[WUPDATE_EVENTS].SetInterval(nextGameEvent);    //depend on next event
 
@@ -2189,7 +2224,7 @@ void World::SetInitialWorldSettings()
     // Delete all custom channels which haven't been used for PreserveCustomChannelDuration days.
     Channel::CleanOldChannelsInDB();
 
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Starting Arena Season...");
+    l_Loader.Begin("Starting Arena Season...");
     sGameEventMgr->StartArenaSeason();
 
 #ifndef CROSS
@@ -2199,57 +2234,58 @@ void World::SetInitialWorldSettings()
     //sBattlegroundMgr->InitAutomaticArenaPointDistribution();
 
     ///- Initialize outdoor pvp
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Starting Outdoor PvP System");
+    l_Loader.Begin("Starting Outdoor PvP System");
     sOutdoorPvPMgr->InitOutdoorPvP();
 
     ///- Initialize Battlefield
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Starting Battlefield System");
+    l_Loader.Begin("Starting Battlefield System");
     sBattlefieldMgr->InitBattlefield();
 
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Transports...");
+    l_Loader.Begin("Loading Transports...");
     sTransportMgr->SpawnContinentTransports();
 
     ///- Initialize Warden
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Warden Checks...");
+    l_Loader.Begin("Loading Warden Checks...");
     sWardenCheckMgr->LoadWardenChecks();
 
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Warden Action Overrides...");
+    l_Loader.Begin("Loading Warden Action Overrides...");
     sWardenCheckMgr->LoadWardenOverrides();
 
 #ifndef CROSS
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Deleting expired bans...");
+    l_Loader.Begin("Deleting expired bans...");
     LoginDatabase.Execute("DELETE FROM ip_banned WHERE unbandate <= UNIX_TIMESTAMP() AND unbandate<>bandate");      // One-time query
 #endif
 
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Calculate next daily quest reset time...");
+    l_Loader.Begin("Calculate next daily quest reset time...");
     InitDailyQuestResetTime();
 
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Calculate next weekly quest reset time...");
+    l_Loader.Begin("Calculate next weekly quest reset time...");
     InitWeeklyQuestResetTime();
 
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Calculate next monthly quest reset time...");
+    l_Loader.Begin("Calculate next monthly quest reset time...");
     InitMonthlyQuestResetTime();
 
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Calculate random battleground reset time...");
+    l_Loader.Begin("Calculate random battleground reset time...");
     InitRandomBGResetTime();
 
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Calculate next currency reset time...");
+    l_Loader.Begin("Calculate next currency reset time...");
     InitCurrencyResetTime();
 
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Calculate next daily loot reset time...");
+    l_Loader.Begin("Calculate next daily loot reset time...");
     InitDailyLootResetTime();
 
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Calculate next weekly guild challenges reset time...");
+    l_Loader.Begin("Calculate next weekly guild challenges reset time...");
     InitGuildChallengesResetTime();
 
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Calculate next weekly boss looted reset time...");
+    l_Loader.Begin("Calculate next weekly boss looted reset time...");
     InitBossLootedResetTime();
 
     sLog->outInfo(LOG_FILTER_GENERAL, "Initializing Opcodes...");
     InitOpcodes();
+    LoadOpcodeLimits();
 
 #ifdef CROSS
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading InterRealm config...");
+    l_Loader.Begin("Loading InterRealm config...");
     sInterRealmMgr->LoadConfig();
 #endif
 
@@ -2283,29 +2319,29 @@ void World::SetInitialWorldSettings()
     sLog->outInfo(LOG_FILTER_GENERAL, "Loading area skip update...");
     sObjectMgr->LoadSkipUpdateZone();
 
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading BattlePet template...");
+    l_Loader.Begin("Loading BattlePet template...");
     sObjectMgr->LoadBattlePetTemplate();
 
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading BattlePet npc team member...");
+    l_Loader.Begin("Loading BattlePet npc team member...");
     sObjectMgr->LoadBattlePetNpcTeamMember();
     ///sObjectMgr->ComputeBattlePetSpawns();
 
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Wild BattlePet pools...");
+    l_Loader.Begin("Loading Wild BattlePet pools...");
     sWildBattlePetMgr->Load();
 
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading character template data...");
+    l_Loader.Begin("Loading character template data...");
     sObjectMgr->LoadCharacterTemplateData();
 
 #ifndef CROSS
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading realm completed challenges...");
+    l_Loader.Begin("Loading realm completed challenges...");
     sObjectMgr->LoadRealmCompletedChallenges();
 #endif
 
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading challenge mode rewards...");
+    l_Loader.Begin("Loading challenge mode rewards...");
     sObjectMgr->LoadChallengeRewards();
 
 #ifndef CROSS
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Init Garrison shipment manager...");
+    l_Loader.Begin("Init Garrison shipment manager...");
     sGarrisonShipmentManager->Init();
 
     PlayerDump::LoadColumnsName();
@@ -2317,6 +2353,12 @@ void World::SetInitialWorldSettings()
 
     InitServerAutoRestartTime();
 
+    l_Loader.End();
+    l_Loader.LogReport();
+
+    if (ResultSnapshotStore const* l_Snapshots = WorldDatabase.GetSnapshots())
+        l_Snapshots->LogStats();
+
     uint32 startupDuration = GetMSTimeDiffToNow(startupBegin);
 
     QueryResult l_Result = LoginDatabase.PQuery("SELECT max(id) FROM account_log_ip");
@@ -2751,6 +2793,14 @@ void World::Update(uint32 diff)
     sTimeDiffMgr->Update(diff);
 
     sScriptMgr->OnWorldUpdate(diff);
+
+    /// Tunneled packets of the whole tick (sessions, maps, battlegrounds, pet battles, LFG...) go out together
+#ifdef CROSS
+    sInterRealmMgr->FlushTunnelBatches();
+#else
+    if (InterRealmSession* tunnel = GetInterRealmSession())
+        tunnel->FlushTunnelBatch();
+#endif
 }
 
 void World::ForceGameEventUpdate()
@@ -3430,6 +3480,10 @@ void World::UpdateSessions(uint32 diff)
         AddNewSession(sess->GetAccountId());
     }
 
+    UpdateSessionWorkers();
+
+    auto l_SerialStart = std::chrono::steady_clock::now();
+
     ///- Then send an update signal to remaining ones
     for (SessionMap::iterator itr = m_sessions.begin(), next; itr != m_sessions.end(); itr = next)
     {
@@ -3450,9 +3504,103 @@ void World::UpdateSessions(uint32 diff)
 
         }
     }
+
+    uint32 l_SerialTime = uint32(std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - l_SerialStart).count());
+    ++m_SessionUpdateStats.Updates;
+    m_SessionUpdateStats.SerialTime += l_SerialTime;
+    m_SessionUpdateStats.MaxSerialTime = std::max(m_SessionUpdateStats.MaxSerialTime, l_SerialTime);
 #endif
 }
 
+#ifndef CROSS
+void SessionWorkerBatches::Start(uint32 p_Count)
+{
+    std::lock_guard<std::mutex> l_Guard(Lock);
+    Pending = p_Count;
+}
+
+void SessionWorkerBatches::Finish()
+{
+    std::lock_guard<std::mutex> l_Guard(Lock);
+
+    if (--Pending == 0)
+        Condition.notify_all();
+}
+
+void SessionWorkerBatches::Wait()
+{
+    std::unique_lock<std::mutex> l_Lock(Lock);
+
+    while (Pending > 0)
+        Condition.wait(l_Lock);
+}
+
+/// Handles the thread safe packets of a batch of sessions on a MapUpdater thread
+class SessionUpdateRequest : public MapUpdaterTask
+{
+    public:
+        SessionUpdateRequest(MapUpdater* p_Updater, SessionWorkerBatches* p_Batches, WorldSession* const* p_Sessions, uint32 p_Count)
+            : MapUpdaterTask(p_Updater), m_Batches(p_Batches), m_Sessions(p_Sessions), m_Count(p_Count)
+        {
+        }
+
+        void call() override
+        {
+            for (uint32 l_I = 0; l_I < m_Count; ++l_I)
+                m_Sessions[l_I]->UpdateThreadSafePackets();
+
+            m_Batches->Finish();
+            UpdateFinished();
+        }
+
+    private:
+        SessionWorkerBatches* m_Batches;
+        WorldSession* const* m_Sessions;
+        uint32 m_Count;
+};
+
+/// The maps are not updating during World::UpdateSessions and a session is only given to one batch,
+/// so the handlers of different sessions can run at the same time as long as they only use their session
+void World::UpdateSessionWorkers()
+{
+    uint32 l_BatchSize = getIntConfig(CONFIG_SESSION_WORKER_BATCH_SIZE);
+    MapUpdater* l_Updater = sMapMgr->GetMapUpdater();
+    if (!l_BatchSize || !l_Updater->activated())
+        return;
+
+    auto l_Start = std::chrono::steady_clock::now();
+
+    m_WorkerSessions.clear();
+    for (SessionMap::const_iterator l_Itr = m_sessions.begin(); l_Itr != m_sessions.end(); ++l_Itr)
+    {
+        /// The thread safe packets of the players in world are handled by their map
+        Player* l_Player = l_Itr->second->GetPlayer();
+        if (!l_Player || !l_Player->IsInWorld())
+            m_WorkerSessions.push_back(l_Itr->second);
+    }
+
+    if (m_WorkerSessions.empty())
+        return;
+
+    uint32 l_SessionCount = uint32(m_WorkerSessions.size());
+    m_SessionWorkerBatches.Start((l_SessionCount + l_BatchSize - 1) / l_BatchSize);
+
+    for (uint32 l_Index = 0; l_Index < l_SessionCount; l_Index += l_BatchSize)
+    {
+        uint32 l_Count = std::min<uint32>(l_BatchSize, l_SessionCount - l_Index);
+        l_Updater->schedule_specific(new SessionUpdateRequest(l_Updater, &m_SessionWorkerBatches, &m_WorkerSessions[l_Index], l_Count));
+    }
+
+    /// Only the session batches are waited for, the grid loads queued on the same threads keep running
+    m_SessionWorkerBatches.Wait();
+
+    uint32 l_WorkerTime = uint32(std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - l_Start).count());
+    m_SessionUpdateStats.WorkerSessions += m_WorkerSessions.size();
+    m_SessionUpdateStats.WorkerTime += l_WorkerTime;
+    m_SessionUpdateStats.MaxWorkerTime = std::max(m_SessionUpdateStats.MaxWorkerTime, l_WorkerTime);
+}
+#endif
+
 // This handles the issued and queued CLI commands
 void World::ProcessCliCommands()
 {
@@ -4178,7 +4326,7 @@ void World::UpdatePhaseDefinitions()
 #endif
 }
 
-bool World::ModerateMessage(std::string l_Text)
+bool World::ModerateMessage(std::string const& l_Text) const
 {
     if (!m_lexicsCutter)
         return false;
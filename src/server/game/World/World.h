@@ -27,6 +27,8 @@
 #endif
 
 #include <atomic>
+#include <condition_variable>
+#include <mutex>
 
 class Object;
 class WorldPacket;
@@ -99,6 +101,10 @@ enum WorldBoolConfigs
     CONFIG_ALLOW_PLAYER_COMMANDS,
     CONFIG_CLEAN_CHARACTER_DB,
     CONFIG_GRID_UNLOAD,
+    CONFIG_GRID_LOADING_DEFERRED,
+    CONFIG_OBJECT_POOL_ENABLED,
+    CONFIG_WORLD_SNAPSHOT_ENABLED,
+    CONFIG_VISIBILITY_DYNAMIC_ENABLED,
     CONFIG_STATS_SAVE_ONLY_ON_LOGOUT,
     CONFIG_ALLOW_TWO_SIDE_ACCOUNTS,
     CONFIG_ALLOW_TWO_SIDE_INTERACTION_CALENDAR,
@@ -209,6 +215,7 @@ enum WorldBoolConfigs
     CONFIG_LOG_PACKETS,
     CONFIG_BATTLEPAY_ENABLE,
     CONFIG_DISABLE_SPELL_SPECIALIZATION_CHECK,
+    CONFIG_DEBUG_BENCHMARKS,
 #ifndef CROSS
     CONFIG_INTERREALM_ENABLE,
     CONFIG_IGNORE_RESEARCH_SITE,
@@ -253,11 +260,20 @@ enum WorldIntConfigs
     CONFIG_INTERVAL_SAVE,
     CONFIG_INTERVAL_GRIDCLEAN,
     CONFIG_INTERVAL_MAPUPDATE,
+    CONFIG_GRID_LOADING_OBJECTS_PER_UPDATE,
+    CONFIG_GRID_LOADING_TIME_BUDGET,
+    CONFIG_GRID_UNLOAD_MAX_PER_UPDATE,
+    CONFIG_OBJECT_POOL_MAX_FREE_BLOCKS,
+    CONFIG_OBJECT_POOL_MAX_FREE_MEMORY,
+    CONFIG_VISIBILITY_DYNAMIC_COST_PER_LEVEL,
     CONFIG_INTERVAL_CHANGEWEATHER,
     CONFIG_INTERVAL_DISCONNECT_TOLERANCE,
     CONFIG_PORT_WORLD,
     CONFIG_SOCKET_TIMEOUTTIME,
     CONFIG_SESSION_ADD_DELAY,
+    CONFIG_SESSION_MAX_PACKETS_PER_UPDATE,
+    CONFIG_SESSION_UPDATE_BUDGET,
+    CONFIG_SESSION_WORKER_BATCH_SIZE,
     CONFIG_GAME_TYPE,
     CONFIG_REALM_ZONE,
     CONFIG_STRICT_PLAYER_NAMES,
@@ -367,6 +383,7 @@ enum WorldIntConfigs
     CONFIG_ENABLE_SINFO_LOGIN,
     CONFIG_PLAYER_ALLOW_COMMANDS,
     CONFIG_NUMTHREADS,
+    CONFIG_LOADING_THREADS,
     CONFIG_LOGDB_CLEARINTERVAL,
     CONFIG_LOGDB_CLEARTIME,
     CONFIG_CLIENTCACHE_VERSION,
@@ -690,6 +707,34 @@ struct MotdText
     std::string TextRU;
 };
 
+/// Wall time of World::UpdateSessions, see .debug stats sessions. The handler time per opcode group is in the opcode table (OpcodeHandler::Stats)
+struct SessionUpdateStats
+{
+    SessionUpdateStats() : Updates(0), WorkerSessions(0), WorkerTime(0), SerialTime(0), MaxWorkerTime(0), MaxSerialTime(0) {}
+
+    uint64 Updates;
+    uint64 WorkerSessions;                                  ///< Sessions handed to the workers, summed over the updates
+    uint64 WorkerTime;                                      ///< In microseconds, thread safe packets of the sessions not on a map
+    uint64 SerialTime;                                      ///< In microseconds, the regular WorldSession::Update of every session
+    uint32 MaxWorkerTime;
+    uint32 MaxSerialTime;
+};
+
+/// Session batches handed to the MapUpdater threads by one World::UpdateSessionWorkers call.
+/// Counted apart from MapUpdater::wait(), which would also wait for the grid loads queued on the same threads.
+struct SessionWorkerBatches
+{
+    SessionWorkerBatches() : Pending(0) {}
+
+    void Start(uint32 p_Count);
+    void Finish();
+    void Wait();
+
+    std::mutex Lock;
+    std::condition_variable Condition;
+    uint32 Pending;
+};
+
 /// The World
 class World
 {
@@ -735,6 +780,7 @@ class World
         uint32 GetActiveAndQueuedSessionCount() const { return uint32(m_sessions.size() * getRate(RATE_ONLINE)); }
         uint32 GetActiveSessionCount() const { return uint32((m_sessions.size() - m_QueuedPlayer.size()) * getRate(RATE_ONLINE)); }
         uint32 GetQueuedSessionCount() const { return m_QueuedPlayer.size(); }
+        SessionUpdateStats const& GetSessionUpdateStats() const { return m_SessionUpdateStats; }
 
         BanReturn BanAccount(BanMode mode, std::string nameOrIP, std::string duration, std::string reason, std::string author);
         bool RemoveBanAccount(BanMode mode, std::string nameOrIP);
@@ -1001,7 +1047,8 @@ class World
         uint32 GetRecordDiff(RecordDiffType recordDiff) { return m_recordDiff[recordDiff]; }
 
 
-        bool ModerateMessage(std::string l_Text);
+        bool ModerateMessage(std::string const& l_Text) const;
+        LexicsCutter const* GetLexicsCutter() const { return m_lexicsCutter; }
 
         //////////////////////////////////////////////////////////////////////////
         /// New callback system
@@ -1105,6 +1152,12 @@ class World
         //Player Queue
         Queue m_QueuedPlayer;
 
+        /// Handle the PROCESS_THREADSAFE_SESSION packets of the sessions not on a map on the MapUpdater threads
+        void UpdateSessionWorkers();
+        std::vector<WorldSession*> m_WorkerSessions;        ///< Reused between the updates
+        SessionWorkerBatches m_SessionWorkerBatches;
+        SessionUpdateStats m_SessionUpdateStats;
+
         // sessions that are added async
         void AddSession_(WorldSession* s);
         ACE_Based::LockedQueue<WorldSession*, ACE_Thread_Mutex> addSessQueue;
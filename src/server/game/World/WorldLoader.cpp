@@ -0,0 +1,256 @@
+////////////////////////////////////////////////////////////////////////////////
+//
+//  MILLENIUM-STUDIO
+//  Copyright 2016 Millenium-studio SARL
+//  All Rights Reserved.
+//
+////////////////////////////////////////////////////////////////////////////////
+
+#include "WorldLoader.h"
+#include "DatabaseEnv.h"
+#include "Log.h"
+#include "Timer.h"
+#include "Util.h"
+
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+
+/// Slowest loaders listed by the boot report
+#define WORLD_LOADER_REPORT_SLOWEST 15
+
+WorldLoader::WorldLoader() : m_BeginTime(getMSTime()), m_CurrentStep(-1), m_StepStartPeakMemory(0)
+{
+}
+
+uint32 WorldLoader::AddNode(char const* p_Name, bool p_Parallel)
+{
+    uint32 l_Index = uint32(m_Nodes.size());
+
+    m_Nodes.push_back(Node());
+
+    Node& l_Node = m_Nodes.back();
+    l_Node.Name         = p_Name;
+    l_Node.Parallel     = p_Parallel;
+    l_Node.Dependencies = m_Frontier;
+
+    return l_Index;
+}
+
+void WorldLoader::Begin(char const* p_Name)
+{
+    End();
+
+    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "%s", p_Name);
+
+    m_CurrentStep = int32(AddNode(p_Name, false));
+    m_Frontier.assign(1, uint32(m_CurrentStep));
+
+    m_Nodes[m_CurrentStep].StartTime = GetMSTimeDiffToNow(m_BeginTime);
+    m_StepStartPeakMemory = GetPeakMemoryUsage();
+}
+
+void WorldLoader::End()
+{
+    if (m_CurrentStep < 0)
+        return;
+
+    Node& l_Node = m_Nodes[m_CurrentStep];
+    l_Node.EndTime = GetMSTimeDiffToNow(m_BeginTime);
+
+    uint64 l_PeakMemory = GetPeakMemoryUsage();
+    sLog->outInfo(LOG_FILTER_SERVER_LOADING, ">> [%s] done in %u ms, peak memory " UI64FMTD " MB (+" UI64FMTD " MB)", l_Node.Name.c_str(), l_Node.EndTime - l_Node.StartTime,
+        l_PeakMemory / (1024 * 1024), (l_PeakMemory - std::min(l_PeakMemory, m_StepStartPeakMemory)) / (1024 * 1024));
+
+    m_CurrentStep = -1;
+}
+
+void WorldLoader::AddTask(char const* p_Name, LoaderFunction p_Function, std::initializer_list<char const*> p_Dependencies)
+{
+    End();
+
+    uint32 l_Index = AddNode(p_Name, true);
+    m_Nodes[l_Index].Function = p_Function;
+
+    for (char const* l_Dependency : p_Dependencies)
+    {
+        auto l_Itr = std::find_if(m_Queued.begin(), m_Queued.end(), [this, l_Dependency](uint32 p_Queued) -> bool
+        {
+            return m_Nodes[p_Queued].Name == l_Dependency;
+        });
+
+        if (l_Itr == m_Queued.end())
+        {
+            sLog->outError(LOG_FILTER_SERVER_LOADING, "WorldLoader: loader '%s' depends on '%s' which is not queued before it, dependency ignored.", p_Name, l_Dependency);
+            continue;
+        }
+
+        m_Nodes[l_Index].Dependencies.push_back(*l_Itr);
+        m_Nodes[l_Index].PendingDependencies++;
+        m_Nodes[*l_Itr].Dependents.push_back(l_Index);
+    }
+
+    m_Queued.push_back(l_Index);
+}
+
+void WorldLoader::RunNode(uint32 p_Index)
+{
+    Node& l_Node = m_Nodes[p_Index];
+
+    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "%s", l_Node.Name.c_str());
+
+    l_Node.StartTime = GetMSTimeDiffToNow(m_BeginTime);
+    l_Node.Function();
+    l_Node.EndTime = GetMSTimeDiffToNow(m_BeginTime);
+
+    sLog->outInfo(LOG_FILTER_SERVER_LOADING, ">> [%s] done in %u ms", l_Node.Name.c_str(), l_Node.EndTime - l_Node.StartTime);
+}
+
+void WorldLoader::RunTasks(uint32 p_ThreadCount)
+{
+    End();
+
+    if (m_Queued.empty())
+        return;
+
+    std::mutex l_Lock;
+    std::condition_variable l_Condition;
+    std::deque<uint32> l_Ready;
+    uint32 l_Remaining = uint32(m_Queued.size());
+
+    for (uint32 l_Index : m_Queued)
+    {
+        if (!m_Nodes[l_Index].PendingDependencies)
+            l_Ready.push_back(l_Index);
+    }
+
+    auto l_Worker = [&]()
+    {
+        std::unique_lock<std::mutex> l_Guard(l_Lock);
+
+        for (;;)
+        {
+            l_Condition.wait(l_Guard, [&]() -> bool { return !l_Ready.empty() || !l_Remaining; });
+
+            if (!l_Remaining)
+                break;
+
+            uint32 l_Index = l_Ready.front();
+            l_Ready.pop_front();
+
+            l_Guard.unlock();
+            RunNode(l_Index);
+            l_Guard.lock();
+
+            --l_Remaining;
+
+            for (uint32 l_Dependent : m_Nodes[l_Index].Dependents)
+            {
+                if (!--m_Nodes[l_Dependent].PendingDependencies)
+                    l_Ready.push_back(l_Dependent);
+            }
+
+            l_Condition.notify_all();
+        }
+    };
+
+    uint32 l_ThreadCount = std::min<uint32>(std::max<uint32>(p_ThreadCount, 1), uint32(m_Queued.size()));
+    uint32 l_StartTime = getMSTime();
+
+    std::vector<std::thread> l_Threads;
+    for (uint32 l_I = 1; l_I < l_ThreadCount; ++l_I)
+    {
+        l_Threads.push_back(std::thread([&l_Worker]()
+        {
+            MySQL::Thread_Init();
+            l_Worker();
+            MySQL::Thread_End();
+        }));
+    }
+
+    /// The world thread takes its share of the loaders too
+    l_Worker();
+
+    for (std::thread& l_Thread : l_Threads)
+        l_Thread.join();
+
+    sLog->outInfo(LOG_FILTER_SERVER_LOADING, ">> %u loaders done in %u ms on %u threads", uint32(m_Queued.size()), GetMSTimeDiffToNow(l_StartTime), l_ThreadCount);
+
+    /// What comes next waits for the whole batch, only the loaders nothing in the batch depends on are needed for that
+    m_Frontier.clear();
+    for (uint32 l_Index : m_Queued)
+    {
+        if (m_Nodes[l_Index].Dependents.empty())
+            m_Frontier.push_back(l_Index);
+    }
+
+    m_Queued.clear();
+}
+
+void WorldLoader::LogReport() const
+{
+    if (m_Nodes.empty())
+        return;
+
+    uint32 l_WallTime = 0;
+    uint32 l_SumTime  = 0;
+    uint32 l_Last     = 0;
+
+    std::vector<uint32> l_ByDuration;
+    for (uint32 l_I = 0; l_I < m_Nodes.size(); ++l_I)
+    {
+        Node const& l_Node = m_Nodes[l_I];
+
+        l_SumTime += l_Node.EndTime - l_Node.StartTime;
+        l_ByDuration.push_back(l_I);
+
+        if (l_Node.EndTime >= l_WallTime)
+        {
+            l_WallTime = l_Node.EndTime;
+            l_Last     = l_I;
+        }
+    }
+
+    std::sort(l_ByDuration.begin(), l_ByDuration.end(), [this](uint32 p_A, uint32 p_B) -> bool
+    {
+        return m_Nodes[p_A].EndTime - m_Nodes[p_A].StartTime > m_Nodes[p_B].EndTime - m_Nodes[p_B].StartTime;
+    });
+
+    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Boot report: %u loading steps, %u ms of loading in %u ms of wall time", uint32(m_Nodes.size()), l_SumTime, l_WallTime);
+
+    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Slowest loaders:");
+    for (uint32 l_I = 0; l_I < l_ByDuration.size() && l_I < WORLD_LOADER_REPORT_SLOWEST; ++l_I)
+    {
+        Node const& l_Node = m_Nodes[l_ByDuration[l_I]];
+        sLog->outInfo(LOG_FILTER_SERVER_LOADING, "    %7u ms  %s%s", l_Node.EndTime - l_Node.StartTime, l_Node.Name.c_str(), l_Node.Parallel ? " (parallel)" : "");
+    }
+
+    /// Walk back from the last node to finish through the dependency that finished last each time
+    std::vector<uint32> l_CriticalPath;
+    for (uint32 l_Current = l_Last;;)
+    {
+        l_CriticalPath.push_back(l_Current);
+
+        std::vector<uint32> const& l_Dependencies = m_Nodes[l_Current].Dependencies;
+        if (l_Dependencies.empty())
+            break;
+
+        l_Current = *std::max_element(l_Dependencies.begin(), l_Dependencies.end(), [this](uint32 p_A, uint32 p_B) -> bool
+        {
+            return m_Nodes[p_A].EndTime < m_Nodes[p_B].EndTime;
+        });
+    }
+
+    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Critical path (%u steps):", uint32(l_CriticalPath.size()));
+    for (auto l_Itr = l_CriticalPath.rbegin(); l_Itr != l_CriticalPath.rend(); ++l_Itr)
+    {
+        Node const& l_Node = m_Nodes[*l_Itr];
+
+        /// Short steps are only noise in the path
+        if (l_Node.EndTime - l_Node.StartTime < 100 && *l_Itr != l_Last)
+            continue;
+
+        sLog->outInfo(LOG_FILTER_SERVER_LOADING, "    %7u ms  at %7u ms  %s%s", l_Node.EndTime - l_Node.StartTime, l_Node.EndTime, l_Node.Name.c_str(), l_Node.Parallel ? " (parallel)" : "");
+    }
+}
@@ -0,0 +1,72 @@
+////////////////////////////////////////////////////////////////////////////////
+//
+//  MILLENIUM-STUDIO
+//  Copyright 2016 Millenium-studio SARL
+//  All Rights Reserved.
+//
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef WORLD_LOADER_H
+#define WORLD_LOADER_H
+
+#include "Common.h"
+
+#include <functional>
+#include <initializer_list>
+
+/// Startup task graph of World::SetInitialWorldSettings.
+///
+/// Steps begun with Begin() run on the world thread one after the other, as the startup always did.
+/// Loaders queued with AddTask() only depend on the loaders they name (plus the step before them),
+/// RunTasks() runs them on Loading.Threads threads, each of them using its own database connection.
+/// Every step and loader is a node of the graph, LogReport() prints their wall time and the critical path.
+class WorldLoader
+{
+    public:
+        typedef std::function<void()> LoaderFunction;
+
+        WorldLoader();
+
+        /// Start a sequential step, it lasts until the next step or task batch begins
+        void Begin(char const* p_Name);
+        /// End the current sequential step
+        void End();
+
+        /// Queue a loader for the next RunTasks, it starts once the queued loaders named in p_Dependencies are done.
+        /// The dependencies must be queued before, which keeps the graph acyclic.
+        void AddTask(char const* p_Name, LoaderFunction p_Function, std::initializer_list<char const*> p_Dependencies = {});
+
+        /// Run the queued loaders on p_ThreadCount threads, the calling thread included, and wait for all of them
+        void RunTasks(uint32 p_ThreadCount);
+
+        /// Per-loader wall time and critical path of the whole startup
+        void LogReport() const;
+
+    private:
+        struct Node
+        {
+            Node() : Parallel(false), PendingDependencies(0), StartTime(0), EndTime(0) { }
+
+            std::string Name;
+            LoaderFunction Function;
+            bool Parallel;
+            std::vector<uint32> Dependencies;           ///< Indexes in m_Nodes
+            std::vector<uint32> Dependents;
+            uint32 PendingDependencies;
+            uint32 StartTime;                           ///< Milliseconds since the loader creation
+            uint32 EndTime;
+        };
+
+        uint32 AddNode(char const* p_Name, bool p_Parallel);
+        void RunNode(uint32 p_Index);
+
+        std::vector<Node> m_Nodes;
+        std::vector<uint32> m_Queued;                   ///< Loaders waiting for RunTasks
+        std::vector<uint32> m_Frontier;                 ///< Nodes the next step or unbound loader depends on
+
+        uint32 m_BeginTime;
+        int32 m_CurrentStep;
+        uint64 m_StepStartPeakMemory;
+};
+
+#endif
@@ -28,13 +28,28 @@ EndScriptData */
 #include "Group.h"
 #include "LFGMgr.h"
 #include "World.h"
+#include "GarrisonMgr.hpp"
+#include "WildBattlePet.h"
+#include "PetBattle.h"
+#include "UpdateFieldVisibility.h"
+#include "UpdateData.h"
+#include "DynamicVisibility.h"
+#include "ChatLexicsCutter.h"
+#include "ChannelMgr.h"
+#include "ThreatHeap.h"
+#include "LootMgr.h"
+#include "SpellArena.h"
 
 #ifndef CROSS
 #include "InterRealmOpcodes.h"
 #include "InterRealmSession.h"
 
-#endif /* not CROSS */
+#else /* CROSS */
+#include "InterRealmMgr.h"
+#include "InterRealmClient.h"
+#endif /* CROSS */
 #include <fstream>
+#include <thread>
 #include "BattlegroundPacketFactory.hpp"
 
 struct UnitStates
@@ -120,6 +135,36 @@ class debug_commandscript: public CommandScript
                 { "spellfail",      SEC_ADMINISTRATOR,  false, &HandleDebugSendSpellFailCommand,      "", NULL },
                 { NULL,             SEC_PLAYER,         false, NULL,                                  "", NULL }
             };
+            static ChatCommand debugStatsCommandTable[] =
+            {
+                { "gridload",       SEC_ADMINISTRATOR,  false, &HandleDebugStatsGridLoadCommand,      "", NULL },
+                { "objectpool",     SEC_ADMINISTRATOR,  true,  &HandleDebugStatsObjectPoolCommand,    "", NULL },
+                { "visibility",     SEC_ADMINISTRATOR,  false, &HandleDebugStatsVisibilityCommand,    "", NULL },
+                { "spellstore",     SEC_ADMINISTRATOR,  true,  &HandleDebugStatsSpellStoreCommand,    "", NULL },
+                { "criteria",       SEC_ADMINISTRATOR,  true,  &HandleDebugStatsCriteriaCommand,      "", NULL },
+                { "irtunnel",       SEC_ADMINISTRATOR,  true,  &HandleDebugStatsIRTunnelCommand,      "", NULL },
+                { "channels",       SEC_ADMINISTRATOR,  true,  &HandleDebugStatsChannelsCommand,      "", NULL },
+                { "hooks",          SEC_ADMINISTRATOR,  true,  &HandleDebugStatsHooksCommand,         "", NULL },
+                { "schedule",       SEC_ADMINISTRATOR,  true,  &HandleDebugStatsScheduleCommand,      "", NULL },
+                { "instancememory", SEC_ADMINISTRATOR,  false, &HandleDebugStatsInstanceMemoryCommand,"", NULL },
+                { "wildpets",       SEC_ADMINISTRATOR,  true,  &HandleDebugStatsWildPetsCommand,      "", NULL },
+                { "opcodes",        SEC_ADMINISTRATOR,  true,  &HandleDebugStatsOpcodesCommand,       "", NULL },
+                { "sessions",       SEC_ADMINISTRATOR,  true,  &HandleDebugStatsSessionsCommand,      "", NULL },
+                { NULL,             SEC_PLAYER,         false, NULL,                                  "", NULL }
+            };
+            static ChatCommand debugBenchCommandTable[] =
+            {
+                { "playerhash",     SEC_ADMINISTRATOR,  false, &HandleDebugBenchPlayerHashCommand,    "", NULL },
+                { "criteria",       SEC_ADMINISTRATOR,  false, &HandleDebugBenchCriteriaCommand,      "", NULL },
+                { "lexics",         SEC_ADMINISTRATOR,  true,  &HandleDebugBenchLexicsCommand,        "", NULL },
+                { "threat",         SEC_ADMINISTRATOR,  true,  &HandleDebugBenchThreatCommand,        "", NULL },
+                { "lootgen",        SEC_ADMINISTRATOR,  false, &HandleDebugBenchLootGenCommand,       "", NULL },
+                { "spellaoe",       SEC_ADMINISTRATOR,  true,  &HandleDebugBenchSpellAoECommand,      "", NULL },
+                { "petbattles",     SEC_ADMINISTRATOR,  true,  &HandleDebugBenchPetBattlesCommand,    "", NULL },
+                { "bgscheduler",    SEC_ADMINISTRATOR,  true,  &HandleDebugBenchBgSchedulerCommand,   "", NULL },
+                { "valuesupdate",   SEC_ADMINISTRATOR,  false, &HandleDebugBenchValuesUpdateCommand,  "", NULL },
+                { NULL,             SEC_PLAYER,         false, NULL,                                  "", NULL }
+            };
             static ChatCommand debugCommandTable[] =
             {
                 { "setbit",                      SEC_ADMINISTRATOR,  false, &HandleDebugSet32BitCommand,             "", NULL },
@@ -135,6 +180,8 @@ class debug_commandscript: public CommandScript
                 { "Mod32Value",                  SEC_ADMINISTRATOR,  false, &HandleDebugMod32ValueCommand,           "", NULL },
                 { "play",                        SEC_MODERATOR,      false, NULL,                                    "", debugPlayCommandTable },
                 { "send",                        SEC_ADMINISTRATOR,  false, NULL,                                    "", debugSendCommandTable },
+                { "stats",                       SEC_ADMINISTRATOR,  true,  NULL,                                    "", debugStatsCommandTable },
+                { "bench",                       SEC_ADMINISTRATOR,  true,  NULL,                                    "", debugBenchCommandTable },
                 { "setaurastate",                SEC_ADMINISTRATOR,  false, &HandleDebugSetAuraStateCommand,         "", NULL },
                 { "setitemvalue",                SEC_ADMINISTRATOR,  false, &HandleDebugSetItemValueCommand,         "", NULL },
                 { "setvalue",                    SEC_ADMINISTRATOR,  false, &HandleDebugSetValueCommand,             "", NULL },
@@ -2172,8 +2219,8 @@ class debug_commandscript: public CommandScript
             if (!target || target->isTotem() || target->isPet())
                 return false;
 
-            std::list<HostileReference*>& threatList = target->getThreatManager().getThreatList();
-            std::list<HostileReference*>::iterator itr;
+            std::list<HostileReference*> const& threatList = target->getThreatManager().getThreatList();
+            std::list<HostileReference*>::const_iterator itr;
             uint32 count = 0;
             handler->PSendSysMessage("Threat list of %s (guid %u)", target->GetName(), target->GetGUIDLow());
             for (itr = threatList.begin(); itr != threatList.end(); ++itr)
@@ -2825,6 +2872,1177 @@ class debug_commandscript: public CommandScript
             return true;
         }
 
+        /// .debug stats gridload - grid loading counters of the current map
+        static bool HandleDebugStatsGridLoadCommand(ChatHandler* p_Handler, char const* /*p_Args*/)
+        {
+            Map* l_Map = p_Handler->GetSession()->GetPlayer()->GetMap();
+            GridLoadStats const& l_Stats = l_Map->GetGridLoadStats();
+
+            uint32 l_Loads = l_Stats.SyncLoads + l_Stats.DeferredLoads;
+
+            p_Handler->PSendSysMessage("Map %u instance %u grid loading:", l_Map->GetId(), l_Map->GetInstanceId());
+            p_Handler->PSendSysMessage("Loads: %u synchronous, %u deferred, %u objects committed", l_Stats.SyncLoads, l_Stats.DeferredLoads, l_Stats.CommittedObjects);
+            p_Handler->PSendSysMessage("Load time: last %u ms, max %u ms, avg %u ms", l_Stats.LastLoadTime, l_Stats.MaxLoadTime, l_Loads ? uint32(l_Stats.TotalLoadTime / l_Loads) : 0);
+            p_Handler->PSendSysMessage("Max prepare time %u ms, max commit slice %u ms", l_Stats.MaxPrepareTime, l_Stats.MaxCommitTime);
+            p_Handler->PSendSysMessage("Pending: %u grids, %u objects", l_Stats.PendingGrids, l_Stats.PendingObjects);
+            p_Handler->PSendSysMessage("Unloads: %u done, %u postponed", l_Stats.Unloads, l_Stats.DeferredUnloads);
+            return true;
+        }
+
+        /// .debug stats objectpool [mapId] - allocation stats per object type, for all pools or the pools of one map
+        static bool HandleDebugStatsObjectPoolCommand(ChatHandler* p_Handler, char const* p_Args)
+        {
+            bool l_FilterMap = p_Args && *p_Args;
+            uint32 l_MapId   = l_FilterMap ? uint32(atoi(p_Args)) : 0;
+
+            ObjectPoolStats l_Stats[MAX_OBJECT_POOL_TYPE];
+            ObjectPoolMgr::VisitStats([&](uint32 p_MapId, ObjectPoolType p_Type, ObjectPoolStats const& p_Stats)
+            {
+                if (!l_FilterMap || p_MapId == l_MapId)
+                    l_Stats[p_Type].Add(p_Stats);
+            });
+
+            if (l_FilterMap)
+                p_Handler->PSendSysMessage("Object pools of map %u:", l_MapId);
+            else
+                p_Handler->PSendSysMessage("Object pools of all maps:");
+
+            for (uint8 l_Type = 0; l_Type < MAX_OBJECT_POOL_TYPE; ++l_Type)
+            {
+                ObjectPoolStats const& l_TypeStats = l_Stats[l_Type];
+                p_Handler->PSendSysMessage("%s: %u live (%u KB), " UI64FMTD " allocs (" UI64FMTD " reused), " UI64FMTD " frees, %u pending, %u free (%u KB)",
+                    ObjectPoolMgr::GetTypeName(ObjectPoolType(l_Type)), l_TypeStats.Live, uint32(l_TypeStats.LiveBytes / 1024), l_TypeStats.Allocations, l_TypeStats.Reused,
+                    l_TypeStats.Deallocations, l_TypeStats.Pending, l_TypeStats.Free, uint32(l_TypeStats.FreeBytes / 1024));
+            }
+
+            return true;
+        }
+
+        /// .debug stats visibility - batched visibility pass counters of the current map and its DynamicVisibilityMgr level
+        static bool HandleDebugStatsVisibilityCommand(ChatHandler* p_Handler, char const* /*p_Args*/)
+        {
+            Map* l_Map = p_Handler->GetSession()->GetPlayer()->GetMap();
+            VisibilityStats const& l_Stats = l_Map->GetVisibilityStats();
+
+            p_Handler->PSendSysMessage("Map %u instance %u visibility:", l_Map->GetId(), l_Map->GetInstanceId());
+            p_Handler->PSendSysMessage("Requests: " UI64FMTD " (" UI64FMTD " merged), %u passes", l_Stats.Requests, l_Stats.Merged, l_Stats.Passes);
+            p_Handler->PSendSysMessage("Units: " UI64FMTD " updated, " UI64FMTD " skipped (distance), %u in last pass", l_Stats.Processed, l_Stats.SkippedByDistance, l_Stats.LastMovers);
+            p_Handler->PSendSysMessage("Pass time: last %u us, max %u us, smoothed %u us", l_Stats.LastPassTime, l_Stats.MaxPassTime, l_Stats.SmoothedPassTime);
+            p_Handler->PSendSysMessage("Level %u: pass every %u ms, min move %.2f yd", l_Stats.Level, DynamicVisibilityMgr::GetVisibilityNotifyDelay(l_Stats.Level),
+                std::sqrt(DynamicVisibilityMgr::GetReqMoveDistSq(l_Stats.Level, l_Map->GetEntry()->instanceType)));
+            return true;
+        }
+
+        /// .debug stats spellstore - memory of the SpellInfo store, as logged at startup
+        static bool HandleDebugStatsSpellStoreCommand(ChatHandler* p_Handler, char const* /*p_Args*/)
+        {
+            SpellInfoStoreReport const& l_Report = sSpellMgr->GetSpellInfoStoreReport();
+
+            p_Handler->PSendSysMessage("SpellInfo: %u objects, %u for %u spells with difficulties", l_Report.SpellInfoCount, l_Report.DifficultySpellInfoCount, l_Report.DifficultySpellCount);
+            p_Handler->PSendSysMessage("Objects: %u KB (%u bytes each)", uint32(l_Report.ObjectBytes / 1024), uint32(sizeof(SpellInfo)));
+            p_Handler->PSendSysMessage("Index: %u KB, per difficulty arrays would use %u KB", uint32(l_Report.IndexBytes / 1024), uint32(l_Report.LegacyIndexBytes / 1024));
+            return true;
+        }
+
+        /// .debug stats criteria - criteria evaluated and skipped by the asset index, per criteria type, and player queues activity
+        static bool HandleDebugStatsCriteriaCommand(ChatHandler* p_Handler, char const* /*p_Args*/)
+        {
+            std::vector<AchievementCriteriaTypeCounters> l_Types(ACHIEVEMENT_CRITERIA_TYPE_TOTAL);
+            AchievementCriteriaQueueCounters l_Queue;
+            sAchievementMgr->GetCriteriaCounters(l_Types.data(), l_Queue);
+
+            uint64 l_TotalEvaluated = 0;
+            uint64 l_TotalSkipped   = 0;
+
+            for (uint32 l_Type = 0; l_Type < ACHIEVEMENT_CRITERIA_TYPE_TOTAL; ++l_Type)
+            {
+                AchievementCriteriaTypeCounters const& l_Counters = l_Types[l_Type];
+                if (!l_Counters.Events)
+                    continue;
+
+                l_TotalEvaluated += l_Counters.Evaluated;
+                l_TotalSkipped   += l_Counters.Skipped;
+
+                p_Handler->PSendSysMessage("%s (%u)%s: " UI64FMTD " events, " UI64FMTD " evaluated, " UI64FMTD " skipped", AchievementGlobalMgr::GetCriteriaTypeString(l_Type), l_Type,
+                    AchievementGlobalMgr::IsAssetIndexedCriteriaType(AchievementCriteriaTypes(l_Type)) ? " [indexed]" : "", l_Counters.Events, l_Counters.Evaluated, l_Counters.Skipped);
+            }
+
+            p_Handler->PSendSysMessage("Total: " UI64FMTD " criteria evaluated, " UI64FMTD " skipped", l_TotalEvaluated, l_TotalSkipped);
+            p_Handler->PSendSysMessage("Player queues: " UI64FMTD " events queued, " UI64FMTD " coalesced, " UI64FMTD " processed", l_Queue.Queued, l_Queue.Coalesced, l_Queue.Processed);
+            return true;
+        }
+
+        static void SendIRTunnelStats(ChatHandler* p_Handler, char const* p_Name, InterRealmTunnelBatch const& p_Batch)
+        {
+            InterRealmTunnelStats const& l_Stats = p_Batch.GetStats();
+
+            uint64 l_Packets = l_Stats.SentPackets;
+            uint64 l_Batches = l_Stats.SentBatches;
+            uint64 l_Raw     = l_Stats.SentRawBytes;
+            uint64 l_Wire    = l_Stats.SentWireBytes;
+
+            p_Handler->PSendSysMessage("%s: batching %s", p_Name, p_Batch.IsEnabled() ? "on" : "off");
+            p_Handler->PSendSysMessage("    sent " UI64FMTD " packets in " UI64FMTD " batches (" UI64FMTD " compressed), %.1f packets/batch",
+                l_Packets, l_Batches, uint64(l_Stats.SentCompressedBatches), l_Batches ? float(l_Packets) / l_Batches : 0.0f);
+            p_Handler->PSendSysMessage("    sent " UI64FMTD " KB raw, " UI64FMTD " KB on the wire, ratio %.2f",
+                l_Raw / 1024, l_Wire / 1024, l_Raw ? float(l_Wire) / l_Raw : 1.0f);
+            p_Handler->PSendSysMessage("    received " UI64FMTD " packets in " UI64FMTD " batches, " UI64FMTD " KB on the wire",
+                uint64(l_Stats.ReceivedPackets), uint64(l_Stats.ReceivedBatches), uint64(l_Stats.ReceivedWireBytes) / 1024);
+        }
+
+        /// .debug stats irtunnel - tunneled packets throughput and compression ratio of the InterRealm connections
+        static bool HandleDebugStatsIRTunnelCommand(ChatHandler* p_Handler, char const* /*p_Args*/)
+        {
+#ifndef CROSS
+            InterRealmSession* l_Session = sWorld->GetInterRealmSession();
+            if (!l_Session)
+            {
+                p_Handler->PSendSysMessage("InterRealm is not running.");
+                return true;
+            }
+
+            SendIRTunnelStats(p_Handler, "InterRealm", l_Session->GetTunnelBatch());
+#else /* CROSS */
+            for (InterRealmClient* l_Client : sInterRealmMgr->GetClients())
+                SendIRTunnelStats(p_Handler, l_Client->GetRealmName().c_str(), l_Client->GetTunnelBatch());
+#endif /* CROSS */
+
+            return true;
+        }
+
+        /// .debug stats channels [count] - messages/s and fan-out latency of the biggest channels
+        static bool HandleDebugStatsChannelsCommand(ChatHandler* p_Handler, char const* p_Args)
+        {
+            uint32 l_Count = (p_Args && *p_Args) ? std::max(1, atoi(p_Args)) : 10;
+
+            ChannelMgr* l_ChannelMgrs[] = { channelMgr(ALLIANCE), channelMgr(HORDE) };
+            char const* l_TeamNames[]   = { "Alliance", "Horde" };
+
+            for (uint8 l_I = 0; l_I < 2; ++l_I)
+            {
+                ChannelMgr* l_ChannelMgr = l_ChannelMgrs[l_I];
+
+                /// Both teams share the alliance manager with cross faction channels
+                if (!l_ChannelMgr || (l_I && l_ChannelMgr == l_ChannelMgrs[0]))
+                    continue;
+
+                std::vector<std::pair<uint32, std::string>> l_Lines;
+                l_ChannelMgr->VisitChannels([&](Channel const* p_Channel)
+                {
+                    ChannelStats const& l_Stats = p_Channel->GetStats();
+
+                    uint64 l_Messages = l_Stats.Messages.load(std::memory_order_relaxed);
+                    if (!l_Messages)
+                        return;
+
+                    char l_Line[256];
+                    snprintf(l_Line, sizeof(l_Line), "%s: %u members, " UI64FMTD " messages (%u/s), " UI64FMTD " sent, " UI64FMTD " ignored, fan-out last %u us, max %u us, avg %u us",
+                        p_Channel->GetName().c_str(), p_Channel->GetNumPlayers(), l_Messages, l_Stats.MessagesPerSecond.load(std::memory_order_relaxed),
+                        l_Stats.Deliveries.load(std::memory_order_relaxed), l_Stats.Ignored.load(std::memory_order_relaxed),
+                        l_Stats.LastFanOutTime.load(std::memory_order_relaxed), l_Stats.MaxFanOutTime.load(std::memory_order_relaxed),
+                        uint32(l_Stats.TotalFanOutTime.load(std::memory_order_relaxed) / l_Messages));
+
+                    l_Lines.push_back(std::make_pair(p_Channel->GetNumPlayers(), std::string(l_Line)));
+                });
+
+                std::sort(l_Lines.begin(), l_Lines.end(), [](std::pair<uint32, std::string> const& p_A, std::pair<uint32, std::string> const& p_B)
+                {
+                    return p_A.first > p_B.first;
+                });
+
+                if (l_Lines.size() > l_Count)
+                    l_Lines.resize(l_Count);
+
+                p_Handler->PSendSysMessage("%s channels:", l_TeamNames[l_I]);
+                for (auto const& l_Line : l_Lines)
+                    p_Handler->PSendSysMessage("%s", l_Line.second.c_str());
+            }
+
+            return true;
+        }
+
+        /// .debug stats hooks - scripts still subscribed to each dispatched hook and script calls made through it
+        static bool HandleDebugStatsHooksCommand(ChatHandler* p_Handler, char const* /*p_Args*/)
+        {
+            for (ScriptHookListBase const* l_Hook : ScriptHookListBase::GetAll())
+                p_Handler->PSendSysMessage("%s: %u/%u scripts subscribed, " UI64FMTD " calls", l_Hook->GetName(), l_Hook->GetSubscriberCount(), l_Hook->GetScriptCount(), l_Hook->GetCallCount());
+
+            return true;
+        }
+
+        /// .debug stats schedule - work done by the scheduled garrison and vignette updates since startup
+        static bool HandleDebugStatsScheduleCommand(ChatHandler* p_Handler, char const* /*p_Args*/)
+        {
+#ifndef CROSS
+            using MS::Garrison::UpdateScheduler;
+            namespace UpdateType = MS::Garrison::UpdateType;
+
+            uint64 l_Ticks = UpdateScheduler::s_Ticks.load();
+            p_Handler->PSendSysMessage("Garrison: " UI64FMTD " ticks, " UI64FMTD " resyncs", l_Ticks, UpdateScheduler::s_Resyncs.load());
+
+            for (uint8 l_Type = 0; l_Type < UpdateType::Max; ++l_Type)
+            {
+                uint64 l_Runs = UpdateScheduler::s_Runs[l_Type].load();
+                p_Handler->PSendSysMessage("    %s: " UI64FMTD " runs (%.2f%% of the ticks)", UpdateScheduler::GetTypeName(UpdateType::Type(l_Type)), l_Runs,
+                    l_Ticks ? 100.0f * l_Runs / l_Ticks : 0.0f);
+            }
+#endif
+
+            p_Handler->PSendSysMessage("Vignettes: " UI64FMTD " creature positions pushed, " UI64FMTD " updates sent",
+                Vignette::Manager::s_PositionPushes.load(), Vignette::Manager::s_UpdatesSent.load());
+            return true;
+        }
+
+        /// .debug stats instancememory - memory owned by the current map instance
+        static bool HandleDebugStatsInstanceMemoryCommand(ChatHandler* p_Handler, char const* /*p_Args*/)
+        {
+            Map* l_Map = p_Handler->GetSession()->GetPlayer()->GetMap();
+
+            InstanceMemoryReport l_Report;
+            l_Map->BuildInstanceMemoryReport(l_Report);
+
+            size_t l_OwnedBytes = l_Report.MapBytes + l_Report.GridTableBytes + l_Report.GridBytes + l_Report.ObjectBytes;
+
+            p_Handler->PSendSysMessage("Map %u instance %u: %u players, %u grids, %u creatures, %u gameobjects", l_Map->GetId(), l_Map->GetInstanceId(),
+                l_Report.Players, l_Report.LoadedGrids, l_Report.Creatures, l_Report.GameObjects);
+            p_Handler->PSendSysMessage("Owned: %u KB (map %u KB, grid tables %u KB, grids %u KB, objects %u KB)", uint32(l_OwnedBytes / 1024),
+                uint32(l_Report.MapBytes / 1024), uint32(l_Report.GridTableBytes / 1024), uint32(l_Report.GridBytes / 1024), uint32(l_Report.ObjectBytes / 1024));
+
+            return true;
+        }
+
+        /// .debug stats wildpets - wild battle pets spawned around active grids, and how many of them a player saw
+        static bool HandleDebugStatsWildPetsCommand(ChatHandler* p_Handler, char const* /*p_Args*/)
+        {
+            uint64 l_Spawned  = WildBattlePetMgr::s_Spawned.load();
+            uint64 l_Observed = WildBattlePetMgr::s_Observed.load();
+
+            p_Handler->PSendSysMessage("Wild battle pets: " UI64FMTD " spawned, " UI64FMTD " observed by a player (%.2f%%)", l_Spawned, l_Observed,
+                l_Spawned ? 100.0f * l_Observed / l_Spawned : 0.0f);
+            p_Handler->PSendSysMessage("Zones: %u, %u pending, " UI64FMTD " populated since startup", sWildBattlePetMgr->GetZoneCount(),
+                sWildBattlePetMgr->GetPendingZoneCount(), WildBattlePetMgr::s_ZonePopulations.load());
+            return true;
+        }
+
+        /// .debug stats opcodes [count] - client opcodes costing the most handler time on the realm, and the handler time of the selected player
+        static bool HandleDebugStatsOpcodesCommand(ChatHandler* p_Handler, char const* p_Args)
+        {
+            uint32 l_Count = (p_Args && *p_Args) ? std::max(1, atoi(p_Args)) : 10;
+
+            std::vector<OpcodeHandler const*> l_Handlers;
+            for (uint32 l_Opcode = 0; l_Opcode < NUM_OPCODE_HANDLERS; ++l_Opcode)
+            {
+                OpcodeHandler const* l_OpcodeHandler = g_OpcodeTable[WOW_CLIENT_TO_SERVER][l_Opcode];
+                if (l_OpcodeHandler && l_OpcodeHandler->Stats.Count.load(std::memory_order_relaxed))
+                    l_Handlers.push_back(l_OpcodeHandler);
+            }
+
+            std::sort(l_Handlers.begin(), l_Handlers.end(), [](OpcodeHandler const* p_A, OpcodeHandler const* p_B)
+            {
+                return p_A->Stats.TotalTime.load(std::memory_order_relaxed) > p_B->Stats.TotalTime.load(std::memory_order_relaxed);
+            });
+
+            if (l_Handlers.size() > l_Count)
+                l_Handlers.resize(l_Count);
+
+            for (OpcodeHandler const* l_OpcodeHandler : l_Handlers)
+            {
+                OpcodeStats const& l_Stats = l_OpcodeHandler->Stats;
+                p_Handler->PSendSysMessage("%s: " UI64FMTD " packets, " UI64FMTD " ms, avg %u us, max %u us, " UI64FMTD " KB%s", l_OpcodeHandler->name,
+                    l_Stats.Count.load(), l_Stats.TotalTime.load() / IN_MILLISECONDS, l_Stats.GetAverageTime(), l_Stats.MaxTime.load(), l_Stats.Bytes.load() / 1024,
+                    l_OpcodeHandler->MaxPerUpdate ? " (limited)" : "");
+            }
+
+            if (Player* l_Player = p_Handler->getSelectedPlayer())
+                p_Handler->PSendSysMessage("%s: " UI64FMTD " packets, " UI64FMTD " ms of handlers since login", l_Player->GetName(),
+                    l_Player->GetSession()->GetHandledPacketCount(), l_Player->GetSession()->GetHandlerTime() / IN_MILLISECONDS);
+
+            return true;
+        }
+
+        /// .debug stats sessions - session update time, and handler time split by opcode group (PacketProcessing)
+        static bool HandleDebugStatsSessionsCommand(ChatHandler* p_Handler, char const* /*p_Args*/)
+        {
+            static char const* const k_GroupNames[MAX_PACKET_PROCESSING] = { "inplace", "thread unsafe", "thread safe", "thread safe session" };
+
+            uint64 l_Packets[MAX_PACKET_PROCESSING] = { };
+            uint64 l_Times[MAX_PACKET_PROCESSING] = { };
+            uint32 l_Opcodes[MAX_PACKET_PROCESSING] = { };
+
+            for (uint32 l_Opcode = 0; l_Opcode < NUM_OPCODE_HANDLERS; ++l_Opcode)
+            {
+                OpcodeHandler const* l_OpcodeHandler = g_OpcodeTable[WOW_CLIENT_TO_SERVER][l_Opcode];
+                if (!l_OpcodeHandler || l_OpcodeHandler->packetProcessing >= MAX_PACKET_PROCESSING)
+                    continue;
+
+                ++l_Opcodes[l_OpcodeHandler->packetProcessing];
+                l_Packets[l_OpcodeHandler->packetProcessing] += l_OpcodeHandler->Stats.Count.load(std::memory_order_relaxed);
+                l_Times[l_OpcodeHandler->packetProcessing] += l_OpcodeHandler->Stats.TotalTime.load(std::memory_order_relaxed);
+            }
+
+            for (uint32 l_Group = 0; l_Group < MAX_PACKET_PROCESSING; ++l_Group)
+            {
+                p_Handler->PSendSysMessage("%s: %u opcodes, " UI64FMTD " packets, " UI64FMTD " ms, avg %u us", k_GroupNames[l_Group], l_Opcodes[l_Group], l_Packets[l_Group],
+                    l_Times[l_Group] / IN_MILLISECONDS, l_Packets[l_Group] ? uint32(l_Times[l_Group] / l_Packets[l_Group]) : 0);
+            }
+
+#ifndef CROSS
+            SessionUpdateStats const& l_Stats = sWorld->GetSessionUpdateStats();
+            if (!l_Stats.Updates)
+                return true;
+
+            p_Handler->PSendSysMessage("%u sessions, " UI64FMTD " updates, avg %u sessions to the workers (batch %u)", uint32(sWorld->GetAllSessions().size()), l_Stats.Updates,
+                uint32(l_Stats.WorkerSessions / l_Stats.Updates), sWorld->getIntConfig(CONFIG_SESSION_WORKER_BATCH_SIZE));
+            p_Handler->PSendSysMessage("workers: avg %u us, max %u us - serial: avg %u us, max %u us", uint32(l_Stats.WorkerTime / l_Stats.Updates), l_Stats.MaxWorkerTime,
+                uint32(l_Stats.SerialTime / l_Stats.Updates), l_Stats.MaxSerialTime);
+#endif
+
+            return true;
+        }
+
+        /// The .debug bench commands block the calling thread, they are only allowed with Debug.Benchmarks
+        static bool CanRunBenchmark(ChatHandler* p_Handler)
+        {
+            if (sWorld->getBoolConfig(CONFIG_DEBUG_BENCHMARKS))
+                return true;
+
+            p_Handler->PSendSysMessage("Benchmarks are disabled, see Debug.Benchmarks in worldserver.conf.");
+            p_Handler->SetSentErrorMessage(true);
+            return false;
+        }
+
+        /// .debug bench playerhash [range] [iterations] - compare player range queries through the cells and through the spatial hash
+        static bool HandleDebugBenchPlayerHashCommand(ChatHandler* p_Handler, char const* p_Args)
+        {
+            if (!CanRunBenchmark(p_Handler))
+                return false;
+
+            Player* l_Player = p_Handler->GetSession()->GetPlayer();
+
+            char* l_RangeStr      = strtok((char*)p_Args, " ");
+            char* l_IterationsStr = strtok(NULL, " ");
+
+            float l_Range       = l_RangeStr ? float(atof(l_RangeStr)) : 100.0f;
+            uint32 l_Iterations = l_IterationsStr ? uint32(atoi(l_IterationsStr)) : 1000;
+            if (!l_Iterations)
+                l_Iterations = 1;
+
+            std::list<Player*> l_Players;
+            uint32 l_GridCount = 0;
+            uint32 l_HashCount = 0;
+
+            uint32 l_StartTime = getMSTime();
+            for (uint32 l_I = 0; l_I < l_Iterations; ++l_I)
+            {
+                l_Players.clear();
+                JadeCore::AnyPlayerInObjectRangeCheck l_Check(l_Player, l_Range, true, true);
+                JadeCore::PlayerListSearcher<JadeCore::AnyPlayerInObjectRangeCheck> l_Searcher(l_Player, l_Players, l_Check);
+                l_Player->VisitNearbyWorldObject(l_Range, l_Searcher);
+                l_GridCount = uint32(l_Players.size());
+            }
+            uint32 l_GridTime = GetMSTimeDiffToNow(l_StartTime);
+
+            l_StartTime = getMSTime();
+            for (uint32 l_I = 0; l_I < l_Iterations; ++l_I)
+            {
+                l_Players.clear();
+                l_Player->GetMap()->GetPlayerListInRange(l_Player, l_Range, l_Players, true, true);
+                l_HashCount = uint32(l_Players.size());
+            }
+            uint32 l_HashTime = GetMSTimeDiffToNow(l_StartTime);
+
+            PlayerSpatialHash& l_Hash = l_Player->GetMap()->GetPlayerSpatialHash();
+            p_Handler->PSendSysMessage("Player hash: %u players in %u buckets", l_Hash.GetSize(), l_Hash.GetBucketCount());
+            p_Handler->PSendSysMessage("%u queries, range %.1f: cells %u ms (%u found), hash %u ms (%u found)", l_Iterations, l_Range, l_GridTime, l_GridCount, l_HashTime, l_HashCount);
+            return true;
+        }
+
+        /// .debug bench criteria record|stop|run - record the criteria events of the realm, then evaluate them for the current player
+        /// with and without the asset index (no progress is updated)
+        static bool HandleDebugBenchCriteriaCommand(ChatHandler* p_Handler, char const* p_Args)
+        {
+            if (!CanRunBenchmark(p_Handler))
+                return false;
+
+            if (!p_Args || !*p_Args)
+                return false;
+
+            std::string l_Action = p_Args;
+
+            if (l_Action == "record")
+            {
+                sAchievementMgr->StartCriteriaEventsRecording();
+                p_Handler->PSendSysMessage("Criteria events recording started");
+                return true;
+            }
+
+            if (l_Action == "stop")
+            {
+                sAchievementMgr->StopCriteriaEventsRecording();
+                p_Handler->PSendSysMessage("Criteria events recording stopped, %u events", uint32(sAchievementMgr->GetRecordedCriteriaEvents().size()));
+                return true;
+            }
+
+            if (l_Action != "run")
+                return false;
+
+            Player* l_Player = p_Handler->GetSession()->GetPlayer();
+            std::vector<AchievementCriteriaEvent> l_Events = sAchievementMgr->GetRecordedCriteriaEvents();
+
+            uint32 l_StartTime = getMSTime();
+            uint64 l_FullEvaluated = l_Player->GetAchievementMgr().ReplayCriteriaEvents(l_Events, l_Player, false);
+            uint32 l_FullTime = GetMSTimeDiffToNow(l_StartTime);
+
+            l_StartTime = getMSTime();
+            uint64 l_IndexedEvaluated = l_Player->GetAchievementMgr().ReplayCriteriaEvents(l_Events, l_Player, true);
+            uint32 l_IndexedTime = GetMSTimeDiffToNow(l_StartTime);
+
+            p_Handler->PSendSysMessage("%u events replayed", uint32(l_Events.size()));
+            p_Handler->PSendSysMessage("By type: %u ms, " UI64FMTD " criteria evaluated", l_FullTime, l_FullEvaluated);
+            p_Handler->PSendSysMessage("By asset: %u ms, " UI64FMTD " criteria evaluated", l_IndexedTime, l_IndexedEvaluated);
+            return true;
+        }
+
+        /// .debug bench lexics [corpusFile] [iterations] - run the chat filter over a file of chat lines
+        static bool HandleDebugBenchLexicsCommand(ChatHandler* p_Handler, char const* p_Args)
+        {
+            if (!CanRunBenchmark(p_Handler))
+                return false;
+
+            LexicsCutter const* l_Cutter = sWorld->GetLexicsCutter();
+            if (!l_Cutter)
+                return false;
+
+            char* l_FileStr       = strtok((char*)p_Args, " ");
+            char* l_IterationsStr = strtok(NULL, " ");
+
+            std::string l_FileName = l_FileStr ? l_FileStr : "chat_corpus.txt";
+            uint32 l_Iterations    = l_IterationsStr ? std::max(1, atoi(l_IterationsStr)) : 10;
+
+            std::ifstream l_File(l_FileName.c_str());
+            if (!l_File.is_open())
+            {
+                p_Handler->PSendSysMessage("Can't open %s", l_FileName.c_str());
+                return true;
+            }
+
+            std::vector<std::string> l_Lines;
+            std::string l_Line;
+            while (std::getline(l_File, l_Line))
+            {
+                if (!l_Line.empty())
+                    l_Lines.push_back(l_Line);
+            }
+
+            uint32 l_Matches = 0;
+            for (std::string const& l_Text : l_Lines)
+            {
+                if (l_Cutter->CheckLexics(l_Text))
+                    ++l_Matches;
+            }
+
+            uint32 l_StartTime = getMSTime();
+            for (uint32 l_I = 0; l_I < l_Iterations; ++l_I)
+                for (std::string const& l_Text : l_Lines)
+                    l_Cutter->CheckLexics(l_Text);
+            uint32 l_Time = GetMSTimeDiffToNow(l_StartTime);
+
+            p_Handler->PSendSysMessage("%u words, %u automaton states", l_Cutter->GetWordCount(), l_Cutter->GetNodeCount());
+            p_Handler->PSendSysMessage("%u lines x %u: %u filtered, %u ms", uint32(l_Lines.size()), l_Iterations, l_Matches, l_Time);
+            return true;
+        }
+
+        /// Threat entry of the .debug bench threat benchmark
+        struct DebugThreatEntry
+        {
+            float Threat;
+            uint32 HeapIndex;
+            uint32 HeapSequence;
+
+            float getThreat() const { return Threat; }
+            uint32 GetThreatHeapIndex() const { return HeapIndex; }
+            void SetThreatHeapIndex(uint32 p_Index) { HeapIndex = p_Index; }
+            uint32 GetThreatHeapSequence() const { return HeapSequence; }
+            void SetThreatHeapSequence(uint32 p_Sequence) { HeapSequence = p_Sequence; }
+        };
+
+        /// .debug bench threat [references] [updates] - threat updates and target selection of a raid boss, sorted list against ThreatHeap
+        static bool HandleDebugBenchThreatCommand(ChatHandler* p_Handler, char const* p_Args)
+        {
+            if (!CanRunBenchmark(p_Handler))
+                return false;
+
+            char* l_ReferencesStr = strtok((char*)p_Args, " ");
+            char* l_UpdatesStr    = strtok(NULL, " ");
+
+            /// 30 players with their pets and totems by default
+            uint32 l_ReferenceCount = l_ReferencesStr ? std::max(1, atoi(l_ReferencesStr)) : 80;
+            uint32 l_UpdateCount    = l_UpdatesStr ? std::max(1, atoi(l_UpdatesStr)) : 1000000;
+
+            /// Same random threat changes for both, the boss selects its target every 10 changes
+            std::vector<std::pair<uint32, float>> l_Changes(l_UpdateCount);
+            for (std::pair<uint32, float>& l_Change : l_Changes)
+                l_Change = std::make_pair(urand(0, l_ReferenceCount - 1), frand(-500.0f, 5000.0f));
+
+            std::vector<DebugThreatEntry> l_ListEntries(l_ReferenceCount);
+            std::list<DebugThreatEntry*> l_List;
+            for (DebugThreatEntry& l_Entry : l_ListEntries)
+            {
+                l_Entry.Threat       = 0.0f;
+                l_Entry.HeapSequence = uint32(l_List.size());
+                l_List.push_back(&l_Entry);
+            }
+
+            uint64 l_Checksum = 0;
+
+            /// Former ThreatContainer: list sorted again before each selection after a change
+            uint32 l_StartTime = getMSTime();
+            bool l_Dirty = false;
+            for (uint32 l_I = 0; l_I < l_UpdateCount; ++l_I)
+            {
+                DebugThreatEntry& l_Entry = l_ListEntries[l_Changes[l_I].first];
+                l_Entry.Threat = std::max(0.0f, l_Entry.Threat + l_Changes[l_I].second);
+                l_Dirty = true;
+
+                if (l_I % 10)
+                    continue;
+
+                if (l_Dirty)
+                {
+                    l_List.sort([](DebugThreatEntry const* p_A, DebugThreatEntry const* p_B)
+                    {
+                        return p_A->Threat != p_B->Threat ? p_A->Threat > p_B->Threat : p_A->HeapSequence < p_B->HeapSequence;
+                    });
+                    l_Dirty = false;
+                }
+
+                l_Checksum += uint64(l_List.front() - l_ListEntries.data());
+            }
+            uint32 l_ListTime = GetMSTimeDiffToNow(l_StartTime);
+
+            std::vector<DebugThreatEntry> l_HeapEntries(l_ReferenceCount);
+            ThreatHeap<DebugThreatEntry> l_Heap;
+            for (DebugThreatEntry& l_Entry : l_HeapEntries)
+            {
+                l_Entry.Threat = 0.0f;
+                l_Heap.Insert(&l_Entry);
+            }
+
+            uint64 l_HeapChecksum = 0;
+
+            l_StartTime = getMSTime();
+            for (uint32 l_I = 0; l_I < l_UpdateCount; ++l_I)
+            {
+                DebugThreatEntry& l_Entry = l_HeapEntries[l_Changes[l_I].first];
+                l_Entry.Threat = std::max(0.0f, l_Entry.Threat + l_Changes[l_I].second);
+                l_Heap.Update(&l_Entry);
+
+                if (l_I % 10)
+                    continue;
+
+                l_HeapChecksum += uint64(l_Heap.Top() - l_HeapEntries.data());
+            }
+            uint32 l_HeapTime = GetMSTimeDiffToNow(l_StartTime);
+
+            /// 5th most hated, what SelectTarget(SELECT_TARGET_TOPAGGRO, 4) asks for
+            uint32 l_Visited = 0;
+            l_StartTime = getMSTime();
+            for (uint32 l_I = 0; l_I < l_UpdateCount / 10; ++l_I)
+            {
+                uint32 l_Position = 0;
+                l_Heap.VisitByThreat([&l_Position](DebugThreatEntry*) -> bool
+                {
+                    return ++l_Position < 5;
+                });
+                l_Visited += l_Position;
+            }
+            uint32 l_TopTime = GetMSTimeDiffToNow(l_StartTime);
+
+            p_Handler->PSendSysMessage("%u references, %u threat changes, %u target selections", l_ReferenceCount, l_UpdateCount, (l_UpdateCount + 9) / 10);
+            p_Handler->PSendSysMessage("Sorted list: %u ms, heap: %u ms, top 5 from the heap x %u: %u ms (%u visited)", l_ListTime, l_HeapTime, l_UpdateCount / 10, l_TopTime, l_Visited);
+            p_Handler->PSendSysMessage("Selected references %s", l_Checksum == l_HeapChecksum ? "match" : "differ");
+            return true;
+        }
+
+        /// .debug bench lootgen [lootId] [corpses] - generate the creature loot of the selected creature (or lootId) for many corpses, loot generations/sec
+        static bool HandleDebugBenchLootGenCommand(ChatHandler* p_Handler, char const* p_Args)
+        {
+            if (!CanRunBenchmark(p_Handler))
+                return false;
+
+            char* l_LootIdStr  = strtok((char*)p_Args, " ");
+            char* l_CorpsesStr = strtok(NULL, " ");
+
+            Player* l_Player = p_Handler->GetSession()->GetPlayer();
+
+            uint32 l_LootId  = l_LootIdStr ? atoi(l_LootIdStr) : 0;
+            uint32 l_Corpses = l_CorpsesStr ? std::max(1, atoi(l_CorpsesStr)) : 100000;
+
+            if (!l_LootId)
+            {
+                if (Creature* l_Creature = p_Handler->getSelectedCreature())
+                    l_LootId = l_Creature->GetCreatureTemplate()->lootid;
+            }
+
+            LootTemplate const* l_Template = LootTemplates_Creature.GetLootFor(l_LootId);
+            if (!l_Template)
+            {
+                p_Handler->PSendSysMessage("No creature loot template %u", l_LootId);
+                return true;
+            }
+
+            /// Only the rolls, FillLoot would also give the FFA currencies to the player
+            std::vector<Loot> l_Loots(std::min<uint32>(l_Corpses, 1000));
+            uint64 l_Items = 0;
+
+            uint32 l_StartTime = getMSTime();
+            for (uint32 l_I = 0; l_I < l_Corpses; ++l_I)
+            {
+                Loot& l_Loot = l_Loots[l_I % l_Loots.size()];
+                l_Loot.clear();
+                l_Template->Process(l_Loot, LootTemplates_Creature.IsRatesAllowed(), LOOT_MODE_DEFAULT, l_Player);
+                l_Items += l_Loot.Items.size() + l_Loot.QuestItems.size();
+            }
+            uint32 l_Time = std::max<uint32>(GetMSTimeDiffToNow(l_StartTime), 1);
+
+            p_Handler->PSendSysMessage("Loot %u: %u generations in %u ms, %u/s, %.2f items per corpse", l_LootId, l_Corpses, l_Time,
+                uint32(uint64(l_Corpses) * IN_MILLISECONDS / l_Time), float(l_Items) / l_Corpses);
+            return true;
+        }
+
+        /// Unit target of the .debug bench spellaoe benchmark, laid out as Spell::TargetInfo
+        struct DebugSpellTargetEntry
+        {
+            uint64 TargetGUID;
+            uint64 TimeDelay;
+            uint32 EffectMask;
+            bool Processed;
+            int32 Damage;
+        };
+
+        /// Containers of one cast with the heap allocator, as Spell held them before SpellArena
+        struct DebugSpellHeapCast
+        {
+            std::list<uint64> UnitTargets;
+            std::list<DebugSpellTargetEntry> TargetInfos;
+        };
+
+        /// Containers of one cast in a SpellArena, as Spell holds them
+        struct DebugSpellArenaCast
+        {
+            DebugSpellArenaCast() : UnitTargets(SpellArenaAllocator<uint64>(Arena)), TargetInfos(SpellArenaAllocator<DebugSpellTargetEntry>(Arena)) { }
+
+            SpellArena Arena;
+            SpellArenaList<uint64>::Type UnitTargets;
+            SpellArenaList<DebugSpellTargetEntry>::Type TargetInfos;
+        };
+
+        /// Target selection and handling of p_Casts casts on p_TargetCount targets, like SelectImplicitAreaTargets / AddUnitTarget / DoAllEffectOnTarget
+        template<class Cast> static uint64 DebugSimulateAoECasts(uint32 p_Casts, uint32 p_TargetCount)
+        {
+            uint64 l_Checksum = 0;
+
+            for (uint32 l_I = 0; l_I < p_Casts; ++l_I)
+            {
+                Cast* l_Cast = new Cast();
+
+                for (uint32 l_Target = 0; l_Target < p_TargetCount; ++l_Target)
+                    l_Cast->UnitTargets.push_back(uint64(l_Target) + 1);
+
+                /// Some of the units found by the grid search are filtered out
+                for (auto l_Itr = l_Cast->UnitTargets.begin(); l_Itr != l_Cast->UnitTargets.end();)
+                {
+                    if (*l_Itr % 7 == 0)
+                        l_Itr = l_Cast->UnitTargets.erase(l_Itr);
+                    else
+                        ++l_Itr;
+                }
+
+                /// Two effects on the same area, the second one finds the targets of the first one
+                for (uint32 l_Effect = 0; l_Effect < 2; ++l_Effect)
+                {
+                    for (uint64 l_Guid : l_Cast->UnitTargets)
+                    {
+                        auto l_Itr = l_Cast->TargetInfos.begin();
+                        for (; l_Itr != l_Cast->TargetInfos.end(); ++l_Itr)
+                        {
+                            if (l_Itr->TargetGUID == l_Guid)
+                                break;
+                        }
+
+                        if (l_Itr != l_Cast->TargetInfos.end())
+                        {
+                            l_Itr->EffectMask |= 1 << l_Effect;
+                            continue;
+                        }
+
+                        DebugSpellTargetEntry l_Entry;
+                        l_Entry.TargetGUID = l_Guid;
+                        l_Entry.TimeDelay  = 0;
+                        l_Entry.EffectMask = 1 << l_Effect;
+                        l_Entry.Processed  = false;
+                        l_Entry.Damage     = int32(l_Guid);
+                        l_Cast->TargetInfos.push_back(l_Entry);
+                    }
+                }
+
+                for (DebugSpellTargetEntry& l_Entry : l_Cast->TargetInfos)
+                {
+                    l_Entry.Processed = true;
+                    l_Checksum += uint64(l_Entry.Damage) * l_Entry.EffectMask;
+                }
+
+                delete l_Cast;
+            }
+
+            return l_Checksum;
+        }
+
+        /// .debug bench spellaoe [casts] - AoE casts on 5, 50, 200 and 500 targets, target containers on the heap against SpellArena
+        static bool HandleDebugBenchSpellAoECommand(ChatHandler* p_Handler, char const* p_Args)
+        {
+            if (!CanRunBenchmark(p_Handler))
+                return false;
+
+            char* l_CastsStr = strtok((char*)p_Args, " ");
+            uint32 l_Casts = l_CastsStr ? std::max(1, atoi(l_CastsStr)) : 2000;
+
+            uint32 const l_TargetCounts[] = { 5, 50, 200, 500 };
+            for (uint32 l_TargetCount : l_TargetCounts)
+            {
+                uint32 l_StartTime = getMSTime();
+                uint64 l_HeapChecksum = DebugSimulateAoECasts<DebugSpellHeapCast>(l_Casts, l_TargetCount);
+                uint32 l_HeapTime = GetMSTimeDiffToNow(l_StartTime);
+
+                l_StartTime = getMSTime();
+                uint64 l_ArenaChecksum = DebugSimulateAoECasts<DebugSpellArenaCast>(l_Casts, l_TargetCount);
+                uint32 l_ArenaTime = GetMSTimeDiffToNow(l_StartTime);
+
+                /// Blocks malloc'd by one cast once its inline storage is full
+                DebugSpellArenaCast l_Cast;
+                for (uint32 l_Target = 0; l_Target < l_TargetCount; ++l_Target)
+                {
+                    l_Cast.UnitTargets.push_back(uint64(l_Target) + 1);
+                    l_Cast.TargetInfos.push_back(DebugSpellTargetEntry());
+                }
+
+                p_Handler->PSendSysMessage("%u targets x %u casts: heap %u ms, arena %u ms, %u arena blocks per cast%s", l_TargetCount, l_Casts, l_HeapTime, l_ArenaTime,
+                    l_Cast.Arena.GetBlockCount(), l_HeapChecksum == l_ArenaChecksum ? "" : " (results differ)");
+            }
+
+            return true;
+        }
+
+        /// Stand-in for a running pet battle of the .debug bench petbattles benchmark: two teams of three pets trading abilities each round
+        struct DebugPetBattle
+        {
+            explicit DebugPetBattle(uint32 p_Seed) : Timer(0), Rounds(0), Seed(p_Seed | 1)
+            {
+                for (uint32 l_I = 0; l_I < MAX_PETBATTLE_TEAM * MAX_PETBATTLE_SLOTS; ++l_I)
+                {
+                    Health[l_I] = 1000;
+                    for (uint32 l_Aura = 0; l_Aura < 8; ++l_Aura)
+                        Auras[l_I][l_Aura] = NextRandom() % 50;
+                }
+            }
+
+            uint32 NextRandom()
+            {
+                Seed ^= Seed << 13;
+                Seed ^= Seed >> 17;
+                Seed ^= Seed << 5;
+                return Seed;
+            }
+
+            void Update(uint32 p_TimeDiff)
+            {
+                Timer += p_TimeDiff;
+                if (Timer < PETBATTLE_UPDATE_INTERVAL)
+                    return;
+
+                Timer = 0;
+                ++Rounds;
+
+                /// Each pet hits a pet of the other team, its auras modify the damage and then tick
+                for (uint32 l_I = 0; l_I < MAX_PETBATTLE_TEAM * MAX_PETBATTLE_SLOTS; ++l_I)
+                {
+                    uint32 l_Target = (l_I + MAX_PETBATTLE_SLOTS + NextRandom() % MAX_PETBATTLE_SLOTS) % (MAX_PETBATTLE_TEAM * MAX_PETBATTLE_SLOTS);
+                    int32 l_Damage = 50 + NextRandom() % 100;
+
+                    for (uint32 l_Aura = 0; l_Aura < 8; ++l_Aura)
+                    {
+                        l_Damage += int32(Auras[l_I][l_Aura]) - int32(Auras[l_Target][l_Aura]) / 2;
+                        Auras[l_I][l_Aura] = (Auras[l_I][l_Aura] + NextRandom()) % 50;
+                    }
+
+                    Health[l_Target] -= std::max(l_Damage, 1);
+                    if (Health[l_Target] <= 0)
+                        Health[l_Target] = 1000;
+                }
+            }
+
+            int32 Health[MAX_PETBATTLE_TEAM * MAX_PETBATTLE_SLOTS];
+            uint32 Auras[MAX_PETBATTLE_TEAM * MAX_PETBATTLE_SLOTS][8];
+            uint32 Timer;
+            uint32 Rounds;
+            uint32 Seed;
+        };
+
+        /// .debug bench petbattles [battles] - world tick cost of the running pet battles: std::map walk of the world thread, slot
+        /// array walk, and slot array split over the map updater threads. Also reports where the live battles are updated.
+        static bool HandleDebugBenchPetBattlesCommand(ChatHandler* p_Handler, char const* p_Args)
+        {
+            if (!CanRunBenchmark(p_Handler))
+                return false;
+
+            char* l_BattlesStr = strtok((char*)p_Args, " ");
+            uint32 l_BattleCount = l_BattlesStr ? std::min(std::max(1, atoi(l_BattlesStr)), PETBATTLE_MAX_SLOTS) : 5000;
+            uint32 l_ThreadCount = std::max(sWorld->getIntConfig(CONFIG_NUMTHREADS), 1u);
+            uint32 const l_Ticks = 100;
+
+            p_Handler->PSendSysMessage("Live battles: %u, " UI64FMTD " updates by the map threads, " UI64FMTD " by the world thread", sPetBattleSystem->GetBattleCount(),
+                sPetBattleSystem->MapBattleUpdates.load(), sPetBattleSystem->WorldBattleUpdates.load());
+
+            std::map<uint64, DebugPetBattle*> l_MapBattles;
+            std::vector<DebugPetBattle*> l_SlotBattles;
+            l_SlotBattles.reserve(l_BattleCount);
+
+            for (uint32 l_I = 0; l_I < l_BattleCount; ++l_I)
+            {
+                l_MapBattles[uint64(l_I) + 2] = new DebugPetBattle(l_I);
+                l_SlotBattles.push_back(new DebugPetBattle(l_I));
+            }
+
+            uint32 l_StartTime = getMSTime();
+            for (uint32 l_Tick = 0; l_Tick < l_Ticks; ++l_Tick)
+            {
+                for (auto const& l_Pair : l_MapBattles)
+                    l_Pair.second->Update(PETBATTLE_UPDATE_INTERVAL);
+            }
+            uint32 l_MapTime = GetMSTimeDiffToNow(l_StartTime);
+
+            l_StartTime = getMSTime();
+            for (uint32 l_Tick = 0; l_Tick < l_Ticks; ++l_Tick)
+            {
+                for (DebugPetBattle* l_Battle : l_SlotBattles)
+                    l_Battle->Update(PETBATTLE_UPDATE_INTERVAL);
+            }
+            uint32 l_SlotTime = GetMSTimeDiffToNow(l_StartTime);
+
+            /// Threads are started at each tick, so this also pays what the map updater pool saves
+            l_StartTime = getMSTime();
+            for (uint32 l_Tick = 0; l_Tick < l_Ticks; ++l_Tick)
+            {
+                std::vector<std::thread> l_Threads;
+                for (uint32 l_Shard = 0; l_Shard < l_ThreadCount; ++l_Shard)
+                {
+                    l_Threads.emplace_back([&l_SlotBattles, l_Shard, l_ThreadCount]()
+                    {
+                        for (size_t l_I = l_Shard; l_I < l_SlotBattles.size(); l_I += l_ThreadCount)
+                            l_SlotBattles[l_I]->Update(PETBATTLE_UPDATE_INTERVAL);
+                    });
+                }
+
+                for (std::thread& l_Thread : l_Threads)
+                    l_Thread.join();
+            }
+            uint32 l_ShardTime = GetMSTimeDiffToNow(l_StartTime);
+
+            uint64 l_MapRounds = 0;
+            for (auto const& l_Pair : l_MapBattles)
+            {
+                l_MapRounds += l_Pair.second->Rounds;
+                delete l_Pair.second;
+            }
+
+            uint64 l_SlotRounds = 0;
+            for (DebugPetBattle* l_Battle : l_SlotBattles)
+            {
+                l_SlotRounds += l_Battle->Rounds;
+                delete l_Battle;
+            }
+
+            p_Handler->PSendSysMessage("%u battles x %u ticks: map %u ms, slots %u ms, slots on %u threads %u ms%s", l_BattleCount, l_Ticks, l_MapTime,
+                l_SlotTime, l_ThreadCount, l_ShardTime, l_MapRounds * 2 == l_SlotRounds ? "" : " (results differ)");
+            return true;
+        }
+
+        /// Queued group of the .debug bench bgscheduler benchmark
+        struct DebugQueuedGroup
+        {
+            uint32 JoinTime;
+            uint32 Team;
+            uint32 BracketId;
+            uint64 WantedBGs;
+            std::vector<uint64> Players;
+        };
+
+        /// Bracket queue of the .debug bench bgscheduler benchmark, with the aggregates BattlegroundScheduler maintains
+        struct DebugBracketQueue
+        {
+            DebugBracketQueue() : WantedPlayers(), Changed(false), LastDecisionTime(0) { }
+
+            /// A group joins after the queued ones, so the queue stays in join order
+            void Add(DebugQueuedGroup* p_Group)
+            {
+                Groups[p_Group->Team].push_back(p_Group);
+                UpdateAggregates(p_Group, int32(p_Group->Players.size()));
+            }
+
+            void Remove(DebugQueuedGroup* p_Group)
+            {
+                Groups[p_Group->Team].remove(p_Group);
+                UpdateAggregates(p_Group, -int32(p_Group->Players.size()));
+            }
+
+            void UpdateAggregates(DebugQueuedGroup const* p_Group, int32 p_Players)
+            {
+                for (uint32 l_I = 0; l_I < MS::Battlegrounds::BattlegroundType::Max; ++l_I)
+                {
+                    if (p_Group->WantedBGs & (1LL << l_I))
+                        WantedPlayers[p_Group->Team][l_I] += p_Players;
+                }
+
+                Changed = true;
+            }
+
+            std::list<DebugQueuedGroup*> Groups[2];
+            uint32 WantedPlayers[2][MS::Battlegrounds::BattlegroundType::Max];
+            bool Changed;
+            uint32 LastDecisionTime;
+        };
+
+        /// Candidate lists of a bracket as FindPotentialBGs builds them, every player level is looked up as ObjectAccessor would do
+        static uint32 DebugBuildBgCandidates(DebugBracketQueue const& p_Queue, std::map<uint64, uint32> const& p_Levels, bool p_WishFirst)
+        {
+            uint32 const l_Max = MS::Battlegrounds::BattlegroundType::Max;
+            uint32 const l_MaxPlayersPerTeam = 10;
+
+            std::vector<uint32> l_Counts(l_Max * 2);
+            std::vector<std::list<DebugQueuedGroup*>> l_Candidates(l_Max * 2);
+            uint32 l_CandidateCount = 0;
+
+            for (uint32 l_Team = 0; l_Team < 2; ++l_Team)
+            {
+                for (DebugQueuedGroup* l_Group : p_Queue.Groups[l_Team])
+                {
+                    for (uint32 l_I = 0; l_I < l_Max; ++l_I)
+                    {
+                        bool l_Wished = (l_Group->WantedBGs & (1LL << l_I)) != 0;
+                        if (p_WishFirst && !l_Wished)
+                            continue;
+
+                        bool l_LevelOk = true;
+                        for (uint64 l_Guid : l_Group->Players)
+                        {
+                            auto l_Itr = p_Levels.find(l_Guid);
+                            if (l_Itr != p_Levels.end() && l_Itr->second < 10)
+                                l_LevelOk = false;
+                        }
+
+                        if (!l_LevelOk || !l_Wished || l_Counts[l_I * 2 + l_Team] + l_Group->Players.size() > l_MaxPlayersPerTeam)
+                            continue;
+
+                        l_Counts[l_I * 2 + l_Team] += uint32(l_Group->Players.size());
+                        l_Candidates[l_I * 2 + l_Team].push_back(l_Group);
+                        ++l_CandidateCount;
+                    }
+                }
+            }
+
+            return l_CandidateCount;
+        }
+
+        /// .debug bench bgscheduler [groups] - live scheduling latency, and synthetic queues scheduled by rebuilding the candidate lists at each
+        /// pass (sort, every group against every battleground type) against the per bracket aggregates of BattlegroundScheduler
+        static bool HandleDebugBenchBgSchedulerCommand(ChatHandler* p_Handler, char const* p_Args)
+        {
+            if (!CanRunBenchmark(p_Handler))
+                return false;
+
+            using namespace MS::Battlegrounds;
+
+            SchedulerStats const& l_Stats = sBattlegroundMgr->GetScheduler().GetStats();
+            p_Handler->PSendSysMessage("Scheduler: " UI64FMTD " passes, avg %u us, max %u us, " UI64FMTD " bracket decisions, " UI64FMTD " skipped", l_Stats.Passes,
+                uint32(l_Stats.Passes ? l_Stats.PassTime / l_Stats.Passes : 0), l_Stats.MaxPassTime, l_Stats.BracketDecisions, l_Stats.BracketSkips);
+            p_Handler->PSendSysMessage("Wait: " UI64FMTD " groups invited, avg %u ms, max %u ms", l_Stats.InvitedGroups,
+                uint32(l_Stats.InvitedGroups ? l_Stats.WaitTime / l_Stats.InvitedGroups : 0), l_Stats.MaxWaitTime);
+
+            char* l_GroupsStr = strtok((char*)p_Args, " ");
+            uint32 l_GroupCount = l_GroupsStr ? std::max(1, atoi(l_GroupsStr)) : 2000;
+            uint32 const l_Passes = 500;
+            uint32 const l_PassInterval = 50;
+
+            /// Most of the queue is at max level, solo players wishing random battlegrounds
+            std::vector<DebugQueuedGroup> l_Groups(l_GroupCount);
+            std::map<uint64, uint32> l_Levels;
+            uint64 l_Guid = 0;
+
+            for (uint32 l_I = 0; l_I < l_GroupCount; ++l_I)
+            {
+                DebugQueuedGroup& l_Group = l_Groups[l_I];
+                l_Group.JoinTime  = l_I;
+                l_Group.Team      = urand(0, 1);
+                l_Group.BracketId = roll_chance_i(80) ? Brackets::Count - 1 : urand(0, Brackets::Count - 1);
+
+                uint32 l_Roll = urand(0, 99);
+                if (l_Roll < 50)
+                    l_Group.WantedBGs = BattlegroundMasks::AllBattlegrounds;
+                else if (l_Roll < 80)
+                    l_Group.WantedBGs = 1LL << urand(BattlegroundType::Begin, BattlegroundType::NumBattlegrounds - 1);
+                else
+                    l_Group.WantedBGs = BattlegroundMasks::AllSkirmishArenas;
+
+                uint32 l_Size = roll_chance_i(70) ? 1 : urand(2, 5);
+                for (uint32 l_Player = 0; l_Player < l_Size; ++l_Player)
+                {
+                    l_Group.Players.push_back(++l_Guid);
+                    l_Levels[l_Guid] = 100;
+                }
+            }
+
+            uint32 l_Times[2];
+            uint64 l_Candidates[2] = { 0, 0 };
+
+            for (uint32 l_Incremental = 0; l_Incremental < 2; ++l_Incremental)
+            {
+                std::vector<DebugBracketQueue> l_Queues(Brackets::Count);
+                for (DebugQueuedGroup& l_Group : l_Groups)
+                    l_Queues[l_Group.BracketId].Add(&l_Group);
+
+                /// Same churn for both runs: a group leaves and rejoins before each pass
+                uint32 l_Seed = 12345;
+                uint32 l_Now = 0;
+
+                uint32 l_StartTime = getMSTime();
+                for (uint32 l_Pass = 0; l_Pass < l_Passes; ++l_Pass)
+                {
+                    l_Now += l_PassInterval;
+                    l_Seed = l_Seed * 1103515245 + 12345;
+
+                    DebugQueuedGroup& l_Group = l_Groups[(l_Seed >> 8) % l_GroupCount];
+                    l_Queues[l_Group.BracketId].Remove(&l_Group);
+                    l_Group.JoinTime = l_GroupCount + l_Now;
+                    l_Queues[l_Group.BracketId].Add(&l_Group);
+
+                    for (DebugBracketQueue& l_Queue : l_Queues)
+                    {
+                        if (!l_Incremental)
+                        {
+                            for (uint32 l_Team = 0; l_Team < 2; ++l_Team)
+                            {
+                                l_Queue.Groups[l_Team].sort([](DebugQueuedGroup const* p_A, DebugQueuedGroup const* p_B)
+                                {
+                                    return p_A->JoinTime < p_B->JoinTime;
+                                });
+                            }
+
+                            l_Candidates[0] += DebugBuildBgCandidates(l_Queue, l_Levels, false);
+                            continue;
+                        }
+
+                        if (l_Queue.Groups[0].empty() && l_Queue.Groups[1].empty())
+                            continue;
+
+                        if (!l_Queue.Changed && l_Now - l_Queue.LastDecisionTime < BATTLEGROUND_SCHEDULER_DECISION_INTERVAL)
+                            continue;
+
+                        l_Queue.Changed = false;
+                        l_Queue.LastDecisionTime = l_Now;
+
+                        bool l_MayStart = false;
+                        for (uint32 l_I = 0; l_I < BattlegroundType::Max && !l_MayStart; ++l_I)
+                            l_MayStart = l_Queue.WantedPlayers[0][l_I] >= 10 && l_Queue.WantedPlayers[1][l_I] >= 10;
+
+                        if (l_MayStart)
+                            l_Candidates[1] += DebugBuildBgCandidates(l_Queue, l_Levels, true);
+                    }
+                }
+                l_Times[l_Incremental] = GetMSTimeDiffToNow(l_StartTime);
+            }
+
+            p_Handler->PSendSysMessage("%u groups x %u passes: rebuild %u ms (" UI64FMTD " candidates), incremental %u ms (" UI64FMTD " candidates)", l_GroupCount, l_Passes,
+                l_Times[0], l_Candidates[0], l_Times[1], l_Candidates[1]);
+            return true;
+        }
+
+        /// .debug bench valuesupdate [iterations] - values update mask of the player and of the selected creature, flag test per field against the precomputed masks
+        static bool HandleDebugBenchValuesUpdateCommand(ChatHandler* p_Handler, char const* p_Args)
+        {
+            if (!CanRunBenchmark(p_Handler))
+                return false;
+
+            uint32 l_Iterations = (p_Args && *p_Args) ? std::max(1, atoi(p_Args)) : 10000;
+
+            Player* l_Player = p_Handler->GetSession()->GetPlayer();
+
+            std::vector<std::pair<char const*, Unit*>> l_Units;
+            l_Units.push_back(std::make_pair("player", l_Player));
+            if (Creature* l_Creature = p_Handler->getSelectedCreature())
+                l_Units.push_back(std::make_pair("creature", l_Creature));
+
+            for (auto const& l_Pair : l_Units)
+            {
+                Unit* l_Unit = l_Pair.second;
+                uint32 l_Count = l_Unit->GetValuesCount();
+
+                /// One field in 8 changed, about what a unit in combat has between two object updates
+                UpdateMask l_Changes;
+                l_Changes.SetCount(l_Count);
+                for (uint32 l_Index = 0; l_Index < l_Count; l_Index += 8)
+                    l_Changes.SetBit(l_Index);
+
+                uint32 l_VisibleFlags = UF_FLAG_PUBLIC | UF_FLAG_VIEWER_DEPENDENT;
+                if (l_Unit == l_Player)
+                    l_VisibleFlags |= UF_FLAG_PRIVATE;
+
+                UpdateMask l_Mask;
+                l_Mask.SetCount(l_Count);
+
+                uint32 l_Times[2];
+                uint32 l_Fields[2] = { 0, 0 };
+
+                /// Flag test per field, as before the precomputed masks
+                uint32 l_StartTime = getMSTime();
+                for (uint32 l_I = 0; l_I < l_Iterations; ++l_I)
+                {
+                    l_Mask.Clear();
+                    for (uint32 l_Index = 0; l_Index < l_Count; ++l_Index)
+                    {
+                        if (UF_FLAG_VIEWER_DEPENDENT & PlayerUpdateFieldFlags[l_Index] || (l_Changes.GetBit(l_Index) && (PlayerUpdateFieldFlags[l_Index] & l_VisibleFlags)))
+                            l_Mask.SetBit(l_Index);
+                    }
+                }
+                l_Times[0] = GetMSTimeDiffToNow(l_StartTime);
+
+                for (uint32 l_Index = 0; l_Index < l_Count; ++l_Index)
+                    l_Fields[0] += l_Mask.GetBit(l_Index) ? 1 : 0;
+
+                l_StartTime = getMSTime();
+                for (uint32 l_I = 0; l_I < l_Iterations; ++l_I)
+                    l_Unit->BuildValuesUpdateMask(&l_Changes, l_VisibleFlags, UF_FLAG_VIEWER_DEPENDENT, l_Mask);
+                l_Times[1] = GetMSTimeDiffToNow(l_StartTime);
+
+                for (uint32 l_Index = 0; l_Index < l_Count; ++l_Index)
+                    l_Fields[1] += l_Mask.GetBit(l_Index) ? 1 : 0;
+
+                /// Whole values update block as sent to the player, with the real changes of the unit
+                l_StartTime = getMSTime();
+                for (uint32 l_I = 0; l_I < l_Iterations; ++l_I)
+                {
+                    UpdateData l_Data(l_Player->GetMapId());
+                    l_Unit->BuildValuesUpdateBlockForPlayer(&l_Data, l_Player);
+                }
+                uint32 l_BlockTime = GetMSTimeDiffToNow(l_StartTime);
+
+                p_Handler->PSendSysMessage("%s, %u fields x %u: per field %u ms (%u fields), precomputed masks %u ms (%u fields), values update block %u ms", l_Pair.first, l_Count,
+                    l_Iterations, l_Times[0], l_Fields[0], l_Times[1], l_Fields[1], l_BlockTime);
+            }
+
+            p_Handler->PSendSysMessage("Masks: %u KB for the units", uint32(PlayerUpdateFieldVisibility.GetMemorySize() / 1024));
+            return true;
+        }
+
         static bool HandleDebugLfgCommand(ChatHandler* p_Handler, char const * /*p_Args*/)
         {
             if (sLFGMgr->IsInDebug())
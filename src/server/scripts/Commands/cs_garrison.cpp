@@ -1046,6 +1046,8 @@ class garrison_commandscript: public CommandScript
 
                         for (uint32 l_OrderI = 0; l_OrderI < l_PlotWorkOrder.size(); ++l_OrderI)
                             l_PlotWorkOrder[l_OrderI].CompleteTime = l_CurrentTimeStamp;
+
+                        l_Garr->ScheduleUpdate(MS::Garrison::UpdateType::WorkOrders);
                     }
                 }
             }
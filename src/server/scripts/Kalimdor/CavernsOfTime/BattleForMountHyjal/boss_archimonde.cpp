@@ -354,7 +354,7 @@ public:
             if (victim && me->IsWithinDistInMap(victim, me->GetAttackDistance(victim)))
                 return false;
 
-            std::list<HostileReference*>& m_threatlist = me->getThreatManager().getThreatList();
+            std::list<HostileReference*> const& m_threatlist = me->getThreatManager().getThreatList();
             if (m_threatlist.empty())
                 return false;
 
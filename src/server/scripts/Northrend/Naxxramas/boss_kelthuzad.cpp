@@ -597,7 +597,7 @@ public:
                         case EVENT_DETONATE:
                         {
                             std::vector<Unit*> unitList;
-                            std::list<HostileReference*> *threatList = &me->getThreatManager().getThreatList();
+                            std::list<HostileReference*> const* threatList = &me->getThreatManager().getThreatList();
                             for (std::list<HostileReference*>::const_iterator itr = threatList->begin(); itr != threatList->end(); ++itr)
                             {
                                 if ((*itr)->getTarget()->IsPlayer()
@@ -220,7 +220,7 @@ public:
             if (!target)
                 return;
 
-            std::list<HostileReference*>& m_threatlist = target->getThreatManager().getThreatList();
+            std::list<HostileReference*> const& m_threatlist = target->getThreatManager().getThreatList();
             std::list<HostileReference*>::const_iterator itr = m_threatlist.begin();
             for (; itr != m_threatlist.end(); ++itr)
             {
@@ -440,7 +440,7 @@ public:
 
         void CastFixate()
         {
-            std::list<HostileReference*>& m_threatlist = me->getThreatManager().getThreatList();
+            std::list<HostileReference*> const& m_threatlist = me->getThreatManager().getThreatList();
             if (m_threatlist.empty())
                 return; // No point continuing if empty threatlist.
             std::list<Unit*> targets;
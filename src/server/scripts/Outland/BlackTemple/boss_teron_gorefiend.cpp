@@ -159,7 +159,7 @@ public:
 
         void CheckPlayers()
         {
-            std::list<HostileReference*>& m_threatlist = me->getThreatManager().getThreatList();
+            std::list<HostileReference*> const& m_threatlist = me->getThreatManager().getThreatList();
             if (m_threatlist.empty())
                 return;                                         // No threat list. Don't continue.
             std::list<HostileReference*>::const_iterator itr = m_threatlist.begin();
@@ -312,7 +312,7 @@ public:
             if (!Blossom)
                 return;
 
-            std::list<HostileReference*>& m_threatlist = me->getThreatManager().getThreatList();
+            std::list<HostileReference*> const& m_threatlist = me->getThreatManager().getThreatList();
             std::list<HostileReference*>::const_iterator i = m_threatlist.begin();
             for (i = m_threatlist.begin(); i != m_threatlist.end(); ++i)
             {
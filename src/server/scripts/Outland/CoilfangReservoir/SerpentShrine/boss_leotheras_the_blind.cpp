@@ -515,7 +515,7 @@ public:
                 //Summon Inner Demon
                 if (InnerDemons_Timer <= diff)
                 {
-                    std::list<HostileReference*>& ThreatList = me->getThreatManager().getThreatList();
+                    std::list<HostileReference*> const& ThreatList = me->getThreatManager().getThreatList();
                     std::vector<Unit*> TargetList;
                     for (std::list<HostileReference*>::const_iterator itr = ThreatList.begin(); itr != ThreatList.end(); ++itr)
                     {
@@ -337,7 +337,7 @@ class boss_wase_mari : public CreatureScript
                                 break;
 
                             Talk(TEXT_PHASE_SWITCH);
-                            std::list<HostileReference*>& threatlist = me->getThreatManager().getThreatList();
+                            std::list<HostileReference*> const& threatlist = me->getThreatManager().getThreatList();
                             threatlist.empty();
                             me->GetMotionMaster()->MovePoint(1, me->GetHomePosition());
 
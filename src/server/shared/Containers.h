@@ -32,14 +32,14 @@ namespace JadeCore
             }
         }
 
-        template<class T>
-        void RandomResizeList(std::list<T> &list, uint32 size)
+        template<class T, class A>
+        void RandomResizeList(std::list<T, A> &list, uint32 size)
         {
             size_t list_size = list.size();
 
             while (list_size > size)
             {
-                typename std::list<T>::iterator itr = list.begin();
+                typename std::list<T, A>::iterator itr = list.begin();
                 std::advance(itr, urand(0, list_size - 1));
                 list.erase(itr);
                 --list_size;
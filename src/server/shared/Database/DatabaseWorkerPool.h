@@ -17,10 +17,13 @@
 #include "PreparedStatement.h"
 #include "Log.h"
 #include "QueryResult.h"
+#include "ResultSnapshot.h"
 #include "QueryHolder.h"
 #include "AdhocStatement.h"
 #include "MSCallback.hpp"
 
+#include <mutex>
+
 class PingOperation : public SQLOperation
 {
     //! Operation for idle delaythreads
@@ -37,7 +40,9 @@ class DatabaseWorkerPool
     public:
         /* Activity state */
         DatabaseWorkerPool() :
-        _queue(new ACE_Activation_Queue())
+        _queue(new ACE_Activation_Queue()),
+        _baseSynchCount(0),
+        _snapshots(NULL)
         {
             memset(_connectionCount, 0, sizeof(_connectionCount));
             
@@ -89,6 +94,44 @@ class DatabaseWorkerPool
             return res;
         }
 
+        //! Opens synchronous connections until the pool has at least count of them, for a burst of concurrent
+        //! synchronous queries (the parallel loaders at startup). No other thread may use the pool meanwhile.
+        void ReserveSynchConnections(uint8 count)
+        {
+            if (!_baseSynchCount)
+                _baseSynchCount = _connectionCount[IDX_SYNCH];
+
+            while (_connectionCount[IDX_SYNCH] < count)
+            {
+                T* t = new T(_connectionInfo);
+                if (!t->Open())
+                {
+                    //! Not deleted, the destructor expects an opened connection
+                    sLog->outError(LOG_FILTER_SQL_DRIVER, "DatabasePool '%s': cannot open more than %u synchronous connections.", GetDatabaseName(), _connectionCount[IDX_SYNCH]);
+                    return;
+                }
+
+                _connections[IDX_SYNCH].push_back(t);
+                ++_connectionCount[IDX_SYNCH];
+            }
+        }
+
+        //! Closes the connections opened by ReserveSynchConnections, same restriction
+        void ReleaseSynchConnections()
+        {
+            if (!_baseSynchCount)
+                return;
+
+            while (_connectionCount[IDX_SYNCH] > _baseSynchCount)
+            {
+                _connections[IDX_SYNCH].back()->Close();
+                _connections[IDX_SYNCH].pop_back();
+                --_connectionCount[IDX_SYNCH];
+            }
+
+            _baseSynchCount = 0;
+        }
+
         void Close()
         {
             sLog->outInfo(LOG_FILTER_SQL_DRIVER, "Closing down DatabasePool '%s'.", GetDatabaseName());
@@ -117,9 +160,16 @@ class DatabaseWorkerPool
             for (uint8 i = 0; i < _connectionCount[IDX_SYNCH]; ++i)
                 _connections[IDX_SYNCH][i]->Close();
 
+            //! Same for the connections opened for the streamed queries
+            for (size_t i = 0; i < _streamConnections.size(); ++i)
+                _streamConnections[i]->Close();
+
             //! Deletes the ACE_Activation_Queue object and its underlying ACE_Message_Queue
             delete _queue;
 
+            delete _snapshots;
+            _snapshots = NULL;
+
             sLog->outInfo(LOG_FILTER_SQL_DRIVER, "All connections on DatabasePool '%s' closed.", GetDatabaseName());
         }
 
@@ -263,6 +313,105 @@ class DatabaseWorkerPool
             return QueryResult(result);
         }
 
+        //! Directly executes an SQL query in string format over the binary protocol, the rows are fetched one at a time
+        //! while iterating the result instead of being copied in a ResultSet. Meant for the bulk loaders at startup.
+        //! The result holds its own connection until it is released, don't keep it around nor nest another stream in it.
+        StreamedQueryResult QueryStream(const char* sql)
+        {
+            if (_snapshots)
+            {
+                if (StreamedResultSet* snapshot = _snapshots->Load(sql))
+                {
+                    if (!snapshot->NextRow())
+                    {
+                        delete snapshot;
+                        return StreamedQueryResult(NULL);
+                    }
+
+                    return StreamedQueryResult(snapshot);
+                }
+            }
+
+            T* t = GetFreeStreamConnection();
+
+            StreamedResultSet* result = t->QueryStream(sql, false);
+            if (result && _snapshots)
+                result->SetRecorder(_snapshots->CreateWriter(sql, result->GetFieldCount()));
+
+            if (!result || !result->NextRow())
+            {
+                delete result;
+                t->Unlock();
+                return StreamedQueryResult(NULL);
+            }
+
+            return StreamedQueryResult(result, [t](StreamedResultSet* p_Result)
+            {
+                delete p_Result;
+                t->Unlock();
+            });
+        }
+
+        //! Serves the streamed queries from snapshot files stored in directory while the database is unchanged,
+        //! and writes a snapshot of each streamed query read from the server. Must be enabled before the loaders run.
+        //! The database signature hashes the content checksum of every table (CHECKSUM TABLE), so any change of
+        //! the rows invalidates the snapshots, whatever the table statistics of the server say.
+        bool EnableSnapshots(std::string const& directory)
+        {
+            QueryResult tables = Query("SELECT TABLE_NAME FROM information_schema.TABLES WHERE TABLE_SCHEMA = DATABASE() AND TABLE_TYPE = 'BASE TABLE' ORDER BY TABLE_NAME");
+            if (!tables)
+                return false;
+
+            std::string sql = "CHECKSUM TABLE ";
+            do
+            {
+                if (sql.size() > sizeof("CHECKSUM TABLE ") - 1)
+                    sql += ", ";
+
+                sql += '`';
+                sql += tables->Fetch()[0].GetString();
+                sql += '`';
+            }
+            while (tables->NextRow());
+
+            //! Rows are returned in the order of the statement
+            QueryResult checksums = Query(sql.c_str());
+            if (!checksums)
+            {
+                sLog->outError(LOG_FILTER_SQL_DRIVER, "DatabasePool '%s': cannot checksum the tables, snapshots disabled.", GetDatabaseName());
+                return false;
+            }
+
+            uint32 version = RESULT_SNAPSHOT_VERSION;
+            uint64 signature = ResultSnapshotStore::Hash(&version, sizeof(version));
+
+            do
+            {
+                Field* fields = checksums->Fetch();
+
+                std::string table = fields[0].GetString();
+                if (fields[1].IsNull())
+                {
+                    sLog->outError(LOG_FILTER_SQL_DRIVER, "DatabasePool '%s': cannot checksum table %s, snapshots disabled.", GetDatabaseName(), table.c_str());
+                    return false;
+                }
+
+                uint64 checksum = fields[1].GetUInt64();
+
+                signature = ResultSnapshotStore::Hash(table.c_str(), table.size() + 1, signature);
+                signature = ResultSnapshotStore::Hash(&checksum, sizeof(checksum), signature);
+            }
+            while (checksums->NextRow());
+
+            delete _snapshots;
+            _snapshots = new ResultSnapshotStore(directory, signature);
+
+            sLog->outInfo(LOG_FILTER_SQL_DRIVER, "DatabasePool '%s': snapshots enabled in %s (signature " UI64FMTD ").", GetDatabaseName(), directory.c_str(), signature);
+            return true;
+        }
+
+        ResultSnapshotStore const* GetSnapshots() const { return _snapshots; }
+
         //! Directly executes an SQL query in string format -with variable args- that will block the calling thread until finished.
         //! Returns reference counted auto pointer, no need for manual memory management in upper level code.
         QueryResult PQuery(const char* sql, MySQLConnection* conn, ...)
@@ -564,6 +713,30 @@ class DatabaseWorkerPool
             return NULL;
         }
 
+        //! Gets a connection for an unbuffered streamed query, the synchronous ones stay available
+        //! for the queries done while the rows are read. Opened on demand, reused afterwards.
+        //! Caller MUST call t->Unlock() once the result is released.
+        T* GetFreeStreamConnection()
+        {
+            std::lock_guard<std::mutex> guard(_streamConnectionsLock);
+
+            for (size_t i = 0; i < _streamConnections.size(); ++i)
+                if (_streamConnections[i]->LockIfReady())
+                    return _streamConnections[i];
+
+            T* t = new T(_connectionInfo);
+            if (!t->Open())
+            {
+                //! Not deleted, the destructor expects an opened connection
+                sLog->outError(LOG_FILTER_SQL_DRIVER, "DatabasePool '%s': cannot open a connection for streamed queries, using a synchronous one.", GetDatabaseName());
+                return GetFreeConnection();
+            }
+
+            t->LockIfReady();
+            _streamConnections.push_back(t);
+            return t;
+        }
+
         char const* GetDatabaseName() const
         {
             return _connectionInfo.database.c_str();
@@ -580,6 +753,10 @@ class DatabaseWorkerPool
         ACE_Activation_Queue*           _queue;             //! Queue shared by async worker threads.
         std::vector<T*>                 _connections[IDX_SIZE];
         uint32                          _connectionCount[IDX_SIZE];       //! Counter of MySQL connections;
+        uint32                          _baseSynchCount;                   //! Synchronous connections before ReserveSynchConnections, 0 if none reserved
+        std::vector<T*>                 _streamConnections;                //! Connections of the streamed queries, see GetFreeStreamConnection
+        std::mutex                      _streamConnectionsLock;
+        ResultSnapshotStore*            _snapshots;                        //! Snapshots of the streamed queries, NULL unless enabled
         MySQLConnectionInfo             _connectionInfo;
 };
 
@@ -14,6 +14,7 @@ Field::Field()
     data.type = MYSQL_TYPE_NULL;
     data.length = 0;
     data.raw = false;
+    data.streamed = false;
 }
 
 Field::~Field()
@@ -28,6 +29,17 @@ void Field::SetByteValue(void* newValue, enum_field_types newType, uint32 length
     data.length = length;
     data.type = newType;
     data.raw = true;
+    data.streamed = false;
+}
+
+void Field::SetStreamedValue(void* newValue, enum_field_types newType, uint32 length)
+{
+    // Points into the column buffers of the StreamedResultSet, valid until the next row
+    data.value = newValue;
+    data.length = length;
+    data.type = newType;
+    data.raw = true;
+    data.streamed = true;
 }
 
 void Field::SetStructuredValue(char* newValue, enum_field_types newType)
@@ -46,4 +58,5 @@ void Field::SetStructuredValue(char* newValue, enum_field_types newType)
 
     data.type = newType;
     data.raw = false;
+    data.streamed = false;
 }
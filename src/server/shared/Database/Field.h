@@ -28,11 +28,16 @@
 /// | TINYBLOB, MEDIUMBLOB,  | GetBinary, GetString                   |
 /// | BLOB, LONGBLOB         | GetBinary, GetString                   |
 /// | BINARY, VARBINARY      | GetBinary                              |
+///
+/// Rows of a StreamedResultSet are bound with every integer column as a BIGINT and every
+/// real/decimal column as a DOUBLE, their numeric getters convert like the text results do.
 
 class Field
 {
     friend class ResultSet;
     friend class PreparedResultSet;
+    friend class StreamedResultSet;
+    friend class ResultSnapshotReader;
 
     public:
         Field();
@@ -49,7 +54,7 @@ class Field
                 return 0;
 
             #ifdef TRINITY_DEBUG
-            if (!IsType(MYSQL_TYPE_TINY))
+            if (!data.streamed && !IsType(MYSQL_TYPE_TINY))
             {
                 ACE_Stack_Trace l_Trace;
                 printf("%s\n", l_Trace.c_str());
@@ -60,7 +65,7 @@ class Field
             #endif
 
             if (data.raw)
-                return *reinterpret_cast<uint8*>(data.value);
+                return data.streamed ? static_cast<uint8>(GetStreamedInteger()) : *reinterpret_cast<uint8*>(data.value);
             return static_cast<uint8>(atol((char*)data.value));
         }
 
@@ -70,7 +75,7 @@ class Field
                 return 0;
 
             #ifdef TRINITY_DEBUG
-            if (!IsType(MYSQL_TYPE_TINY))
+            if (!data.streamed && !IsType(MYSQL_TYPE_TINY))
             {
                 sLog->outFatal(LOG_FILTER_SQL, "FATAL: GetInt8() on non-tinyint field %s.%s (%s.%s) at index %u. Using type: %s.",
                               meta.TableAlias, meta.Alias, meta.TableName, meta.Name, meta.Index, meta.Type);
@@ -79,7 +84,7 @@ class Field
             #endif
 
             if (data.raw)
-                return *reinterpret_cast<int8*>(data.value);
+                return data.streamed ? static_cast<int8>(GetStreamedInteger()) : *reinterpret_cast<int8*>(data.value);
             return static_cast<int8>(atol((char*)data.value));
         }
 
@@ -89,7 +94,7 @@ class Field
                 return 0;
 
             #ifdef TRINITY_DEBUG
-            if (!IsType(MYSQL_TYPE_SHORT) && !IsType(MYSQL_TYPE_YEAR))
+            if (!data.streamed && !IsType(MYSQL_TYPE_SHORT) && !IsType(MYSQL_TYPE_YEAR))
             {
                 sLog->outFatal(LOG_FILTER_SQL, "FATAL: GetUInt16() on non-smallint field %s.%s (%s.%s) at index %u. Using type: %s.",
                               meta.TableAlias, meta.Alias, meta.TableName, meta.Name, meta.Index, meta.Type);
@@ -98,7 +103,7 @@ class Field
             #endif
 
             if (data.raw)
-                return *reinterpret_cast<uint16*>(data.value);
+                return data.streamed ? static_cast<uint16>(GetStreamedInteger()) : *reinterpret_cast<uint16*>(data.value);
             return static_cast<uint16>(atol((char*)data.value));
         }
 
@@ -108,7 +113,7 @@ class Field
                 return 0;
 
             #ifdef TRINITY_DEBUG
-            if (!IsType(MYSQL_TYPE_SHORT) && !IsType(MYSQL_TYPE_YEAR))
+            if (!data.streamed && !IsType(MYSQL_TYPE_SHORT) && !IsType(MYSQL_TYPE_YEAR))
             {
                 sLog->outFatal(LOG_FILTER_SQL, "FATAL: GetInt16() on non-smallint field %s.%s (%s.%s) at index %u. Using type: %s.",
                               meta.TableAlias, meta.Alias, meta.TableName, meta.Name, meta.Index, meta.Type);
@@ -117,7 +122,7 @@ class Field
             #endif
 
             if (data.raw)
-                return *reinterpret_cast<int16*>(data.value);
+                return data.streamed ? static_cast<int16>(GetStreamedInteger()) : *reinterpret_cast<int16*>(data.value);
             return static_cast<int16>(atol((char*)data.value));
         }
 
@@ -127,7 +132,7 @@ class Field
                 return 0;
 
             #ifdef TRINITY_DEBUG
-            if (!IsType(MYSQL_TYPE_INT24) && !IsType(MYSQL_TYPE_LONG))
+            if (!data.streamed && !IsType(MYSQL_TYPE_INT24) && !IsType(MYSQL_TYPE_LONG))
             {
                 sLog->outFatal(LOG_FILTER_SQL, "FATAL: GetUInt32() on non-(medium)int field %s.%s (%s.%s) at index %u. Using type: %s.",
                               meta.TableAlias, meta.Alias, meta.TableName, meta.Name, meta.Index, meta.Type);
@@ -136,7 +141,7 @@ class Field
             #endif
 
             if (data.raw)
-                return *reinterpret_cast<uint32*>(data.value);
+                return data.streamed ? static_cast<uint32>(GetStreamedInteger()) : *reinterpret_cast<uint32*>(data.value);
             return static_cast<uint32>(atol((char*)data.value));
         }
 
@@ -146,7 +151,7 @@ class Field
                 return 0;
 
             #ifdef TRINITY_DEBUG
-            if (!IsType(MYSQL_TYPE_INT24) && !IsType(MYSQL_TYPE_LONG))
+            if (!data.streamed && !IsType(MYSQL_TYPE_INT24) && !IsType(MYSQL_TYPE_LONG))
             {
                 sLog->outFatal(LOG_FILTER_SQL, "FATAL: GetInt32() on non-(medium)int field %s.%s (%s.%s) at index %u. Using type: %s.",
                               meta.TableAlias, meta.Alias, meta.TableName, meta.Name, meta.Index, meta.Type);
@@ -155,7 +160,7 @@ class Field
             #endif
 
             if (data.raw)
-                return *reinterpret_cast<int32*>(data.value);
+                return data.streamed ? static_cast<int32>(GetStreamedInteger()) : *reinterpret_cast<int32*>(data.value);
             return static_cast<int32>(atol((char*)data.value));
         }
 
@@ -165,7 +170,7 @@ class Field
                 return 0;
 
             #ifdef TRINITY_DEBUG
-            if (!IsType(MYSQL_TYPE_LONGLONG) && !IsType(MYSQL_TYPE_BIT))
+            if (!data.streamed && !IsType(MYSQL_TYPE_LONGLONG) && !IsType(MYSQL_TYPE_BIT))
             {
                 sLog->outFatal(LOG_FILTER_SQL, "FATAL: GetUInt64() on non-bigint field %s.%s (%s.%s) at index %u. Using type: %s.",
                               meta.TableAlias, meta.Alias, meta.TableName, meta.Name, meta.Index, meta.Type);
@@ -174,7 +179,7 @@ class Field
             #endif
 
             if (data.raw)
-                return *reinterpret_cast<uint64*>(data.value);
+                return data.streamed ? static_cast<uint64>(GetStreamedInteger()) : *reinterpret_cast<uint64*>(data.value);
             return static_cast<uint64>(atol((char*)data.value));
         }
 
@@ -184,7 +189,7 @@ class Field
                 return 0;
 
             #ifdef TRINITY_DEBUG
-            if (!IsType(MYSQL_TYPE_LONGLONG) && !IsType(MYSQL_TYPE_BIT))
+            if (!data.streamed && !IsType(MYSQL_TYPE_LONGLONG) && !IsType(MYSQL_TYPE_BIT))
             {
                 sLog->outFatal(LOG_FILTER_SQL, "FATAL: GetInt64() on non-bigint field %s.%s (%s.%s) at index %u. Using type: %s.",
                               meta.TableAlias, meta.Alias, meta.TableName, meta.Name, meta.Index, meta.Type);
@@ -193,7 +198,7 @@ class Field
             #endif
 
             if (data.raw)
-                return *reinterpret_cast<int64*>(data.value);
+                return data.streamed ? static_cast<int64>(GetStreamedInteger()) : *reinterpret_cast<int64*>(data.value);
             return static_cast<int64>(strtol((char*)data.value, NULL, 10));
         }
 
@@ -203,7 +208,7 @@ class Field
                 return 0.0f;
 
             #ifdef TRINITY_DEBUG
-            if (!IsType(MYSQL_TYPE_FLOAT))
+            if (!data.streamed && !IsType(MYSQL_TYPE_FLOAT))
             {
                 sLog->outFatal(LOG_FILTER_SQL, "FATAL: GetFloat() on non-float field %s.%s (%s.%s) at index %u. Using type: %s.",
                               meta.TableAlias, meta.Alias, meta.TableName, meta.Name, meta.Index, meta.Type);
@@ -212,7 +217,7 @@ class Field
             #endif
 
             if (data.raw)
-                return *reinterpret_cast<float*>(data.value);
+                return data.streamed ? static_cast<float>(GetStreamedReal()) : *reinterpret_cast<float*>(data.value);
             return static_cast<float>(atof((char*)data.value));
         }
 
@@ -222,7 +227,7 @@ class Field
                 return 0.0f;
 
             #ifdef TRINITY_DEBUG
-            if (!IsType(MYSQL_TYPE_DOUBLE))
+            if (!data.streamed && !IsType(MYSQL_TYPE_DOUBLE))
             {
                 sLog->outFatal(LOG_FILTER_SQL, "FATAL: GetDouble() on non-double field %s.%s (%s.%s) at index %u. Using type: %s.",
                               meta.TableAlias, meta.Alias, meta.TableName, meta.Name, meta.Index, meta.Type);
@@ -231,7 +236,7 @@ class Field
             #endif
 
             if (data.raw)
-                return *reinterpret_cast<double*>(data.value);
+                return data.streamed ? GetStreamedReal() : *reinterpret_cast<double*>(data.value);
             return static_cast<double>(atof((char*)data.value));
         }
 
@@ -291,6 +296,7 @@ class Field
             void* value;            // Actual data in memory
             enum_field_types type;  // Field type
             bool raw;               // Raw bytes? (Prepared statement or ad hoc)
+            bool streamed;          // Raw bytes of a StreamedResultSet, see GetStreamedInteger
          } data;
         #if defined(__GNUC__)
         #pragma pack()
@@ -300,6 +306,33 @@ class Field
 
         void SetByteValue(void* newValue, enum_field_types newType, uint32 length);
         void SetStructuredValue(char* newValue, enum_field_types newType);
+        void SetStreamedValue(void* newValue, enum_field_types newType, uint32 length);
+
+        int64 GetStreamedInteger() const
+        {
+            switch (data.type)
+            {
+                case MYSQL_TYPE_LONGLONG:
+                    return *reinterpret_cast<int64*>(data.value);
+                case MYSQL_TYPE_DOUBLE:
+                    return static_cast<int64>(*reinterpret_cast<double*>(data.value));
+                default:
+                    return strtoll(static_cast<char const*>(data.value), NULL, 10);
+            }
+        }
+
+        double GetStreamedReal() const
+        {
+            switch (data.type)
+            {
+                case MYSQL_TYPE_DOUBLE:
+                    return *reinterpret_cast<double*>(data.value);
+                case MYSQL_TYPE_LONGLONG:
+                    return static_cast<double>(*reinterpret_cast<int64*>(data.value));
+                default:
+                    return atof(static_cast<char const*>(data.value));
+            }
+        }
 
         void CleanUp()
         {
@@ -375,6 +408,11 @@ class Field
                     data.type == MYSQL_TYPE_LONGLONG );
         }
 
+        bool IsNull() const
+        {
+            return data.value == NULL;
+        }
+
     private:
         #ifdef TRINITY_DEBUG
         static char const* FieldTypeToString(enum_field_types type)
@@ -307,6 +307,51 @@ ResultSet* MySQLConnection::Query(const char* sql)
     return new ResultSet(result, fields, rowCount, fieldCount);
 }
 
+StreamedResultSet* MySQLConnection::QueryStream(const char* sql, bool buffered)
+{
+    if (!m_Mysql || !sql)
+        return NULL;
+
+    /// Server side prepared statements do not accept the trailing ';' of some ad-hoc queries
+    size_t length = strlen(sql);
+    while (length && (sql[length - 1] == ';' || isspace(sql[length - 1])))
+        --length;
+
+    uint32 _s = getMSTime();
+
+    MYSQL_STMT* stmt = mysql_stmt_init(m_Mysql);
+    if (!stmt)
+    {
+        sLog->outError(LOG_FILTER_SQL, "[%u] %s", mysql_errno(m_Mysql), mysql_error(m_Mysql));
+        return NULL;
+    }
+
+    if (mysql_stmt_prepare(stmt, sql, length) || mysql_stmt_execute(stmt))
+    {
+        uint32 lErrno = mysql_errno(m_Mysql);
+        sLog->outInfo(LOG_FILTER_SQL, "SQL(s): %s", sql);
+        sLog->outError(LOG_FILTER_SQL, "[%u] %s", lErrno, mysql_stmt_error(stmt));
+        sLog->outAshran("[%u] %s", lErrno, mysql_stmt_error(stmt));
+        mysql_stmt_close(stmt);
+
+        if (_HandleMySQLErrno(lErrno))      // If it returns true, an error was handled successfully (i.e. reconnection)
+            return QueryStream(sql, buffered);    // We try again
+
+        return NULL;
+    }
+    else
+        sLog->outDebug(LOG_FILTER_SQL, "[%u ms] SQL(s): %s", getMSTimeDiff(_s, getMSTime()), sql);
+
+    MYSQL_RES* result = mysql_stmt_result_metadata(stmt);
+    if (!result)
+    {
+        mysql_stmt_close(stmt);
+        return NULL;
+    }
+
+    return new StreamedResultSet(stmt, result, mysql_stmt_field_count(stmt), buffered);
+}
+
 bool MySQLConnection::_Query(const char *sql, MYSQL_RES **pResult, MYSQL_FIELD **pFields, uint64* pRowCount, uint32* pFieldCount)
 {
     if (!m_Mysql)
@@ -8,6 +8,7 @@
 
 #include "DatabaseEnv.h"
 #include "Log.h"
+#include "ResultSnapshot.h"
 
 ResultSet::ResultSet(MYSQL_RES *result, MYSQL_FIELD *fields, uint64 rowCount, uint32 fieldCount) :
 _rowCount(rowCount),
@@ -234,3 +235,244 @@ void PreparedResultSet::CleanUp()
         m_rBind = nullptr;
     }
 }
+
+StreamedResultSet::StreamedResultSet(MYSQL_STMT* stmt, MYSQL_RES* result, uint32 fieldCount, bool buffered) :
+m_stmt(stmt),
+m_metadataResult(result),
+m_snapshot(NULL),
+m_recorder(NULL),
+m_rBind(NULL),
+m_row(NULL),
+m_rowCount(0),
+m_fieldCount(fieldCount),
+m_buffered(buffered)
+{
+    m_rBind = new MYSQL_BIND[m_fieldCount];
+    memset(m_rBind, 0, sizeof(MYSQL_BIND) * m_fieldCount);
+
+    m_columns.resize(m_fieldCount);
+    m_row = new Field[m_fieldCount];
+
+    //- Integers and reals are widened so any numeric getter can read them, everything else is read as text/bytes
+    MYSQL_FIELD* field = mysql_fetch_fields(m_metadataResult);
+    for (uint32 i = 0; i < m_fieldCount; ++i)
+    {
+        Column& column = m_columns[i];
+        column.Length = 0;
+        column.IsNull = 0;
+        column.Error = 0;
+
+        enum_field_types type;
+        switch (field[i].type)
+        {
+            case MYSQL_TYPE_TINY:
+            case MYSQL_TYPE_SHORT:
+            case MYSQL_TYPE_INT24:
+            case MYSQL_TYPE_LONG:
+            case MYSQL_TYPE_LONGLONG:
+            case MYSQL_TYPE_YEAR:
+                type = MYSQL_TYPE_LONGLONG;
+                column.Buffer.resize(sizeof(int64));
+                break;
+            case MYSQL_TYPE_FLOAT:
+            case MYSQL_TYPE_DOUBLE:
+            case MYSQL_TYPE_DECIMAL:
+            case MYSQL_TYPE_NEWDECIMAL:
+                type = MYSQL_TYPE_DOUBLE;
+                column.Buffer.resize(sizeof(double));
+                break;
+            case MYSQL_TYPE_TINY_BLOB:
+            case MYSQL_TYPE_MEDIUM_BLOB:
+            case MYSQL_TYPE_LONG_BLOB:
+            case MYSQL_TYPE_BLOB:
+                type = field[i].type;
+                column.Buffer.resize(std::min<unsigned long>(field[i].length, STREAMED_RESULT_STRING_BUFFER) + 1);
+                break;
+            default:
+                type = MYSQL_TYPE_STRING;
+                column.Buffer.resize(std::min<unsigned long>(field[i].length, STREAMED_RESULT_STRING_BUFFER) + 1);
+                break;
+        }
+
+        m_rBind[i].buffer_type = type;
+        m_rBind[i].buffer = &column.Buffer[0];
+        m_rBind[i].buffer_length = type == MYSQL_TYPE_LONGLONG || type == MYSQL_TYPE_DOUBLE ? column.Buffer.size() : column.Buffer.size() - 1;
+        m_rBind[i].length = &column.Length;
+        m_rBind[i].is_null = &column.IsNull;
+        m_rBind[i].error = &column.Error;
+        m_rBind[i].is_unsigned = field[i].flags & UNSIGNED_FLAG;
+
+#ifdef TRINITY_DEBUG
+        m_row[i].SetMetadata(&field[i], i);
+#endif
+    }
+
+    if (mysql_stmt_bind_result(m_stmt, m_rBind))
+    {
+        sLog->outWarn(LOG_FILTER_SQL, "%s:mysql_stmt_bind_result, cannot bind result from MySQL server. Error: %s", __FUNCTION__, mysql_stmt_error(m_stmt));
+        CleanUp();
+        return;
+    }
+
+    //- Buffered results are read by the client library in one go, still decoded one row at a time
+    if (m_buffered && mysql_stmt_store_result(m_stmt))
+    {
+        sLog->outWarn(LOG_FILTER_SQL, "%s:mysql_stmt_store_result, cannot bind result from MySQL server. Error: %s", __FUNCTION__, mysql_stmt_error(m_stmt));
+        CleanUp();
+    }
+}
+
+StreamedResultSet::StreamedResultSet(ResultSnapshotReader* snapshot) :
+m_stmt(NULL),
+m_metadataResult(NULL),
+m_snapshot(snapshot),
+m_recorder(NULL),
+m_rBind(NULL),
+m_row(NULL),
+m_rowCount(0),
+m_fieldCount(snapshot->GetFieldCount()),
+m_buffered(true)
+{
+    //- Values are read in place from the snapshot mapping
+    m_row = new Field[m_fieldCount];
+}
+
+StreamedResultSet::~StreamedResultSet()
+{
+    CleanUp();
+    delete m_snapshot;
+    delete[] m_row;
+}
+
+void StreamedResultSet::SetRecorder(ResultSnapshotWriter* recorder)
+{
+    delete m_recorder;
+    m_recorder = m_stmt ? recorder : NULL;
+
+    if (!m_stmt)
+        delete recorder;
+}
+
+bool StreamedResultSet::NextRow()
+{
+    if (m_snapshot)
+    {
+        if (!m_snapshot->ReadRow(m_row))
+            return false;
+
+        ++m_rowCount;
+        return true;
+    }
+
+    if (!m_stmt)
+        return false;
+
+    int retval = mysql_stmt_fetch(m_stmt);
+    if (retval == MYSQL_DATA_TRUNCATED && !FetchTruncatedColumns())
+        retval = 1;
+
+    if (retval != 0 && retval != MYSQL_DATA_TRUNCATED)
+    {
+        if (retval != MYSQL_NO_DATA)
+            sLog->outError(LOG_FILTER_SQL, "%s:mysql_stmt_fetch, cannot fetch row " UI64FMTD ". Error: %s", __FUNCTION__, m_rowCount, mysql_stmt_error(m_stmt));
+        //- The whole result was read, it can be reused on the next start
+        else if (m_recorder)
+            m_recorder->Commit();
+
+        CleanUp();
+        return false;
+    }
+
+    for (uint32 i = 0; i < m_fieldCount; ++i)
+    {
+        Column& column = m_columns[i];
+        enum_field_types type = m_rBind[i].buffer_type;
+
+        if (column.IsNull)
+        {
+            m_row[i].SetStreamedValue(NULL, type, 0);
+
+            if (m_recorder)
+                m_recorder->AddValue(type, NULL, 0);
+            continue;
+        }
+
+        if (type != MYSQL_TYPE_LONGLONG && type != MYSQL_TYPE_DOUBLE)
+        {
+            column.Length = std::min<unsigned long>(column.Length, column.Buffer.size() - 1);
+            column.Buffer[column.Length] = '\0';
+        }
+
+        m_row[i].SetStreamedValue(&column.Buffer[0], type, column.Length);
+
+        if (m_recorder)
+            m_recorder->AddValue(type, &column.Buffer[0], type == MYSQL_TYPE_LONGLONG || type == MYSQL_TYPE_DOUBLE ? sizeof(int64) : column.Length);
+    }
+
+    if (m_recorder)
+        m_recorder->EndRow();
+
+    ++m_rowCount;
+    return true;
+}
+
+bool StreamedResultSet::FetchTruncatedColumns()
+{
+    bool rebind = false;
+
+    for (uint32 i = 0; i < m_fieldCount; ++i)
+    {
+        Column& column = m_columns[i];
+        enum_field_types type = m_rBind[i].buffer_type;
+
+        //- Only strings and blobs can outgrow their buffer
+        if (!column.Error || type == MYSQL_TYPE_LONGLONG || type == MYSQL_TYPE_DOUBLE)
+            continue;
+
+        column.Buffer.resize(column.Length + 1);
+        m_rBind[i].buffer = &column.Buffer[0];
+        m_rBind[i].buffer_length = column.Length;
+
+        if (mysql_stmt_fetch_column(m_stmt, &m_rBind[i], i, 0))
+        {
+            sLog->outError(LOG_FILTER_SQL, "%s:mysql_stmt_fetch_column, cannot fetch column %u. Error: %s", __FUNCTION__, i, mysql_stmt_error(m_stmt));
+            return false;
+        }
+
+        rebind = true;
+    }
+
+    //- Next rows are fetched into the grown buffers
+    if (rebind && mysql_stmt_bind_result(m_stmt, m_rBind))
+    {
+        sLog->outError(LOG_FILTER_SQL, "%s:mysql_stmt_bind_result, cannot bind result from MySQL server. Error: %s", __FUNCTION__, mysql_stmt_error(m_stmt));
+        return false;
+    }
+
+    return true;
+}
+
+void StreamedResultSet::CleanUp()
+{
+    //- Not committed unless every row was read
+    delete m_recorder;
+    m_recorder = NULL;
+
+    if (m_stmt)
+    {
+        mysql_stmt_close(m_stmt);
+        m_stmt = NULL;
+    }
+
+    if (m_metadataResult)
+    {
+        mysql_free_result(m_metadataResult);
+        m_metadataResult = NULL;
+    }
+
+    if (m_rBind)
+    {
+        delete[] m_rBind;
+        m_rBind = NULL;
+    }
+}
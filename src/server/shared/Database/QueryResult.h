@@ -18,6 +18,9 @@
 #endif
 #include <mysql.h>
 
+class ResultSnapshotReader;
+class ResultSnapshotWriter;
+
 class ResultSet
 {
     public:
@@ -97,5 +100,69 @@ class PreparedResultSet
 
 typedef std::shared_ptr<PreparedResultSet> PreparedQueryResult;
 
+/// Initial buffer of a string/blob column of a StreamedResultSet, grown when a longer value is fetched
+#define STREAMED_RESULT_STRING_BUFFER 256
+
+/// Ad-hoc SELECT executed as a server side prepared statement and read in the binary protocol.
+///
+/// Rows are fetched one at a time with mysql_stmt_fetch into a single set of column buffers, so no
+/// value is converted to text and no Field is allocated per row: Fetch() always returns the same
+/// Field array, valid until the next NextRow(). Integer columns are bound as BIGINT and real/decimal
+/// columns as DOUBLE, any numeric getter can be used on them.
+/// When unbuffered, the rows are read from the socket as they are fetched, the connection stays
+/// locked by the result until it is destroyed and GetRowCount() is the number of rows read so far.
+/// The rows can also come from a snapshot file (see ResultSnapshot.h) instead of the server.
+class StreamedResultSet
+{
+    public:
+        StreamedResultSet(MYSQL_STMT* stmt, MYSQL_RES* result, uint32 fieldCount, bool buffered);
+        explicit StreamedResultSet(ResultSnapshotReader* snapshot);
+        ~StreamedResultSet();
+
+        /// Copy the rows read from the server to a snapshot, written once the last row is read
+        void SetRecorder(ResultSnapshotWriter* recorder);
+        bool IsFromSnapshot() const { return m_snapshot != NULL; }
+
+        bool NextRow();
+        uint64 GetRowCount() const { return m_rowCount; }
+        uint32 GetFieldCount() const { return m_fieldCount; }
+        bool IsBuffered() const { return m_buffered; }
+
+        Field* Fetch() const { return m_row; }
+        Field const& operator[](uint32 index) const
+        {
+            ASSERT(index < m_fieldCount);
+            return m_row[index];
+        }
+
+    private:
+        struct Column
+        {
+            std::vector<char> Buffer;
+            unsigned long Length;
+            my_bool IsNull;
+            my_bool Error;
+        };
+
+        bool FetchTruncatedColumns();
+        void CleanUp();
+
+        MYSQL_STMT* m_stmt;
+        MYSQL_RES* m_metadataResult;
+        ResultSnapshotReader* m_snapshot;
+        ResultSnapshotWriter* m_recorder;
+        MYSQL_BIND* m_rBind;
+        std::vector<Column> m_columns;
+        Field* m_row;
+        uint64 m_rowCount;
+        uint32 m_fieldCount;
+        bool m_buffered;
+
+        StreamedResultSet(StreamedResultSet const& right) = delete;
+        StreamedResultSet& operator=(StreamedResultSet const& right) = delete;
+};
+
+typedef std::shared_ptr<StreamedResultSet> StreamedQueryResult;
+
 #endif
 
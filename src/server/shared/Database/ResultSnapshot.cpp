@@ -0,0 +1,319 @@
+////////////////////////////////////////////////////////////////////////////////
+//
+//  MILLENIUM-STUDIO
+//  Copyright 2016 Millenium-studio SARL
+//  All Rights Reserved.
+//
+////////////////////////////////////////////////////////////////////////////////
+
+#include "ResultSnapshot.h"
+#include "QueryResult.h"
+#include "Log.h"
+
+#include <ace/OS_NS_stdio.h>
+#include <ace/OS_NS_sys_stat.h>
+
+#include <cstdio>
+
+/// Size of p_Size rounded up to the next 8 bytes boundary
+static inline size_t AlignSnapshotSize(size_t p_Size)
+{
+    return (p_Size + 7) & ~size_t(7);
+}
+
+static inline bool IsSnapshotNumericType(uint8 p_Type)
+{
+    return p_Type == MYSQL_TYPE_LONGLONG || p_Type == MYSQL_TYPE_DOUBLE;
+}
+
+//////////////////////////////////////////////////////////////////////////
+/// ResultSnapshotReader
+//////////////////////////////////////////////////////////////////////////
+
+ResultSnapshotReader::ResultSnapshotReader() :
+    m_Header(nullptr), m_Types(nullptr), m_Position(nullptr), m_End(nullptr), m_RowsRead(0)
+{
+}
+
+bool ResultSnapshotReader::Open(std::string const& p_Path, uint64 p_Signature, uint64 p_QueryHash)
+{
+    if (m_Map.map(p_Path.c_str(), static_cast<size_t>(-1), O_RDONLY, ACE_DEFAULT_FILE_PERMS, PROT_READ, ACE_MAP_PRIVATE) == -1)
+        return false;
+
+    if (m_Map.size() < sizeof(ResultSnapshotHeader))
+        return false;
+
+    uint8 const* l_Begin = static_cast<uint8 const*>(m_Map.addr());
+    m_Header = reinterpret_cast<ResultSnapshotHeader const*>(l_Begin);
+
+    if (m_Header->Magic != RESULT_SNAPSHOT_MAGIC || m_Header->Version != RESULT_SNAPSHOT_VERSION
+        || m_Header->Signature != p_Signature || m_Header->QueryHash != p_QueryHash)
+        return false;
+
+    if (m_Header->PayloadSize != m_Map.size() - sizeof(ResultSnapshotHeader) || m_Header->PayloadSize < AlignSnapshotSize(m_Header->FieldCount))
+        return false;
+
+    m_Types    = l_Begin + sizeof(ResultSnapshotHeader);
+    m_Position = m_Types + AlignSnapshotSize(m_Header->FieldCount);
+    m_End      = m_Types + m_Header->PayloadSize;
+
+    if (ResultSnapshotStore::Hash(m_Types, m_Header->PayloadSize) != m_Header->PayloadChecksum)
+    {
+        sLog->outError(LOG_FILTER_SQL, "ResultSnapshotReader: %s is corrupted, ignored.", p_Path.c_str());
+        return false;
+    }
+
+    return true;
+}
+
+bool ResultSnapshotReader::ReadRow(Field* p_Row)
+{
+    if (m_RowsRead >= m_Header->RowCount)
+        return false;
+
+    for (uint32 l_I = 0; l_I < m_Header->FieldCount; ++l_I)
+    {
+        if (m_Position + 8 > m_End)
+            return false;
+
+        uint32 l_Length = *reinterpret_cast<uint32 const*>(m_Position);
+        enum_field_types l_Type = enum_field_types(m_Types[l_I]);
+        m_Position += 8;
+
+        if (l_Length == RESULT_SNAPSHOT_NULL_VALUE)
+        {
+            p_Row[l_I].SetStreamedValue(NULL, l_Type, 0);
+            continue;
+        }
+
+        size_t l_Size = AlignSnapshotSize(l_Length + (IsSnapshotNumericType(l_Type) ? 0 : 1));
+        if (m_Position + l_Size > m_End)
+            return false;
+
+        p_Row[l_I].SetStreamedValue(const_cast<uint8*>(m_Position), l_Type, l_Length);
+        m_Position += l_Size;
+    }
+
+    ++m_RowsRead;
+    return true;
+}
+
+//////////////////////////////////////////////////////////////////////////
+/// ResultSnapshotWriter
+//////////////////////////////////////////////////////////////////////////
+
+ResultSnapshotWriter::ResultSnapshotWriter(ResultSnapshotStore& p_Store, std::string const& p_Path, uint64 p_QueryHash, uint32 p_FieldCount) :
+    m_Store(p_Store), m_Path(p_Path), m_TempPath(p_Path + ".tmp"), m_File(nullptr), m_TypesWritten(false), m_Column(0)
+{
+    memset(&m_Header, 0, sizeof(m_Header));
+    m_Header.Magic           = RESULT_SNAPSHOT_MAGIC;
+    m_Header.Version         = RESULT_SNAPSHOT_VERSION;
+    m_Header.Signature       = p_Store.GetSignature();
+    m_Header.QueryHash       = p_QueryHash;
+    m_Header.FieldCount      = p_FieldCount;
+    m_Header.PayloadChecksum = ResultSnapshotStore::Hash(nullptr, 0);
+
+    m_Types.resize(AlignSnapshotSize(p_FieldCount), 0);
+    m_Rows.reserve(RESULT_SNAPSHOT_CHUNK_SIZE);
+
+    m_File = fopen(m_TempPath.c_str(), "wb");
+    if (!m_File)
+    {
+        sLog->outError(LOG_FILTER_SQL, "ResultSnapshotWriter: cannot create %s.", m_TempPath.c_str());
+        return;
+    }
+
+    /// Rewritten by Commit once the sizes are known
+    if (fwrite(&m_Header, sizeof(m_Header), 1, m_File) != 1)
+        Discard();
+}
+
+ResultSnapshotWriter::~ResultSnapshotWriter()
+{
+    /// Not committed, the result wasn't read to the end
+    if (m_File)
+        Discard();
+}
+
+void ResultSnapshotWriter::Discard()
+{
+    sLog->outDebug(LOG_FILTER_SQL, "ResultSnapshotWriter: %s discarded.", m_TempPath.c_str());
+
+    fclose(m_File);
+    m_File = nullptr;
+    remove(m_TempPath.c_str());
+
+    m_Rows.clear();
+    m_Rows.shrink_to_fit();
+}
+
+void ResultSnapshotWriter::Pad()
+{
+    m_Rows.resize(AlignSnapshotSize(m_Rows.size()), 0);
+}
+
+void ResultSnapshotWriter::AddValue(enum_field_types p_Type, void const* p_Value, uint32 p_Length)
+{
+    if (!m_File)
+        return;
+
+    /// Bound types of the live result, the same for each row
+    if (!m_Header.RowCount && m_Column < m_Header.FieldCount)
+        m_Types[m_Column] = uint8(p_Type);
+
+    ++m_Column;
+
+    uint32 l_Header[2] = { p_Value ? p_Length : RESULT_SNAPSHOT_NULL_VALUE, 0 };
+    uint8 const* l_HeaderBytes = reinterpret_cast<uint8 const*>(l_Header);
+    m_Rows.insert(m_Rows.end(), l_HeaderBytes, l_HeaderBytes + sizeof(l_Header));
+
+    if (!p_Value)
+        return;
+
+    uint8 const* l_Value = static_cast<uint8 const*>(p_Value);
+    m_Rows.insert(m_Rows.end(), l_Value, l_Value + p_Length);
+
+    /// Strings are read in place, keep them terminated
+    if (!IsSnapshotNumericType(p_Type))
+        m_Rows.push_back(0);
+
+    Pad();
+}
+
+void ResultSnapshotWriter::EndRow()
+{
+    m_Column = 0;
+    ++m_Header.RowCount;
+
+    if (m_Rows.size() >= RESULT_SNAPSHOT_CHUNK_SIZE)
+        Flush();
+}
+
+void ResultSnapshotWriter::Flush()
+{
+    if (!m_File)
+        return;
+
+    /// The types are known once the first row was read, they come first in the payload
+    if (!m_TypesWritten)
+    {
+        if (!m_Types.empty() && fwrite(m_Types.data(), m_Types.size(), 1, m_File) != 1)
+        {
+            sLog->outError(LOG_FILTER_SQL, "ResultSnapshotWriter: cannot write %s.", m_TempPath.c_str());
+            Discard();
+            return;
+        }
+
+        m_Header.PayloadChecksum = ResultSnapshotStore::Hash(m_Types.data(), m_Types.size(), m_Header.PayloadChecksum);
+        m_Header.PayloadSize    += m_Types.size();
+        m_TypesWritten = true;
+    }
+
+    if (m_Rows.empty())
+        return;
+
+    if (fwrite(m_Rows.data(), m_Rows.size(), 1, m_File) != 1)
+    {
+        sLog->outError(LOG_FILTER_SQL, "ResultSnapshotWriter: cannot write %s.", m_TempPath.c_str());
+        Discard();
+        return;
+    }
+
+    m_Header.PayloadChecksum = ResultSnapshotStore::Hash(m_Rows.data(), m_Rows.size(), m_Header.PayloadChecksum);
+    m_Header.PayloadSize    += m_Rows.size();
+    m_Rows.clear();
+}
+
+bool ResultSnapshotWriter::Commit()
+{
+    Flush();
+
+    if (!m_File)
+        return false;
+
+    bool l_Written = !fseek(m_File, 0, SEEK_SET) && fwrite(&m_Header, sizeof(m_Header), 1, m_File) == 1;
+
+    int l_CloseError = fclose(m_File);
+    m_File = nullptr;
+
+    if (l_CloseError || !l_Written)
+    {
+        sLog->outError(LOG_FILTER_SQL, "ResultSnapshotWriter: cannot write %s.", m_TempPath.c_str());
+        remove(m_TempPath.c_str());
+        return false;
+    }
+
+    /// Windows does not replace an existing file on rename
+    remove(m_Path.c_str());
+    if (ACE_OS::rename(m_TempPath.c_str(), m_Path.c_str()))
+    {
+        sLog->outError(LOG_FILTER_SQL, "ResultSnapshotWriter: cannot move %s to %s.", m_TempPath.c_str(), m_Path.c_str());
+        remove(m_TempPath.c_str());
+        return false;
+    }
+
+    m_Store.Written++;
+    return true;
+}
+
+//////////////////////////////////////////////////////////////////////////
+/// ResultSnapshotStore
+//////////////////////////////////////////////////////////////////////////
+
+ResultSnapshotStore::ResultSnapshotStore(std::string const& p_Directory, uint64 p_Signature) :
+    Hits(0), Misses(0), Written(0), m_Directory(p_Directory), m_Signature(p_Signature)
+{
+    if (!m_Directory.empty() && m_Directory[m_Directory.size() - 1] != '/' && m_Directory[m_Directory.size() - 1] != '\\')
+        m_Directory += '/';
+
+    ACE_OS::mkdir(m_Directory.c_str());
+}
+
+uint64 ResultSnapshotStore::Hash(void const* p_Data, size_t p_Size, uint64 p_Hash)
+{
+    uint8 const* l_Data = static_cast<uint8 const*>(p_Data);
+
+    for (size_t l_I = 0; l_I < p_Size; ++l_I)
+    {
+        p_Hash ^= l_Data[l_I];
+        p_Hash *= 1099511628211ULL;
+    }
+
+    return p_Hash;
+}
+
+std::string ResultSnapshotStore::GetPath(uint64 p_QueryHash) const
+{
+    char l_Name[32];
+    snprintf(l_Name, sizeof(l_Name), "%016llx.snap", (unsigned long long)p_QueryHash);
+    return m_Directory + l_Name;
+}
+
+StreamedResultSet* ResultSnapshotStore::Load(char const* p_Sql)
+{
+    uint64 l_QueryHash = Hash(p_Sql, strlen(p_Sql));
+
+    ResultSnapshotReader* l_Reader = new ResultSnapshotReader();
+    if (!l_Reader->Open(GetPath(l_QueryHash), m_Signature, l_QueryHash))
+    {
+        delete l_Reader;
+        Misses++;
+        return nullptr;
+    }
+
+    Hits++;
+    sLog->outDebug(LOG_FILTER_SQL, "ResultSnapshotStore: " UI64FMTD " rows read from snapshot for SQL: %s", l_Reader->GetRowCount(), p_Sql);
+    return new StreamedResultSet(l_Reader);
+}
+
+ResultSnapshotWriter* ResultSnapshotStore::CreateWriter(char const* p_Sql, uint32 p_FieldCount)
+{
+    uint64 l_QueryHash = Hash(p_Sql, strlen(p_Sql));
+    return new ResultSnapshotWriter(*this, GetPath(l_QueryHash), l_QueryHash, p_FieldCount);
+}
+
+void ResultSnapshotStore::LogStats() const
+{
+    sLog->outInfo(LOG_FILTER_SERVER_LOADING, ">> World snapshot: %u queries read from snapshots, %u read from the database, %u snapshots written",
+        uint32(Hits), uint32(Misses), uint32(Written));
+}
@@ -0,0 +1,136 @@
+////////////////////////////////////////////////////////////////////////////////
+//
+//  MILLENIUM-STUDIO
+//  Copyright 2016 Millenium-studio SARL
+//  All Rights Reserved.
+//
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef RESULT_SNAPSHOT_H
+#define RESULT_SNAPSHOT_H
+
+#include "Define.h"
+
+#include <ace/Mem_Map.h>
+#include <atomic>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#ifdef _WIN32
+  #include <winsock2.h>
+#endif
+#include <mysql.h>
+
+class Field;
+class StreamedResultSet;
+class ResultSnapshotStore;
+
+#define RESULT_SNAPSHOT_MAGIC       0x504E5357      ///< "WSNP"
+#define RESULT_SNAPSHOT_VERSION     1
+#define RESULT_SNAPSHOT_NULL_VALUE  0xFFFFFFFF
+#define RESULT_SNAPSHOT_CHUNK_SIZE  (4 * 1024 * 1024)   ///< Rows buffered by a writer before they are written to its file
+
+/// File layout, every part is 8 bytes aligned so the values can be read in place from the mapping :
+///   ResultSnapshotHeader
+///   uint8 column types[FieldCount], padded
+///   rows : per column uint32 length (RESULT_SNAPSHOT_NULL_VALUE if NULL), uint32 0, value (+ '\0' for strings), padded
+struct ResultSnapshotHeader
+{
+    uint32 Magic;
+    uint32 Version;
+    uint64 Signature;                               ///< Database signature the rows were read with
+    uint64 QueryHash;
+    uint64 RowCount;
+    uint64 PayloadSize;                             ///< Column types and rows
+    uint64 PayloadChecksum;                         ///< FNV-1a of the payload
+    uint32 FieldCount;
+    uint32 Reserved;
+};
+
+/// Rows of a snapshot file, read in place from its memory mapping
+class ResultSnapshotReader
+{
+    public:
+        ResultSnapshotReader();
+
+        /// Map p_Path and check it against the expected signature and query
+        bool Open(std::string const& p_Path, uint64 p_Signature, uint64 p_QueryHash);
+
+        uint32 GetFieldCount() const { return m_Header->FieldCount; }
+        uint64 GetRowCount() const { return m_Header->RowCount; }
+
+        /// Point p_Row to the values of the next row, false at the end
+        bool ReadRow(Field* p_Row);
+
+    private:
+        ACE_Mem_Map m_Map;
+        ResultSnapshotHeader const* m_Header;
+        uint8 const* m_Types;
+        uint8 const* m_Position;
+        uint8 const* m_End;
+        uint64 m_RowsRead;
+};
+
+/// Copy of the rows of a live streamed result, streamed to a temporary file by chunks of RESULT_SNAPSHOT_CHUNK_SIZE.
+/// The file replaces the snapshot only once the result was read to the end, it is removed otherwise.
+class ResultSnapshotWriter
+{
+    public:
+        ResultSnapshotWriter(ResultSnapshotStore& p_Store, std::string const& p_Path, uint64 p_QueryHash, uint32 p_FieldCount);
+        ~ResultSnapshotWriter();
+
+        void AddValue(enum_field_types p_Type, void const* p_Value, uint32 p_Length);
+        void EndRow();
+
+        /// Complete the temporary file and move it over the snapshot, so a concurrent start never maps a partial snapshot
+        bool Commit();
+
+    private:
+        void Pad();
+        /// Write the buffered rows, preceded by the column types on the first call
+        void Flush();
+        void Discard();
+
+        ResultSnapshotStore& m_Store;
+        std::string m_Path;
+        std::string m_TempPath;
+        FILE* m_File;                               ///< nullptr once the write failed or the file was closed
+        ResultSnapshotHeader m_Header;
+        std::vector<uint8> m_Types;
+        std::vector<uint8> m_Rows;                  ///< Rows not written yet
+        bool m_TypesWritten;
+        uint32 m_Column;
+};
+
+/// Snapshots of the streamed queries of a database pool, valid as long as the database signature is unchanged.
+/// The signature is computed once when the store is enabled, a snapshot written for another signature is ignored
+/// and replaced by the next live read of the query.
+class ResultSnapshotStore
+{
+    public:
+        ResultSnapshotStore(std::string const& p_Directory, uint64 p_Signature);
+
+        /// Result read from the snapshot of the query, nullptr if there is no valid one
+        StreamedResultSet* Load(char const* p_Sql);
+        /// Recorder for the live result of the query
+        ResultSnapshotWriter* CreateWriter(char const* p_Sql, uint32 p_FieldCount);
+
+        uint64 GetSignature() const { return m_Signature; }
+
+        void LogStats() const;
+
+        static uint64 Hash(void const* p_Data, size_t p_Size, uint64 p_Hash = 14695981039346656037ULL);
+
+        std::atomic<uint32> Hits;
+        std::atomic<uint32> Misses;
+        std::atomic<uint32> Written;
+
+    private:
+        std::string GetPath(uint64 p_QueryHash) const;
+
+        std::string m_Directory;
+        uint64 m_Signature;
+};
+
+#endif
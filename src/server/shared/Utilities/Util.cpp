@@ -14,6 +14,13 @@
 #include <ace/TSS_T.h>
 #include <ace/INET_Addr.h>
 
+#if PLATFORM == PLATFORM_WINDOWS
+#include <psapi.h>
+#pragma comment(lib, "psapi.lib")
+#else
+#include <sys/resource.h>
+#endif
+
 # ifdef WIN32
     # include <ppl.h>
 # endif
@@ -522,4 +529,22 @@ void ParallelFor(uint32 p_Start, uint32 p_End, std::function<void(uint32)> p_Fun
         for (int l_I = p_Start; l_I < p_End; l_I++)
             p_Func(l_I);
     #endif
-}
\ No newline at end of file
+}
+
+uint64 GetPeakMemoryUsage()
+{
+#if PLATFORM == PLATFORM_WINDOWS
+    PROCESS_MEMORY_COUNTERS l_Counters;
+    if (!GetProcessMemoryInfo(GetCurrentProcess(), &l_Counters, sizeof(l_Counters)))
+        return 0;
+
+    return uint64(l_Counters.PeakWorkingSetSize);
+#else
+    struct rusage l_Usage;
+    if (getrusage(RUSAGE_SELF, &l_Usage))
+        return 0;
+
+    /// Kilobytes on Linux
+    return uint64(l_Usage.ru_maxrss) * 1024;
+#endif
+}
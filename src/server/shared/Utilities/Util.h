@@ -721,4 +721,7 @@ inline uint32 ExtractBitMaskBitCount(uint32 p_Value)
 
 void ParallelFor(uint32 p_Start, uint32 p_End, std::function<void(uint32)> p_Func);
 
+/// Peak resident memory of the process in bytes, 0 if unknown
+uint64 GetPeakMemoryUsage();
+
 #endif